@@ -0,0 +1,184 @@
+#include "benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace GCL::Benchmarks {
+
+using namespace std;
+using namespace std::chrono;
+
+namespace {
+
+struct RegisteredBenchmark {
+    string name;
+    BenchmarkFunction benchmark;
+};
+
+vector<RegisteredBenchmark>& getBenchmarks()
+{
+    static vector<RegisteredBenchmark> benchmarks;
+    return benchmarks;
+}
+
+///
+/// \brief Returns the value of an argument of the form --<name>=<value> or nullptr.
+///
+const char* getArgumentValue(const char* argument, const char* name)
+{
+    const auto nameLength = strlen(name);
+
+    if (strncmp(argument, name, nameLength) == 0 && argument[nameLength] == '=') {
+        return argument + nameLength + 1;
+    }
+
+    return nullptr;
+}
+
+void printUsage(const char* program)
+{
+    printf("Usage: %s [--filter=<substring>] [--min-time=<seconds>] [--list]\n", program);
+}
+
+} // namespace
+
+BenchmarkState::BenchmarkState(double minimumSeconds)
+    : m_minimumSeconds(minimumSeconds)
+{
+}
+
+bool BenchmarkState::keepRunning()
+{
+    if (!m_isStarted) {
+        m_isStarted = true;
+        resumeTiming();
+        return true;
+    }
+
+    m_iterationCount++;
+
+    if (m_isTiming && duration<double>(m_elapsed + (steady_clock::now() - m_start)).count() >= m_minimumSeconds) {
+        pauseTiming();
+        return false;
+    }
+
+    return true;
+}
+
+void BenchmarkState::pauseTiming()
+{
+    if (m_isTiming) {
+        m_elapsed += steady_clock::now() - m_start;
+        m_isTiming = false;
+    }
+}
+
+void BenchmarkState::resumeTiming()
+{
+    if (!m_isTiming) {
+        m_isTiming = true;
+        m_start = steady_clock::now();
+    }
+}
+
+void BenchmarkState::setItemsPerIteration(size_t itemCount)
+{
+    m_itemsPerIteration = itemCount;
+}
+
+size_t BenchmarkState::getIterationCount() const
+{
+    return m_iterationCount;
+}
+
+double BenchmarkState::getSeconds() const
+{
+    return duration<double>(m_elapsed).count();
+}
+
+size_t BenchmarkState::getItemsPerIteration() const
+{
+    return m_itemsPerIteration;
+}
+
+void registerBenchmark(string name, BenchmarkFunction benchmark)
+{
+    getBenchmarks().push_back({ move(name), move(benchmark) });
+}
+
+int runBenchmarks(int argc, char* argv[])
+{
+    string filter;
+    auto minimumSeconds = 0.5;
+    auto isListing = false;
+
+    for (auto i = 1; i < argc; i++) {
+        const auto argument = argv[i];
+
+        if (const auto value = getArgumentValue(argument, "--filter")) {
+            filter = value;
+        } else if (const auto value = getArgumentValue(argument, "--min-time")) {
+            minimumSeconds = atof(value);
+        } else if (strcmp(argument, "--list") == 0) {
+            isListing = true;
+        } else if (argument[0] != '-') {
+            filter = argument;
+        } else {
+            printUsage(argv[0]);
+            return strcmp(argument, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    if (!isListing) {
+        printf("%-40s %12s %14s %16s\n", "Benchmark", "Iterations", "ns/op", "items/s");
+    }
+
+    for (const auto& registeredBenchmark : getBenchmarks()) {
+        if (!filter.empty() && registeredBenchmark.name.find(filter) == string::npos) {
+            continue;
+        }
+
+        if (isListing) {
+            printf("%s\n", registeredBenchmark.name.c_str());
+            continue;
+        }
+
+        BenchmarkState state(minimumSeconds);
+        registeredBenchmark.benchmark(state);
+
+        const auto iterationCount = state.getIterationCount();
+        const auto seconds = state.getSeconds();
+
+        if (iterationCount == 0 || seconds <= 0.0) {
+            printf("%-40s %12s\n", registeredBenchmark.name.c_str(), "skipped");
+            continue;
+        }
+
+        const auto nanosecondsPerIteration = seconds * 1e9 / static_cast<double>(iterationCount);
+
+        if (state.getItemsPerIteration()) {
+            const auto itemsPerSecond = static_cast<double>(state.getItemsPerIteration()) * static_cast<double>(iterationCount) / seconds;
+            printf("%-40s %12zu %14.1f %16.4g\n", registeredBenchmark.name.c_str(), iterationCount, nanosecondsPerIteration, itemsPerSecond);
+        } else {
+            printf("%-40s %12zu %14.1f %16s\n", registeredBenchmark.name.c_str(), iterationCount, nanosecondsPerIteration, "-");
+        }
+
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+///
+/// \brief Last escaped address. It has external linkage, so the stores can not be removed.
+///
+const void* volatile escapedPointer = nullptr;
+
+void escape(const void* pointer)
+{
+    escapedPointer = pointer;
+}
+
+} // namespace GCL::Benchmarks
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace GCL::Benchmarks {
+
+using namespace std;
+
+///
+/// \brief Iteration state of a running benchmark.
+///
+/// A benchmark prepares its data and then runs its measured code in a
+/// while (state.keepRunning()) loop. Only the loop is timed.
+///
+class BenchmarkState {
+public:
+    ///
+    /// \brief Constructor
+    /// \param minimumSeconds Minimum measured time before the benchmark stops.
+    ///
+    explicit BenchmarkState(double minimumSeconds);
+
+    ///
+    /// \brief Returns whether another iteration should be run.
+    ///
+    /// Starts the clock on the first call and stops it once the minimum time is reached.
+    ///
+    /// \return Returns false if the benchmark is done.
+    ///
+    bool keepRunning();
+
+    ///
+    /// \brief Pauses the clock, e.g. to reset data between iterations.
+    ///
+    void pauseTiming();
+
+    ///
+    /// \brief Resumes the clock after pauseTiming().
+    ///
+    void resumeTiming();
+
+    ///
+    /// \brief Sets the number of processed items per iteration, e.g. vertices or pixels.
+    /// \param itemCount Items per iteration
+    ///
+    void setItemsPerIteration(size_t itemCount);
+
+    ///
+    /// \brief Returns the number of completed iterations.
+    /// \return Iteration count
+    ///
+    size_t getIterationCount() const;
+
+    ///
+    /// \brief Returns the measured time of all iterations.
+    /// \return Measured time in seconds.
+    ///
+    double getSeconds() const;
+
+    ///
+    /// \brief Returns the number of processed items per iteration.
+    /// \return Items per iteration
+    ///
+    size_t getItemsPerIteration() const;
+
+protected:
+    ///
+    /// \brief Minimum measured time in seconds.
+    ///
+    double m_minimumSeconds = 0.0;
+
+    ///
+    /// \brief Measured time of all finished timing intervals.
+    ///
+    chrono::steady_clock::duration m_elapsed = {};
+
+    ///
+    /// \brief Start of the current timing interval.
+    ///
+    chrono::steady_clock::time_point m_start;
+
+    ///
+    /// \brief Completed iterations.
+    ///
+    size_t m_iterationCount = 0;
+
+    ///
+    /// \brief Processed items per iteration.
+    ///
+    size_t m_itemsPerIteration = 0;
+
+    ///
+    /// \brief Flag if the first iteration was started.
+    ///
+    bool m_isStarted = false;
+
+    ///
+    /// \brief Flag if the clock is running.
+    ///
+    bool m_isTiming = false;
+};
+
+///
+/// \brief Function running a benchmark.
+///
+using BenchmarkFunction = function<void(BenchmarkState&)>;
+
+///
+/// \brief Registers a benchmark.
+/// \param name Name of the benchmark as "<group>/<case>".
+/// \param benchmark Function running the benchmark.
+///
+void registerBenchmark(string name, BenchmarkFunction benchmark);
+
+///
+/// \brief Runs all registered benchmarks matching the command line filter and prints their results.
+///
+/// Supported arguments are --filter=<substring>, --min-time=<seconds> and --list.
+///
+/// \param argc Argument count
+/// \param argv Arguments
+/// \return Exit code of the process.
+///
+int runBenchmarks(int argc, char* argv[]);
+
+///
+/// \brief Passes the address of a value to a function the compiler can not see through.
+/// \param pointer Address of the value.
+///
+void escape(const void* pointer);
+
+///
+/// \brief Prevents the compiler from optimizing away the computation of a value.
+/// \param value Computed value
+///
+template <typename Type>
+void doNotOptimize(const Type& value)
+{
+    escape(&value);
+}
+
+///
+/// \brief Registers the de Boor evaluation and track resampling benchmarks.
+///
+void registerCurveBenchmarks();
+
+///
+/// \brief Registers the material table, skin weight, mesh processing, pose, bounds and basis conversion benchmarks.
+///
+void registerMeshBenchmarks();
+
+///
+/// \brief Registers the texture decoding and encoding benchmarks.
+///
+void registerTextureBenchmarks();
+
+} // namespace GCL::Benchmarks
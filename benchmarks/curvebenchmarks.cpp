@@ -0,0 +1,93 @@
+#include "benchmark.h"
+#include "syntheticdata.h"
+
+#include "gcl/importer/deboor.h"
+#include "gcl/importer/deboorresampling.h"
+
+#include <vector>
+
+namespace GCL::Benchmarks {
+
+using namespace std;
+using namespace GCL::Importer;
+
+namespace {
+
+constexpr int KnotCount = 256;
+constexpr int Degree = 3;
+constexpr float TimeStep = 1.0f / 30.0f;
+
+void benchmarkDeBoorPosition(BenchmarkState& state)
+{
+    const auto curve = createCurve(3, KnotCount, TimeStep, 1);
+    const auto knots = padded_knots(curve->knots, Degree);
+
+    vector<Vector3> controls;
+    for (auto i = 0; i < KnotCount; i++) {
+        const auto control = &curve->controls[static_cast<size_t>(i) * 3];
+        controls.emplace_back(control[0], control[1], control[2]);
+    }
+
+    while (state.keepRunning()) {
+        for (auto i = 0; i < KnotCount; i++) {
+            const auto position = de_boor_position(Degree, static_cast<float>(i) * TimeStep, knots, controls);
+            doNotOptimize(position);
+        }
+    }
+
+    state.setItemsPerIteration(KnotCount);
+}
+
+void benchmarkDeBoorRotation(BenchmarkState& state)
+{
+    const auto curve = createCurve(4, KnotCount, TimeStep, 2);
+    const auto knots = padded_knots(curve->knots, Degree);
+
+    vector<Quaternion> controls;
+    for (auto i = 0; i < KnotCount; i++) {
+        const auto control = &curve->controls[static_cast<size_t>(i) * 4];
+        controls.emplace_back(control[0], control[1], control[2], control[3]);
+    }
+
+    while (state.keepRunning()) {
+        for (auto i = 0; i < KnotCount; i++) {
+            const auto rotation = de_boor_rotation(Degree, static_cast<float>(i) * TimeStep, knots, controls);
+            doNotOptimize(rotation);
+        }
+    }
+
+    state.setItemsPerIteration(KnotCount);
+}
+
+void benchmarkResampleTrack(BenchmarkState& state)
+{
+    const auto positionCurve = createCurve(3, KnotCount, TimeStep, 3);
+    const auto orientationCurve = createCurve(4, KnotCount, TimeStep, 4);
+    const auto duration = static_cast<float>(KnotCount - 1) * TimeStep;
+
+    // A negative scale also takes the path which mirrors the rotations.
+    const Vector3 scaleMultiply(-1.0f, 1.0f, 1.0f);
+
+    size_t keyCount = 0;
+
+    while (state.keepRunning()) {
+        const auto positions = resamplePositionCurve(Degree, KnotCount, positionCurve->controls.data(), KnotCount, duration, TimeStep);
+        const auto rotations = resampleRotationCurve(Degree, KnotCount, orientationCurve->controls.data(), KnotCount, duration, TimeStep, scaleMultiply);
+        keyCount = positions.size() + rotations.size();
+        doNotOptimize(positions.data());
+        doNotOptimize(rotations.data());
+    }
+
+    state.setItemsPerIteration(keyCount);
+}
+
+} // namespace
+
+void registerCurveBenchmarks()
+{
+    registerBenchmark("curve/de_boor_position", benchmarkDeBoorPosition);
+    registerBenchmark("curve/de_boor_rotation", benchmarkDeBoorRotation);
+    registerBenchmark("curve/resample_track", benchmarkResampleTrack);
+}
+
+} // namespace GCL::Benchmarks
@@ -0,0 +1,10 @@
+#include "benchmark.h"
+
+int main(int argc, char* argv[])
+{
+    GCL::Benchmarks::registerCurveBenchmarks();
+    GCL::Benchmarks::registerMeshBenchmarks();
+    GCL::Benchmarks::registerTextureBenchmarks();
+
+    return GCL::Benchmarks::runBenchmarks(argc, argv);
+}
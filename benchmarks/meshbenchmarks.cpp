@@ -0,0 +1,324 @@
+#include "benchmark.h"
+#include "syntheticdata.h"
+
+#include "gcl/utilities/basisconversion.h"
+#include "gcl/utilities/bonepartitioner.h"
+#include "gcl/utilities/bounds.h"
+#include "gcl/utilities/convexhull.h"
+#include "gcl/utilities/materialtable.h"
+#include "gcl/utilities/meshoptimizer.h"
+#include "gcl/utilities/meshsimplifier.h"
+#include "gcl/utilities/poseengine.h"
+#include "gcl/utilities/skinweights.h"
+#include "gcl/utilities/tangentgenerator.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace GCL::Benchmarks {
+
+using namespace std;
+using namespace GCL::Utilities;
+
+namespace {
+
+constexpr int GridSize = 128;
+constexpr int MaterialCount = 8;
+constexpr int BoneCount = 64;
+constexpr size_t AttributeCount = 8;
+constexpr size_t VertexStride = sizeof(SyntheticVertex);
+
+///
+/// \brief Positions, normals and uvs of the vertices as one float array, the input of the welding.
+///
+vector<float> getAttributes(const SyntheticMesh& mesh)
+{
+    vector<float> attributes;
+    attributes.reserve(mesh.vertices.size() * AttributeCount);
+
+    for (const auto& vertex : mesh.vertices) {
+        attributes.insert(attributes.end(), vertex.position, vertex.position + 3);
+        attributes.insert(attributes.end(), vertex.normal, vertex.normal + 3);
+        attributes.insert(attributes.end(), vertex.uv, vertex.uv + 2);
+    }
+
+    return attributes;
+}
+
+void benchmarkOptimizeMesh(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+    const auto attributes = getAttributes(*mesh);
+
+    vector<unsigned> indices;
+    vector<unsigned> remap;
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        indices = mesh->indices;
+        state.resumeTiming();
+
+        const auto uniqueCount = MeshOptimizer::weldVertices(attributes.data(), mesh->vertices.size(), AttributeCount, 1e-6f, remap);
+
+        for (auto& index : indices) {
+            index = remap[index];
+        }
+
+        MeshOptimizer::optimizeVertexCache(indices.data(), indices.size(), uniqueCount);
+        MeshOptimizer::optimizeVertexFetch(indices.data(), indices.size(), uniqueCount, remap);
+        doNotOptimize(indices.data());
+    }
+
+    state.setItemsPerIteration(mesh->indices.size() / 3);
+}
+
+void benchmarkSimplifyMesh(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+    const auto targetIndexCount = mesh->indices.size() / 4 / 3 * 3;
+
+    vector<unsigned> destination(mesh->indices.size());
+
+    while (state.keepRunning()) {
+        const auto indexCount = MeshSimplifier::simplify(
+            destination.data(),
+            mesh->indices.data(),
+            mesh->indices.size(),
+            mesh->vertices.front().position,
+            mesh->vertices.size(),
+            VertexStride / sizeof(float),
+            nullptr,
+            nullptr,
+            nullptr,
+            targetIndexCount,
+            0.01f);
+        doNotOptimize(indexCount);
+    }
+
+    state.setItemsPerIteration(mesh->indices.size() / 3);
+}
+
+void benchmarkNormalizeSkinWeights(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+    auto vertices = mesh->vertices;
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        vertices = mesh->vertices;
+        state.resumeTiming();
+
+        const auto prunedCount = SkinWeights::normalize(
+            vertices.front().boneWeights,
+            vertices.front().boneIndices,
+            vertices.size(),
+            VertexStride,
+            2,
+            0.01f);
+        doNotOptimize(prunedCount);
+    }
+
+    state.setItemsPerIteration(mesh->vertices.size());
+}
+
+void benchmarkPartitionMesh(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+    const auto triangleCount = mesh->indices.size() / 3;
+
+    // Distinct weighted bones of each triangle.
+    vector<unsigned> triangleBoneOffsets;
+    vector<unsigned> triangleBones;
+    triangleBoneOffsets.reserve(triangleCount + 1);
+
+    for (size_t triangleIndex = 0; triangleIndex < triangleCount; triangleIndex++) {
+        const auto first = triangleBones.size();
+        triangleBoneOffsets.push_back(static_cast<unsigned>(first));
+
+        for (auto corner = 0; corner < 3; corner++) {
+            const auto& vertex = mesh->vertices[mesh->indices[triangleIndex * 3 + static_cast<size_t>(corner)]];
+
+            for (auto influence = 0; influence < 4; influence++) {
+                const unsigned bone = vertex.boneIndices[influence];
+
+                if (vertex.boneWeights[influence] > 0 && find(triangleBones.begin() + static_cast<ptrdiff_t>(first), triangleBones.end(), bone) == triangleBones.end()) {
+                    triangleBones.push_back(bone);
+                }
+            }
+        }
+    }
+
+    triangleBoneOffsets.push_back(static_cast<unsigned>(triangleBones.size()));
+
+    while (state.keepRunning()) {
+        const auto partitions = BonePartitioner::partition(
+            mesh->indices.data(),
+            mesh->indices.size(),
+            mesh->vertices.size(),
+            triangleBoneOffsets.data(),
+            triangleBones.data(),
+            BoneCount / 4);
+        doNotOptimize(partitions);
+    }
+
+    state.setItemsPerIteration(triangleCount);
+}
+
+void benchmarkGenerateTangents(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+
+    vector<float> tangents;
+
+    while (state.keepRunning()) {
+        TangentGenerator::generate(
+            mesh->vertices.front().position,
+            mesh->vertices.front().normal,
+            mesh->vertices.front().uv,
+            mesh->vertices.size(),
+            VertexStride,
+            mesh->indices.data(),
+            mesh->indices.size(),
+            tangents);
+        doNotOptimize(tangents);
+    }
+
+    state.setItemsPerIteration(mesh->vertices.size());
+}
+
+void benchmarkConvexHull(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+
+    while (state.keepRunning()) {
+        const auto hull = ConvexHull::build(mesh->vertices.front().position, mesh->vertices.size(), VertexStride, 32);
+        doNotOptimize(hull);
+    }
+
+    state.setItemsPerIteration(mesh->vertices.size());
+}
+
+void benchmarkPoseEngine(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+    const auto& bones = mesh->bones;
+
+    // The rest pose as sampled animation frame.
+    vector<GrannyTransform> localTransforms;
+    for (const auto& bone : bones) {
+        localTransforms.push_back(bone.LocalTransform);
+    }
+
+    PoseEngine poseEngine(bones.data(), bones.size());
+
+    while (state.keepRunning()) {
+        poseEngine.computePose(localTransforms.data());
+        doNotOptimize(poseEngine.getWorldTransform(bones.size() - 1));
+    }
+
+    state.setItemsPerIteration(bones.size());
+}
+
+void benchmarkMaterialTable(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+    const auto triangleCount = mesh->indices.size() / 3;
+
+    vector<int> bindingSlots;
+    for (auto materialIndex = 0; materialIndex < MaterialCount; materialIndex++) {
+        bindingSlots.push_back(materialIndex);
+    }
+
+    while (state.keepRunning()) {
+        const auto triangleMaterials = MaterialTable::build(
+            mesh->groups.data(),
+            mesh->groups.size(),
+            bindingSlots.data(),
+            bindingSlots.size(),
+            triangleCount);
+        doNotOptimize(triangleMaterials.data());
+    }
+
+    state.setItemsPerIteration(triangleCount);
+}
+
+void benchmarkSkinWeights(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+
+    while (state.keepRunning()) {
+        const auto influences = SkinWeights::collectInfluences(
+            mesh->vertices.front().boneWeights,
+            mesh->vertices.front().boneIndices,
+            mesh->vertices.size(),
+            VertexStride,
+            BoneCount);
+        doNotOptimize(influences.data());
+    }
+
+    state.setItemsPerIteration(mesh->vertices.size());
+}
+
+void benchmarkComputeBounds(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+
+    while (state.keepRunning()) {
+        const auto box = Bounds::computeBox(mesh->vertices.front().position, mesh->vertices.size(), VertexStride);
+
+        float center[3];
+        Bounds::getCenter(box, center);
+        doNotOptimize(Bounds::computeRadius(mesh->vertices.front().position, mesh->vertices.size(), VertexStride, center));
+    }
+
+    state.setItemsPerIteration(mesh->vertices.size());
+}
+
+void benchmarkBasisConversion(BenchmarkState& state)
+{
+    const auto mesh = createMesh(GridSize, MaterialCount, BoneCount);
+    auto vertices = mesh->vertices;
+
+    // Z up meters to Y up centimeters, as from a 3ds Max file to fbx.
+    BasisConversion::Basis source;
+    source.up[1] = 0.0f;
+    source.up[2] = 1.0f;
+    source.back[1] = -1.0f;
+    source.back[2] = 0.0f;
+
+    BasisConversion::Basis target;
+    target.unitsPerMeter = 100.0f;
+
+    const auto conversion = BasisConversion::compute(source, target);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        vertices = mesh->vertices;
+        state.resumeTiming();
+
+        BasisConversion::transformPoints(conversion, vertices.front().position, vertices.size(), VertexStride);
+        BasisConversion::transformDirections(conversion, vertices.front().normal, vertices.size(), VertexStride);
+        doNotOptimize(vertices.data());
+    }
+
+    state.setItemsPerIteration(vertices.size());
+}
+
+} // namespace
+
+void registerMeshBenchmarks()
+{
+    registerBenchmark("mesh/material_table", benchmarkMaterialTable);
+    registerBenchmark("mesh/skin_weights", benchmarkSkinWeights);
+    registerBenchmark("mesh/optimize_mesh", benchmarkOptimizeMesh);
+    registerBenchmark("mesh/simplify_mesh", benchmarkSimplifyMesh);
+    registerBenchmark("mesh/normalize_skin_weights", benchmarkNormalizeSkinWeights);
+    registerBenchmark("mesh/partition_mesh", benchmarkPartitionMesh);
+    registerBenchmark("mesh/pose_engine", benchmarkPoseEngine);
+    registerBenchmark("mesh/generate_tangents", benchmarkGenerateTangents);
+    registerBenchmark("mesh/compute_bounds", benchmarkComputeBounds);
+    registerBenchmark("mesh/convex_hull", benchmarkConvexHull);
+    registerBenchmark("mesh/basis_conversion", benchmarkBasisConversion);
+}
+
+} // namespace GCL::Benchmarks
@@ -0,0 +1,281 @@
+#include "syntheticdata.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace GCL::Benchmarks {
+
+using namespace std;
+
+namespace VectorMath = GCL::Utilities::VectorMath;
+
+SyntheticCurve::SharedPtr createCurve(int dimension, int knotCount, float timeStep, unsigned seed)
+{
+    auto curve = make_shared<SyntheticCurve>();
+
+    mt19937 random(seed);
+    uniform_real_distribution<float> noise(-0.05f, 0.05f);
+
+    curve->knots.resize(static_cast<size_t>(knotCount));
+    curve->controls.resize(static_cast<size_t>(knotCount) * static_cast<size_t>(dimension));
+
+    for (auto knotIndex = 0; knotIndex < knotCount; knotIndex++) {
+        const auto time = static_cast<float>(knotIndex) * timeStep;
+        const auto control = &curve->controls[static_cast<size_t>(knotIndex) * static_cast<size_t>(dimension)];
+
+        curve->knots[static_cast<size_t>(knotIndex)] = time;
+
+        if (dimension == 4) {
+            // Rotation around a slowly wobbling axis.
+            const auto angle = time * 2.0f + noise(random);
+            float axis[3] = { sin(time * 0.5f), 1.0f, cos(time * 0.3f) };
+            const auto axisLength = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+
+            for (auto i = 0; i < 3; i++) {
+                control[i] = axis[i] / axisLength * sin(angle * 0.5f);
+            }
+
+            control[3] = cos(angle * 0.5f);
+        } else if (dimension == 9) {
+            // Scale shear close to the identity matrix.
+            for (auto i = 0; i < 9; i++) {
+                control[i] = (i % 4 == 0 ? 1.0f : 0.0f) + noise(random) * 0.1f;
+            }
+        } else {
+            for (auto i = 0; i < dimension; i++) {
+                control[i] = sin(time * static_cast<float>(i + 1)) * 10.0f + noise(random);
+            }
+        }
+    }
+
+    return curve;
+}
+
+SyntheticMesh::SharedPtr createMesh(int gridSize, int materialCount, int boneCount)
+{
+    auto mesh = make_shared<SyntheticMesh>();
+
+    mt19937 random(4);
+    uniform_int_distribution<int> weightNoise(0, 16);
+
+    const auto vertexCount = static_cast<size_t>(gridSize) * static_cast<size_t>(gridSize);
+    const auto cellCount = gridSize - 1;
+    const auto triangleCount = cellCount * cellCount * 2;
+
+    mesh->vertices.resize(vertexCount);
+
+    for (auto row = 0; row < gridSize; row++) {
+        for (auto column = 0; column < gridSize; column++) {
+            auto& vertex = mesh->vertices[static_cast<size_t>(row) * static_cast<size_t>(gridSize) + static_cast<size_t>(column)];
+            const auto u = static_cast<float>(column) / static_cast<float>(cellCount);
+            const auto v = static_cast<float>(row) / static_cast<float>(cellCount);
+
+            vertex = {};
+            vertex.position[0] = u * 10.0f;
+            vertex.position[1] = sin(u * 6.0f) * cos(v * 6.0f);
+            vertex.position[2] = v * 10.0f;
+            vertex.normal[1] = 1.0f;
+            vertex.uv[0] = u;
+            vertex.uv[1] = v;
+
+            // Four neighbouring bones along the grid columns.
+            const auto firstBone = column * boneCount / gridSize;
+            const auto firstWeight = 128 + weightNoise(random);
+            const auto secondWeight = 64;
+            const auto thirdWeight = 40;
+
+            vertex.boneWeights[0] = static_cast<unsigned char>(firstWeight);
+            vertex.boneWeights[1] = static_cast<unsigned char>(secondWeight);
+            vertex.boneWeights[2] = static_cast<unsigned char>(thirdWeight);
+            vertex.boneWeights[3] = static_cast<unsigned char>(255 - firstWeight - secondWeight - thirdWeight);
+
+            for (auto i = 0; i < 4; i++) {
+                vertex.boneIndices[i] = static_cast<unsigned char>((firstBone + i) % boneCount);
+            }
+        }
+    }
+
+    mesh->indices.reserve(static_cast<size_t>(triangleCount) * 3);
+
+    for (auto row = 0; row < cellCount; row++) {
+        for (auto column = 0; column < cellCount; column++) {
+            const auto topLeft = static_cast<unsigned>(row * gridSize + column);
+            const auto bottomLeft = topLeft + static_cast<unsigned>(gridSize);
+
+            mesh->indices.insert(mesh->indices.end(), { topLeft, bottomLeft, topLeft + 1 });
+            mesh->indices.insert(mesh->indices.end(), { topLeft + 1, bottomLeft, bottomLeft + 1 });
+        }
+    }
+
+    for (auto materialIndex = 0; materialIndex < materialCount; materialIndex++) {
+        const auto triFirst = triangleCount * materialIndex / materialCount;
+        const auto triLast = triangleCount * (materialIndex + 1) / materialCount;
+
+        mesh->groups.push_back({ materialIndex, triFirst, triLast - triFirst });
+    }
+
+    // A chain of bones, each slightly rotated and offset against its parent.
+    const auto orientation = VectorMath::fromEulerAngles(VectorMath::Vector3(5.0f, 10.0f, 2.0f));
+
+    mesh->bones.resize(static_cast<size_t>(boneCount));
+
+    for (auto boneIndex = 0; boneIndex < boneCount; boneIndex++) {
+        auto& bone = mesh->bones[static_cast<size_t>(boneIndex)];
+
+        bone = {};
+        bone.Name = "bone";
+        bone.ParentIndex = boneIndex - 1;
+        bone.LocalTransform.Flags = GrannyHasPosition | GrannyHasOrientation;
+        bone.LocalTransform.Position[0] = 10.0f / static_cast<float>(boneCount);
+
+        for (auto i = 0; i < 4; i++) {
+            bone.LocalTransform.Orientation[i] = orientation[static_cast<size_t>(i)];
+        }
+
+        for (auto i = 0; i < 3; i++) {
+            bone.LocalTransform.ScaleShear[i][i] = 1.0f;
+        }
+    }
+
+    return mesh;
+}
+
+SyntheticImage::SharedPtr createImage(int width, int height, int channels)
+{
+    auto image = make_shared<SyntheticImage>();
+
+    mt19937 random(5);
+    uniform_int_distribution<int> noise(0, 7);
+
+    image->width = width;
+    image->height = height;
+    image->channels = channels;
+    image->pixels.resize(static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels));
+
+    // Gradients with a little noise compress like typical diffuse textures.
+    for (auto y = 0; y < height; y++) {
+        for (auto x = 0; x < width; x++) {
+            const auto pixel = &image->pixels[(static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)) * static_cast<size_t>(channels)];
+
+            pixel[0] = static_cast<unsigned char>((x * 255 / max(width - 1, 1) + noise(random)) & 0xff);
+            pixel[1] = static_cast<unsigned char>((y * 255 / max(height - 1, 1) + noise(random)) & 0xff);
+            pixel[2] = static_cast<unsigned char>((x + y) & 0xff);
+
+            if (channels == 4) {
+                pixel[3] = 0xff;
+            }
+        }
+    }
+
+    return image;
+}
+
+SyntheticTexture::SharedPtr createRawTexture(int width, int height, int bytesPerPixel)
+{
+    auto texture = make_shared<SyntheticTexture>();
+
+    mt19937 random(5);
+    uniform_int_distribution<int> noise(0, 7);
+
+    const auto stride = width * bytesPerPixel;
+    texture->pixelBytes.resize(static_cast<size_t>(stride) * static_cast<size_t>(height));
+
+    auto& layout = texture->texture.Layout;
+    layout.BytesPerPixel = bytesPerPixel;
+
+    if (bytesPerPixel == 2) {
+        // BGR565
+        layout.ShiftForComponent[0] = 11;
+        layout.ShiftForComponent[1] = 5;
+        layout.ShiftForComponent[2] = 0;
+        layout.BitsForComponent[0] = 5;
+        layout.BitsForComponent[1] = 6;
+        layout.BitsForComponent[2] = 5;
+    } else {
+        // BGRA8888
+        layout.ShiftForComponent[0] = 16;
+        layout.ShiftForComponent[1] = 8;
+        layout.ShiftForComponent[2] = 0;
+        layout.ShiftForComponent[3] = 24;
+        layout.BitsForComponent[0] = 8;
+        layout.BitsForComponent[1] = 8;
+        layout.BitsForComponent[2] = 8;
+        layout.BitsForComponent[3] = 8;
+    }
+
+    // Gradients with a little noise compress like typical diffuse textures.
+    for (auto y = 0; y < height; y++) {
+        for (auto x = 0; x < width; x++) {
+            const auto red = static_cast<unsigned>((x * 255 / max(width - 1, 1) + noise(random)) & 0xff);
+            const auto green = static_cast<unsigned>((y * 255 / max(height - 1, 1) + noise(random)) & 0xff);
+            const auto blue = static_cast<unsigned>(((x + y) & 0xff));
+            const auto pixel = &texture->pixelBytes[static_cast<size_t>(y) * static_cast<size_t>(stride) + static_cast<size_t>(x) * static_cast<size_t>(bytesPerPixel)];
+
+            if (bytesPerPixel == 2) {
+                const auto value = static_cast<unsigned short>(((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3));
+                pixel[0] = static_cast<unsigned char>(value & 0xff);
+                pixel[1] = static_cast<unsigned char>(value >> 8);
+            } else {
+                pixel[0] = static_cast<unsigned char>(blue);
+                pixel[1] = static_cast<unsigned char>(green);
+                pixel[2] = static_cast<unsigned char>(red);
+                pixel[3] = 0xff;
+            }
+        }
+    }
+
+    texture->mipLevel.Stride = stride;
+    texture->mipLevel.PixelByteCount = static_cast<int>(texture->pixelBytes.size());
+    texture->mipLevel.PixelBytes = texture->pixelBytes.data();
+
+    texture->image.MIPLevelCount = 1;
+    texture->image.MIPLevels = &texture->mipLevel;
+
+    texture->texture.FromFileName = "synthetic_raw";
+    texture->texture.TextureType = GrannyColorMapTextureType;
+    texture->texture.Width = width;
+    texture->texture.Height = height;
+    texture->texture.Encoding = GrannyRawTextureEncoding;
+    texture->texture.ImageCount = 1;
+    texture->texture.Images = &texture->image;
+
+    return texture;
+}
+
+SyntheticTexture::SharedPtr createS3TCTexture(int width, int height, GrannyS3TCTextureFormat format)
+{
+    auto texture = make_shared<SyntheticTexture>();
+
+    mt19937 random(6);
+    uniform_int_distribution<int> byteValue(0, 255);
+
+    const auto blockSize = format == GrannyS3TCBGR565 || format == GrannyS3TCBGRA5551 ? 8 : 16;
+    const auto blockCount = static_cast<size_t>((width + 3) / 4) * static_cast<size_t>((height + 3) / 4);
+
+    // Random bytes are valid S3TC blocks.
+    texture->pixelBytes.resize(blockCount * static_cast<size_t>(blockSize));
+
+    for (auto& pixelByte : texture->pixelBytes) {
+        pixelByte = static_cast<unsigned char>(byteValue(random));
+    }
+
+    texture->mipLevel.PixelByteCount = static_cast<int>(texture->pixelBytes.size());
+    texture->mipLevel.PixelBytes = texture->pixelBytes.data();
+
+    texture->image.MIPLevelCount = 1;
+    texture->image.MIPLevels = &texture->mipLevel;
+
+    texture->texture.FromFileName = "synthetic_s3tc";
+    texture->texture.TextureType = GrannyColorMapTextureType;
+    texture->texture.Width = width;
+    texture->texture.Height = height;
+    texture->texture.Encoding = GrannyS3TCTextureEncoding;
+    texture->texture.SubFormat = format;
+    texture->texture.ImageCount = 1;
+    texture->texture.Images = &texture->image;
+
+    return texture;
+}
+
+} // namespace GCL::Benchmarks
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/vectormath.h"
+
+#include <memory>
+#include <vector>
+
+namespace GCL::Benchmarks {
+
+using namespace std;
+
+///
+/// \brief Keyframed curve with uniformly spaced knots and its controls.
+///
+struct SyntheticCurve {
+    using SharedPtr = shared_ptr<SyntheticCurve>;
+
+    vector<float> knots;
+    vector<float> controls;
+};
+
+///
+/// \brief Skinned vertex with the attributes used by the mesh kernels.
+///
+struct SyntheticVertex {
+    float position[3];
+    float normal[3];
+    float uv[2];
+    unsigned char boneWeights[4];
+    unsigned char boneIndices[4];
+};
+
+///
+/// \brief Skinned grid mesh with material groups and a chain of bones.
+///
+struct SyntheticMesh {
+    using SharedPtr = shared_ptr<SyntheticMesh>;
+
+    vector<SyntheticVertex> vertices;
+    vector<unsigned> indices;
+
+    ///
+    /// \brief Material groups, one consecutive range of triangles per material binding.
+    ///
+    vector<GrannyTriMaterialGroup> groups;
+
+    ///
+    /// \brief Bones of the chain, each one the parent of the next.
+    ///
+    vector<GrannyBone> bones;
+};
+
+///
+/// \brief Image with 8 bit RGB or RGBA pixels.
+///
+struct SyntheticImage {
+    using SharedPtr = shared_ptr<SyntheticImage>;
+
+    int width = 0;
+    int height = 0;
+    int channels = 4;
+    vector<unsigned char> pixels;
+};
+
+///
+/// \brief Texture with a single image and mip level.
+///
+struct SyntheticTexture {
+    using SharedPtr = shared_ptr<SyntheticTexture>;
+
+    vector<unsigned char> pixelBytes;
+    GrannyTextureMIPLevel mipLevel = {};
+    GrannyTextureImage image = {};
+    GrannyTexture texture = {};
+};
+
+///
+/// \brief Creates a smooth keyframed curve with uniformly spaced knots.
+///
+/// Orientation curves (dimension 4) have normalized controls, scale shear
+/// curves (dimension 9) are close to the identity matrix.
+///
+/// \param dimension Number of floats per control.
+/// \param knotCount Number of knots.
+/// \param timeStep Time between two knots.
+/// \param seed Seed of the random generator.
+/// \return Curve
+///
+SyntheticCurve::SharedPtr createCurve(int dimension, int knotCount, float timeStep, unsigned seed);
+
+///
+/// \brief Creates a skinned grid mesh.
+///
+/// Every vertex is weighted to up to four bones with weights summing up to 255.
+///
+/// \param gridSize Number of vertices per grid row and column.
+/// \param materialCount Number of material groups.
+/// \param boneCount Number of bones.
+/// \return Mesh
+///
+SyntheticMesh::SharedPtr createMesh(int gridSize, int materialCount, int boneCount);
+
+///
+/// \brief Creates an image with gradients and a little noise, like a typical diffuse texture.
+/// \param width Width in pixels.
+/// \param height Height in pixels.
+/// \param channels 3 for RGB or 4 for RGBA.
+/// \return Image
+///
+SyntheticImage::SharedPtr createImage(int width, int height, int channels);
+
+///
+/// \brief Creates a raw texture with a 8 bit BGRA or 16 bit BGR565 pixel layout.
+/// \param width Width in pixels.
+/// \param height Height in pixels.
+/// \param bytesPerPixel 4 for BGRA8888 or 2 for BGR565.
+/// \return Texture
+///
+SyntheticTexture::SharedPtr createRawTexture(int width, int height, int bytesPerPixel);
+
+///
+/// \brief Creates a S3TC texture with random blocks.
+/// \param width Width in pixels.
+/// \param height Height in pixels.
+/// \param format S3TC sub format.
+/// \return Texture
+///
+SyntheticTexture::SharedPtr createS3TCTexture(int width, int height, GrannyS3TCTextureFormat format);
+
+} // namespace GCL::Benchmarks
@@ -0,0 +1,76 @@
+#include "benchmark.h"
+#include "syntheticdata.h"
+
+#include "gcl/utilities/imagewriter.h"
+#include "gcl/utilities/texturedecoder.h"
+
+#include <vector>
+
+namespace GCL::Benchmarks {
+
+using namespace std;
+using namespace GCL::Utilities;
+
+namespace {
+
+constexpr int TextureSize = 1024;
+constexpr size_t PixelCount = static_cast<size_t>(TextureSize) * static_cast<size_t>(TextureSize);
+
+void benchmarkDecodeTexture(BenchmarkState& state, SyntheticTexture::SharedPtr texture)
+{
+    DecodedImage image;
+
+    while (state.keepRunning()) {
+        decodeTextureImage(&texture->texture, 0, 0, image);
+        doNotOptimize(image.pixels.data());
+    }
+
+    state.setItemsPerIteration(PixelCount);
+}
+
+void benchmarkEncodePng(BenchmarkState& state, int channels, PngCompression compression)
+{
+    const auto syntheticImage = createImage(TextureSize, TextureSize, channels);
+
+    ImageView image;
+    image.pixels = syntheticImage->pixels.data();
+    image.width = syntheticImage->width;
+    image.height = syntheticImage->height;
+    image.channels = channels;
+
+    while (state.keepRunning()) {
+        const auto png = encodePng(image, false, compression);
+        doNotOptimize(png.data());
+    }
+
+    state.setItemsPerIteration(static_cast<size_t>(image.width) * static_cast<size_t>(image.height));
+}
+
+} // namespace
+
+void registerTextureBenchmarks()
+{
+    registerBenchmark("texture/decode_raw_bgra8888", [](BenchmarkState& state) {
+        benchmarkDecodeTexture(state, createRawTexture(TextureSize, TextureSize, 4));
+    });
+    registerBenchmark("texture/decode_raw_bgr565", [](BenchmarkState& state) {
+        benchmarkDecodeTexture(state, createRawTexture(TextureSize, TextureSize, 2));
+    });
+    registerBenchmark("texture/decode_dxt1", [](BenchmarkState& state) {
+        benchmarkDecodeTexture(state, createS3TCTexture(TextureSize, TextureSize, GrannyS3TCBGR565));
+    });
+    registerBenchmark("texture/decode_dxt5", [](BenchmarkState& state) {
+        benchmarkDecodeTexture(state, createS3TCTexture(TextureSize, TextureSize, GrannyS3TCBGRA8888InterpolatedAlpha));
+    });
+    registerBenchmark("texture/encode_png_fast", [](BenchmarkState& state) {
+        benchmarkEncodePng(state, 4, PngCompression::Fast);
+    });
+    registerBenchmark("texture/encode_png_fast_rgb", [](BenchmarkState& state) {
+        benchmarkEncodePng(state, 3, PngCompression::Fast);
+    });
+    registerBenchmark("texture/encode_png_store", [](BenchmarkState& state) {
+        benchmarkEncodePng(state, 4, PngCompression::Store);
+    });
+}
+
+} // namespace GCL::Benchmarks
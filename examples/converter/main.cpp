@@ -4,6 +4,8 @@
 #include "gcl/importer/grannyimporter.h"
 #include "gcl/importer/grannyimportoptions.h"
 
+#include <cstdio>
+
 int main()
 {
 	// Initialize library.
@@ -43,5 +45,9 @@ int main()
 	// Export the fbx scene to a fbx file.
 	exporter.exportToFile("character_with_animation.fbx");
 
+	// Print the statistics of the import and export, e.g. stage times and processed vertices.
+	printf("Import: %s\n", importer.getStatistics().toString().c_str());
+	printf("Export: %s\n", exporter.getStatistics().toString().c_str());
+
 	return 0;
 }
\ No newline at end of file
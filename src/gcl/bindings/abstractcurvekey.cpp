@@ -7,22 +7,22 @@ AbstractCurveKey::AbstractCurveKey(GrannyCurve2 data)
 {
 }
 
-FbxTime AbstractCurveKey::getTime()
+double AbstractCurveKey::getTime()
 {
     return m_time;
 }
 
-void AbstractCurveKey::setTime(FbxDouble time)
+void AbstractCurveKey::setTime(double time)
 {
-    m_time.SetSecondDouble(time);
+    m_time = time;
 }
 
-FbxDouble3 AbstractCurveKey::getValue()
+Vector3 AbstractCurveKey::getValue()
 {
     return m_value;
 }
 
-void AbstractCurveKey::setValue(FbxDouble3 value)
+void AbstractCurveKey::setValue(const Vector3& value)
 {
     m_value = value;
 }
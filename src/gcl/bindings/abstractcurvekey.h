@@ -1,13 +1,14 @@
 #pragma once
 
 #include "gcl/importer/grannyformat.h"
-
-#include <fbxsdk.h>
+#include "gcl/utilities/vectormath.h"
 
 #include <vector>
 
 namespace GCL::Bindings {
 
+using GCL::Utilities::VectorMath::Vector3;
+
 ///
 /// \brief The AbstractCurveKey class.
 ///
@@ -21,27 +22,27 @@ public:
 
     ///
     /// \brief Returns the time of this key.
-    /// \return Key time
+    /// \return Key time in seconds
     ///
-    FbxTime getTime();
+    double getTime();
 
     ///
     /// \brief Sets the time of this key.
-    /// \param time Animation key time
+    /// \param time Animation key time in seconds
     ///
-    void setTime(FbxDouble time);
+    void setTime(double time);
 
     ///
     /// \brief Returns the value of this key.
     /// \return Key value
     ///
-    FbxDouble3 getValue();
+    Vector3 getValue();
 
     ///
     /// \brief Sets the value of this key.
     /// \param Animation key value
     ///
-    void setValue(FbxDouble3 value);
+    void setValue(const Vector3& value);
 
 protected:
     ///
@@ -50,14 +51,14 @@ protected:
     GrannyCurve2 m_data;
 
     ///
-    /// \brief Time of this key.
+    /// \brief Time of this key in seconds.
     ///
-    FbxTime m_time;
+    double m_time = 0.0;
 
     ///
     /// \brief Value of this key at a specific time, see m_time.
     ///
-    FbxDouble3 m_value;
+    Vector3 m_value;
 };
 
 } // namespace GCL::Bindings
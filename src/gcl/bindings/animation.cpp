@@ -23,4 +23,34 @@ void Animation::addTrack(Track::SharedPtr track)
     m_tracks.push_back(track);
 }
 
+vector<VectorTrack::SharedPtr> Animation::getVectorTracks()
+{
+    return m_vectorTracks;
+}
+
+void Animation::addVectorTrack(VectorTrack::SharedPtr vectorTrack)
+{
+    m_vectorTracks.push_back(vectorTrack);
+}
+
+vector<TextTrack::SharedPtr> Animation::getTextTracks()
+{
+    return m_textTracks;
+}
+
+void Animation::addTextTrack(TextTrack::SharedPtr textTrack)
+{
+    m_textTracks.push_back(textTrack);
+}
+
+RootMotion::SharedPtr Animation::getRootMotion()
+{
+    return m_rootMotion;
+}
+
+void Animation::setRootMotion(RootMotion::SharedPtr rootMotion)
+{
+    m_rootMotion = rootMotion;
+}
+
 } // namespace GCL::Bindings
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "gcl/bindings/binding.h"
+#include "gcl/bindings/rootmotion.h"
+#include "gcl/bindings/texttrack.h"
 #include "gcl/bindings/track.h"
+#include "gcl/bindings/vectortrack.h"
 #include "gcl/importer/grannyformat.h"
 
 #include <fbxsdk.h>
@@ -41,6 +44,42 @@ public:
     ///
     void addTrack(Track::SharedPtr track);
 
+    ///
+    /// \brief Returns the vector tracks of the animation.
+    /// \return Vector tracks
+    ///
+    vector<VectorTrack::SharedPtr> getVectorTracks();
+
+    ///
+    /// \brief Adds a vector track.
+    /// \param vectorTrack Vector track
+    ///
+    void addVectorTrack(VectorTrack::SharedPtr vectorTrack);
+
+    ///
+    /// \brief Returns the text tracks of the animation.
+    /// \return Text tracks
+    ///
+    vector<TextTrack::SharedPtr> getTextTracks();
+
+    ///
+    /// \brief Adds a text track.
+    /// \param textTrack Text track
+    ///
+    void addTextTrack(TextTrack::SharedPtr textTrack);
+
+    ///
+    /// \brief Returns the extracted root motion or nullptr if it was not extracted.
+    /// \return Root motion
+    ///
+    RootMotion::SharedPtr getRootMotion();
+
+    ///
+    /// \brief Sets the extracted root motion.
+    /// \param rootMotion Root motion
+    ///
+    void setRootMotion(RootMotion::SharedPtr rootMotion);
+
 protected:
     ///
     /// \brief Granny data of the animation.
@@ -56,6 +95,21 @@ protected:
     /// \brief Animation tracks of the animation.
     ///
     vector<Track::SharedPtr> m_tracks;
+
+    ///
+    /// \brief Vector tracks of the animation.
+    ///
+    vector<VectorTrack::SharedPtr> m_vectorTracks;
+
+    ///
+    /// \brief Text tracks of the animation.
+    ///
+    vector<TextTrack::SharedPtr> m_textTracks;
+
+    ///
+    /// \brief Extracted root motion of the animation.
+    ///
+    RootMotion::SharedPtr m_rootMotion;
 };
 
 } // namespace GCL::Bindings
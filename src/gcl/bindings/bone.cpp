@@ -40,6 +40,16 @@ vector<FbxCluster*> Bone::getClusters()
     return m_clusters;
 }
 
+bool Bone::hasWorldTransform()
+{
+    return m_hasWorldTransform;
+}
+
+const Matrix4& Bone::getWorldTransform()
+{
+    return m_worldTransform;
+}
+
 void Bone::setData(GrannyBone data)
 {
     m_data = data;
@@ -60,4 +70,10 @@ void Bone::addCluster(FbxCluster* cluster)
     m_clusters.push_back(cluster);
 }
 
+void Bone::setWorldTransform(const Matrix4& worldTransform)
+{
+    m_worldTransform = worldTransform;
+    m_hasWorldTransform = true;
+}
+
 } // namespace GCL::Bindings
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/vectormath.h"
 
 #include <fbxsdk.h>
 
@@ -10,6 +11,7 @@
 namespace GCL::Bindings {
 
 using namespace std;
+using GCL::Utilities::VectorMath::Matrix4;
 
 ///
 /// \brief Binding of granny bone data and the counterparts fbx node and the fbx skeleton.
@@ -64,6 +66,18 @@ public:
     ///
     vector<FbxCluster*> getClusters();
 
+    ///
+    /// \brief Returns whether the world transform of the bone was computed.
+    /// \return True if the world transform is set.
+    ///
+    bool hasWorldTransform();
+
+    ///
+    /// \brief Returns the world transform of the bone in the rest pose.
+    /// \return World transform
+    ///
+    const Matrix4& getWorldTransform();
+
     ///
     /// \brief Sets the granny bone data.
     /// \param data
@@ -88,6 +102,12 @@ public:
     ///
     void addCluster(FbxCluster* cluster);
 
+    ///
+    /// \brief Sets the world transform of the bone in the rest pose.
+    /// \param worldTransform
+    ///
+    void setWorldTransform(const Matrix4& worldTransform);
+
 protected:
     ///
     /// \brief Granny data of the bone.
@@ -108,6 +128,16 @@ protected:
     /// \brief Fbx clusters of the bone.
     ///
     vector<FbxCluster*> m_clusters;
+
+    ///
+    /// \brief World transform of the bone in the rest pose.
+    ///
+    Matrix4 m_worldTransform = GCL::Utilities::VectorMath::identity();
+
+    ///
+    /// \brief Whether the world transform was computed.
+    ///
+    bool m_hasWorldTransform = false;
 };
 
 } // namespace GCL::Bindings
@@ -12,6 +12,16 @@ namespace GCL::Bindings {
 		return m_data;
 	}
 
+	string Mesh::getName()
+	{
+		return m_name.empty() ? string(m_data->Name) : m_name;
+	}
+
+	void Mesh::setName(string name)
+	{
+		m_name = name;
+	}
+
 	FbxNode* Mesh::getNode()
 	{
 		return m_node;
@@ -25,6 +35,8 @@ namespace GCL::Bindings {
 	void Mesh::setData(GrannyMesh* data)
 	{
 		m_data = data;
+		m_hasMaterialGroups = false;
+		m_materialGroups.clear();
 	}
 
 	void Mesh::setNode(FbxNode* node)
@@ -37,6 +49,16 @@ namespace GCL::Bindings {
 		m_boneBindings.push_back(binding);
 	}
 
+	vector<MorphTarget::SharedPtr> Mesh::getMorphTargets()
+	{
+		return m_morphTargets;
+	}
+
+	void Mesh::addMorphTarget(MorphTarget::SharedPtr morphTarget)
+	{
+		m_morphTargets.push_back(morphTarget);
+	}
+
 	bool Mesh::isRigid()
 	{
 		return GrannyMeshIsRigid(m_data);
@@ -44,20 +66,146 @@ namespace GCL::Bindings {
 
 	vector<GrannyPWNT34322Vertex> Mesh::getRigidVertices()
 	{
-		unsigned grannyVertexCount = static_cast<unsigned>(GrannyGetMeshVertexCount(m_data));
-		GrannyPWNT34322Vertex* grannyVertices = new GrannyPWNT34322Vertex[grannyVertexCount];
+		if (m_hasGeometry) {
+			return m_vertices;
+		}
 
-		vector<GrannyPWNT34322Vertex> rigidVertices;
-		rigidVertices.reserve(grannyVertexCount);
+		const auto grannyVertexCount = static_cast<size_t>(GrannyGetMeshVertexCount(m_data));
 
-		GrannyCopyMeshVertices(m_data, HaloVertexType, grannyVertices);
+		vector<GrannyPWNT34322Vertex> rigidVertices(grannyVertexCount);
+		GrannyCopyMeshVertices(m_data, HaloVertexType, rigidVertices.data());
 
-		for (unsigned i = 0; i < grannyVertexCount; i++) {
-			rigidVertices.push_back(grannyVertices[i]);
+		// Convert the decoded vertices in place, while they are still in cache.
+		if (!m_basisConversion.isIdentity && grannyVertexCount > 0) {
+			GCL::Utilities::BasisConversion::transformPoints(m_basisConversion, rigidVertices[0].Position, grannyVertexCount, sizeof(GrannyPWNT34322Vertex));
+			GCL::Utilities::BasisConversion::transformDirections(m_basisConversion, rigidVertices[0].Normal, grannyVertexCount, sizeof(GrannyPWNT34322Vertex));
 		}
 
-		delete[] grannyVertices;
-
 		return rigidVertices;
 	}
+
+	vector<unsigned> Mesh::getIndices()
+	{
+		if (m_hasGeometry) {
+			return m_indices;
+		}
+
+		vector<unsigned> indices(static_cast<size_t>(GrannyGetMeshIndexCount(m_data)));
+		GrannyCopyMeshIndices(m_data, sizeof(unsigned), indices.data());
+
+		// A mirroring conversion turns the triangles inside out unless their winding flips too.
+		if (m_basisConversion.isMirrored) {
+			for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+				swap(indices[i + 1], indices[i + 2]);
+			}
+		}
+
+		return indices;
+	}
+
+	void Mesh::setGeometry(vector<GrannyPWNT34322Vertex> vertices, vector<unsigned> indices)
+	{
+		m_vertices = move(vertices);
+		m_indices = move(indices);
+		m_hasGeometry = true;
+		m_positionRemap.clear();
+		m_tangents.clear();
+	}
+
+	void Mesh::loadGeometry()
+	{
+		if (m_hasGeometry) {
+			return;
+		}
+
+		m_vertices = getRigidVertices();
+		m_indices = getIndices();
+		m_hasGeometry = true;
+	}
+
+	const vector<GrannyPWNT34322Vertex>& Mesh::getGeometryVertices() const
+	{
+		return m_vertices;
+	}
+
+	const vector<unsigned>& Mesh::getGeometryIndices() const
+	{
+		return m_indices;
+	}
+
+	void Mesh::setBasisConversion(const GCL::Utilities::BasisConversion::Conversion& basisConversion)
+	{
+		m_basisConversion = basisConversion;
+	}
+
+	const vector<unsigned>& Mesh::getPositionRemap()
+	{
+		return m_positionRemap;
+	}
+
+	void Mesh::setPositionRemap(vector<unsigned> positionRemap)
+	{
+		m_positionRemap = move(positionRemap);
+	}
+
+	const vector<float>& Mesh::getTangents()
+	{
+		return m_tangents;
+	}
+
+	void Mesh::setTangents(vector<float> tangents)
+	{
+		m_tangents = move(tangents);
+	}
+
+	const vector<GrannyTriMaterialGroup>& Mesh::getMaterialGroups()
+	{
+		// Copy the groups of the granny mesh once, they are looked up for each triangle.
+		if (!m_hasMaterialGroups) {
+			const auto topology = m_data->PrimaryTopology;
+			if (topology && topology->Groups) {
+				m_materialGroups.assign(topology->Groups, topology->Groups + topology->GroupCount);
+			}
+
+			m_hasMaterialGroups = true;
+		}
+
+		return m_materialGroups;
+	}
+
+	void Mesh::setMaterialGroups(vector<GrannyTriMaterialGroup> materialGroups)
+	{
+		m_materialGroups = move(materialGroups);
+		m_hasMaterialGroups = true;
+	}
+
+	vector<Mesh::SharedPtr> Mesh::getLodMeshes()
+	{
+		return m_lodMeshes;
+	}
+
+	void Mesh::addLodMesh(Mesh::SharedPtr lodMesh)
+	{
+		m_lodMeshes.push_back(lodMesh);
+	}
+
+	const vector<unsigned>& Mesh::getBonePalette()
+	{
+		return m_bonePalette;
+	}
+
+	void Mesh::setBonePalette(vector<unsigned> bonePalette)
+	{
+		m_bonePalette = move(bonePalette);
+	}
+
+	vector<Mesh::SharedPtr> Mesh::getPartitions()
+	{
+		return m_partitions;
+	}
+
+	void Mesh::addPartition(Mesh::SharedPtr partition)
+	{
+		m_partitions.push_back(partition);
+	}
 } // namespace GCL::Bindings
\ No newline at end of file
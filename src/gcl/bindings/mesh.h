@@ -2,11 +2,14 @@
 
 #include "gcl/bindings/binding.h"
 #include "gcl/bindings/bonebinding.h"
+#include "gcl/bindings/morphtarget.h"
 #include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/basisconversion.h"
 
 #include <fbxsdk.h>
 
 #include <Windows.h>
+#include <string>
 #include <vector>
 
 namespace GCL::Bindings {
@@ -30,6 +33,21 @@ public:
     ///
     GrannyMesh* getData();
 
+    ///
+    /// \brief Returns the name of the mesh.
+    ///
+    /// Returns the name set by setName if any, otherwise the name of the granny mesh.
+    ///
+    /// \return Mesh name
+    ///
+    string getName();
+
+    ///
+    /// \brief Sets the name of the mesh, e.g. of a partition of a granny mesh.
+    /// \param name Mesh name
+    ///
+    void setName(string name);
+
     ///
     /// \brief Returns the fbx node of the mesh.
     /// \return Fbx mesh node
@@ -60,6 +78,18 @@ public:
     ///
     void addBoneBinding(BoneBinding::SharedPtr binding);
 
+    ///
+    /// \brief Returns the morph targets of the mesh.
+    /// \return Morph targets
+    ///
+    vector<MorphTarget::SharedPtr> getMorphTargets();
+
+    ///
+    /// \brief Add morph target to the mesh.
+    /// \param morphTarget Morph target
+    ///
+    void addMorphTarget(MorphTarget::SharedPtr morphTarget);
+
     ///
     /// \brief Returns if mesh is rigid body.
     /// \return
@@ -68,10 +98,149 @@ public:
 
     ///
     /// \brief Returns rigid vertices.
+    ///
+    /// Returns the vertices set by setGeometry if any, otherwise the vertices of the granny mesh,
+    /// converted by the basis conversion while they are decoded.
+    ///
     /// \return Vertices
     ///
     vector<GrannyPWNT34322Vertex> getRigidVertices();
 
+    ///
+    /// \brief Returns the triangle list indices.
+    ///
+    /// Returns the indices set by setGeometry if any, otherwise the indices of the granny mesh,
+    /// with the winding flipped if the basis conversion mirrors.
+    ///
+    /// \return Indices
+    ///
+    vector<unsigned> getIndices();
+
+    ///
+    /// \brief Replaces the vertices and indices of the granny mesh, e.g. by optimized ones.
+    ///
+    /// Triangles have to stay within the ranges of their material groups. The position remap
+    /// and the tangents get cleared, since they are only valid for the vertices they were built for.
+    ///
+    /// \param vertices Vertices
+    /// \param indices Triangle list indices
+    ///
+    void setGeometry(vector<GrannyPWNT34322Vertex> vertices, vector<unsigned> indices);
+
+    ///
+    /// \brief Decodes the vertices and indices of the granny mesh into the geometry, unless it is set already.
+    ///
+    /// Later passes get the decoded geometry instead of decoding the granny mesh again.
+    /// The position remap and the tangents stay valid, since the vertices do not change.
+    ///
+    void loadGeometry();
+
+    ///
+    /// \brief Returns the vertices set by setGeometry or loadGeometry without copying them.
+    /// \return Vertices, empty if no geometry is set.
+    ///
+    const vector<GrannyPWNT34322Vertex>& getGeometryVertices() const;
+
+    ///
+    /// \brief Returns the indices set by setGeometry or loadGeometry without copying them.
+    /// \return Triangle list indices, empty if no geometry is set.
+    ///
+    const vector<unsigned>& getGeometryIndices() const;
+
+    ///
+    /// \brief Sets the conversion of the basis of the granny file applied to the granny vertices and indices.
+    /// \param basisConversion Basis conversion
+    ///
+    void setBasisConversion(const GCL::Utilities::BasisConversion::Conversion& basisConversion);
+
+    ///
+    /// \brief Returns the representative vertex of the position of each vertex.
+    ///
+    /// Vertices with the same representative share their position, e.g. at uv seams.
+    /// Empty if no geometry pass provided it, e.g. from the vertex to vertex map of the topology.
+    ///
+    /// \return Position remap
+    ///
+    const vector<unsigned>& getPositionRemap();
+
+    ///
+    /// \brief Sets the representative vertex of the position of each vertex.
+    /// \param positionRemap Position remap
+    ///
+    void setPositionRemap(vector<unsigned> positionRemap);
+
+    ///
+    /// \brief Returns the tangents of the triangle corners, four floats per index.
+    ///
+    /// Each tangent is followed by the sign of the bitangent, i.e. the bitangent is the cross
+    /// product of normal and tangent times the sign. Empty if no tangents got generated.
+    ///
+    /// \return Tangents
+    ///
+    const vector<float>& getTangents();
+
+    ///
+    /// \brief Sets the tangents of the triangle corners.
+    /// \param tangents Tangents and bitangent signs
+    ///
+    void setTangents(vector<float> tangents);
+
+    ///
+    /// \brief Returns the material groups of the triangles.
+    ///
+    /// Returns the groups set by setMaterialGroups if any, otherwise the groups of the granny mesh.
+    ///
+    /// \return Material groups
+    ///
+    const vector<GrannyTriMaterialGroup>& getMaterialGroups();
+
+    ///
+    /// \brief Replaces the material groups of the granny mesh, e.g. for a simplified geometry.
+    /// \param materialGroups Material groups
+    ///
+    void setMaterialGroups(vector<GrannyTriMaterialGroup> materialGroups);
+
+    ///
+    /// \brief Returns the simplified levels of detail of the mesh, ordered from fine to coarse.
+    /// \return Level of detail meshes
+    ///
+    vector<Mesh::SharedPtr> getLodMeshes();
+
+    ///
+    /// \brief Add simplified level of detail to the mesh.
+    /// \param lodMesh Level of detail mesh
+    ///
+    void addLodMesh(Mesh::SharedPtr lodMesh);
+
+    ///
+    /// \brief Returns the bone palette of the mesh.
+    ///
+    /// The bone indices of the vertices index the palette, which holds indices of the bone
+    /// bindings of the granny mesh. An empty palette means the bone indices of the vertices
+    /// index the bone bindings directly.
+    ///
+    /// \return Bone binding indices
+    ///
+    const vector<unsigned>& getBonePalette();
+
+    ///
+    /// \brief Sets the bone palette of the mesh.
+    /// \param bonePalette Bone binding indices
+    ///
+    void setBonePalette(vector<unsigned> bonePalette);
+
+    ///
+    /// \brief Returns the partitions the mesh is exported as, each skinned by a bone palette.
+    /// \return Partition meshes
+    ///
+    vector<Mesh::SharedPtr> getPartitions();
+
+    ///
+    /// \brief Add a partition of the mesh.
+    /// \param partition Partition mesh
+    ///
+    void addPartition(Mesh::SharedPtr partition);
+
 protected:
     ///
     /// \brief Granny data of the mesh.
@@ -87,6 +256,71 @@ protected:
     /// \brief Bone bindings of the mesh.
     ///
     vector<BoneBinding::SharedPtr> m_boneBindings;
+
+    ///
+    /// \brief Morph targets of the mesh.
+    ///
+    vector<MorphTarget::SharedPtr> m_morphTargets;
+
+    ///
+    /// \brief Vertices replacing the vertices of the granny mesh.
+    ///
+    vector<GrannyPWNT34322Vertex> m_vertices;
+
+    ///
+    /// \brief Indices replacing the indices of the granny mesh.
+    ///
+    vector<unsigned> m_indices;
+
+    ///
+    /// \brief Flag whether the geometry of the granny mesh is replaced.
+    ///
+    bool m_hasGeometry = false;
+
+    ///
+    /// \brief Conversion of the basis of the granny file.
+    ///
+    GCL::Utilities::BasisConversion::Conversion m_basisConversion;
+
+    ///
+    /// \brief Representative vertex of the position of each vertex.
+    ///
+    vector<unsigned> m_positionRemap;
+
+    ///
+    /// \brief Tangent and bitangent sign of each triangle corner, in index order.
+    ///
+    vector<float> m_tangents;
+
+    ///
+    /// \brief Material groups replacing the material groups of the granny mesh.
+    ///
+    vector<GrannyTriMaterialGroup> m_materialGroups;
+
+    ///
+    /// \brief Flag whether the material groups are set or copied from the granny mesh.
+    ///
+    bool m_hasMaterialGroups = false;
+
+    ///
+    /// \brief Simplified levels of detail of the mesh.
+    ///
+    vector<Mesh::SharedPtr> m_lodMeshes;
+
+    ///
+    /// \brief Name replacing the name of the granny mesh.
+    ///
+    string m_name;
+
+    ///
+    /// \brief Bone binding indices referenced by the bone indices of the vertices.
+    ///
+    vector<unsigned> m_bonePalette;
+
+    ///
+    /// \brief Partitions of the mesh.
+    ///
+    vector<Mesh::SharedPtr> m_partitions;
 };
 
 } // namespace GCL::Bindings
@@ -19,7 +19,16 @@ vector<Mesh::SharedPtr> Model::getMeshes()
 
 vector<Bone::SharedPtr> Model::getBones()
 {
-    return m_bones;
+    if (!m_skeleton) {
+        return vector<Bone::SharedPtr>();
+    }
+
+    return m_skeleton->getBones();
+}
+
+Skeleton::SharedPtr Model::getSkeleton()
+{
+    return m_skeleton;
 }
 
 void Model::setMeshes(vector<Mesh::SharedPtr> meshes)
@@ -27,9 +36,9 @@ void Model::setMeshes(vector<Mesh::SharedPtr> meshes)
     m_meshes.swap(meshes);
 }
 
-void Model::setBones(vector<Bone::SharedPtr> bones)
+void Model::setSkeleton(Skeleton::SharedPtr skeleton)
 {
-    m_bones = bones;
+    m_skeleton = skeleton;
 }
 
 bool Model::hasRigidMeshes()
@@ -43,7 +52,7 @@ bool Model::hasRigidMeshes()
     return false;
 }
 
-void Model::setTransform(FbxMatrix transform)
+void Model::setTransform(const Matrix4& transform)
 {
     m_transform = transform;
 }
@@ -3,7 +3,9 @@
 #include "gcl/bindings/binding.h"
 #include "gcl/bindings/bone.h"
 #include "gcl/bindings/mesh.h"
+#include "gcl/bindings/skeleton.h"
 #include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/vectormath.h"
 
 #include <fbxsdk.h>
 
@@ -42,6 +44,12 @@ public:
     ///
     vector<Bone::SharedPtr> getBones();
 
+    ///
+    /// \brief Returns the skeleton of the model.
+    /// \return Model skeleton, might be shared with other models of the scene.
+    ///
+    Skeleton::SharedPtr getSkeleton();
+
     ///
     /// \brief Append meshes to the scene.
     /// \param Meshes
@@ -49,10 +57,10 @@ public:
     void setMeshes(vector<Mesh::SharedPtr> meshes);
 
     ///
-    /// \brief Append bones to the scene.
-    /// \param Model bones
+    /// \brief Set the skeleton of the model.
+    /// \param Model skeleton
     ///
-    void setBones(vector<Bone::SharedPtr> bones);
+    void setSkeleton(Skeleton::SharedPtr skeleton);
 
     ///
     /// \brief Returns if model has rigid body meshes.
@@ -64,7 +72,7 @@ public:
     /// \brief Set transform of the model.
     /// \param Model transform
     ///
-    void setTransform(FbxMatrix transform);
+    void setTransform(const Matrix4& transform);
 
 protected:
     ///
@@ -78,14 +86,14 @@ protected:
     vector<Mesh::SharedPtr> m_meshes;
 
     ///
-    /// \brief Bones of the model.
+    /// \brief Skeleton of the model.
     ///
-    vector<Bone::SharedPtr> m_bones;
+    Skeleton::SharedPtr m_skeleton;
 
     ///
     /// \brief Transform of the model.
     ///
-    FbxMatrix m_transform;
+    Matrix4 m_transform = GCL::Utilities::VectorMath::identity();
 };
 
 } // namespace GCL::Bindings
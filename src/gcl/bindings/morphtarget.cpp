@@ -0,0 +1,59 @@
+#include "gcl/bindings/morphtarget.h"
+
+namespace GCL::Bindings {
+
+MorphTarget::MorphTarget(string name)
+    : m_name(name)
+{
+}
+
+string MorphTarget::getName()
+{
+    return m_name;
+}
+
+void MorphTarget::addDelta(unsigned vertexIndex, const float positionDelta[3], const float normalDelta[3])
+{
+    m_vertexIndices.push_back(vertexIndex);
+    m_positionDeltas.insert(m_positionDeltas.end(), positionDelta, positionDelta + 3);
+    m_normalDeltas.insert(m_normalDeltas.end(), normalDelta, normalDelta + 3);
+}
+
+size_t MorphTarget::getDeltaCount()
+{
+    return m_vertexIndices.size();
+}
+
+const vector<unsigned>& MorphTarget::getVertexIndices()
+{
+    return m_vertexIndices;
+}
+
+const vector<float>& MorphTarget::getPositionDeltas()
+{
+    return m_positionDeltas;
+}
+
+const vector<float>& MorphTarget::getNormalDeltas()
+{
+    return m_normalDeltas;
+}
+
+void MorphTarget::remapVertices(const vector<unsigned>& remap)
+{
+    for (auto& vertexIndex : m_vertexIndices) {
+        vertexIndex = remap[vertexIndex];
+    }
+}
+
+FbxBlendShapeChannel* MorphTarget::getChannel()
+{
+    return m_channel;
+}
+
+void MorphTarget::setChannel(FbxBlendShapeChannel* channel)
+{
+    m_channel = channel;
+}
+
+} // namespace GCL::Bindings
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "gcl/bindings/binding.h"
+
+#include <fbxsdk.h>
+
+#include <string>
+#include <vector>
+
+namespace GCL::Bindings {
+
+using namespace std;
+
+///
+/// \brief Morph target of a mesh stored as sparse deltas to the base mesh.
+///
+/// Only vertices which move are stored. Deltas are stored as flat arrays
+/// with three components per vertex in the order of the vertex indices.
+///
+class MorphTarget : public Binding<MorphTarget> {
+public:
+    ///
+    /// \brief Constructor
+    /// \param name Scalar name of the morph target.
+    ///
+    MorphTarget(string name);
+
+    ///
+    /// \brief Returns the scalar name of the morph target.
+    /// \return Morph target name
+    ///
+    string getName();
+
+    ///
+    /// \brief Adds the delta of a vertex.
+    /// \param vertexIndex Index of the vertex in the base mesh.
+    /// \param positionDelta Position delta of the vertex.
+    /// \param normalDelta Normal delta of the vertex.
+    ///
+    void addDelta(unsigned vertexIndex, const float positionDelta[3], const float normalDelta[3]);
+
+    ///
+    /// \brief Returns the number of moved vertices.
+    /// \return Number of deltas
+    ///
+    size_t getDeltaCount();
+
+    ///
+    /// \brief Returns the indices of the moved vertices.
+    /// \return Vertex indices
+    ///
+    const vector<unsigned>& getVertexIndices();
+
+    ///
+    /// \brief Returns the position deltas, three components per moved vertex.
+    /// \return Position deltas
+    ///
+    const vector<float>& getPositionDeltas();
+
+    ///
+    /// \brief Returns the normal deltas, three components per moved vertex.
+    /// \return Normal deltas
+    ///
+    const vector<float>& getNormalDeltas();
+
+    ///
+    /// \brief Remaps the vertex indices, e.g. after the vertices of the mesh got reordered.
+    /// \param remap New index of each vertex of the mesh.
+    ///
+    void remapVertices(const vector<unsigned>& remap);
+
+    ///
+    /// \brief Returns the fbx blend shape channel of the morph target.
+    /// \return Fbx blend shape channel
+    ///
+    FbxBlendShapeChannel* getChannel();
+
+    ///
+    /// \brief Sets the fbx blend shape channel of the morph target.
+    /// \param channel Fbx blend shape channel
+    ///
+    void setChannel(FbxBlendShapeChannel* channel);
+
+protected:
+    ///
+    /// \brief Scalar name of the morph target.
+    ///
+    string m_name;
+
+    ///
+    /// \brief Indices of the moved vertices.
+    ///
+    vector<unsigned> m_vertexIndices;
+
+    ///
+    /// \brief Position deltas of the moved vertices.
+    ///
+    vector<float> m_positionDeltas;
+
+    ///
+    /// \brief Normal deltas of the moved vertices.
+    ///
+    vector<float> m_normalDeltas;
+
+    ///
+    /// \brief Fbx blend shape channel of the morph target.
+    ///
+    FbxBlendShapeChannel* m_channel = nullptr;
+};
+
+} // namespace GCL::Bindings
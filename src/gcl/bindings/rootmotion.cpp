@@ -0,0 +1,60 @@
+#include "gcl/bindings/rootmotion.h"
+
+namespace GCL::Bindings {
+
+RootMotion::RootMotion(string trackName)
+    : m_trackName(trackName)
+{
+}
+
+string RootMotion::getTrackName()
+{
+    return m_trackName;
+}
+
+void RootMotion::addKey(float time, const Vector3& translation)
+{
+    m_times.push_back(time);
+
+    for (auto axis = 0; axis < 3; axis++) {
+        m_translations[axis].push_back(translation[axis]);
+    }
+}
+
+size_t RootMotion::getKeyCount()
+{
+    return m_times.size();
+}
+
+const vector<float>& RootMotion::getTimes()
+{
+    return m_times;
+}
+
+const vector<float>& RootMotion::getTranslations(int axis)
+{
+    return m_translations[axis];
+}
+
+Vector3 RootMotion::getLoopTranslation()
+{
+    return m_loopTranslation;
+}
+
+void RootMotion::setLoopTranslation(const Vector3& loopTranslation)
+{
+    m_loopTranslation = loopTranslation;
+}
+
+const GrannyPeriodicLoop* RootMotion::getPeriodicLoop()
+{
+    return m_hasPeriodicLoop ? &m_periodicLoop : nullptr;
+}
+
+void RootMotion::setPeriodicLoop(const GrannyPeriodicLoop* periodicLoop)
+{
+    m_hasPeriodicLoop = periodicLoop != nullptr;
+    m_periodicLoop = periodicLoop ? *periodicLoop : GrannyPeriodicLoop {};
+}
+
+} // namespace GCL::Bindings
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/vectormath.h"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GCL::Bindings {
+
+using namespace std;
+using GCL::Utilities::VectorMath::Vector3;
+
+///
+/// \brief Root motion of an animation - the ground plane translation of its root track.
+///
+/// Samples are stored as one array per component, times in seconds and translations
+/// in the space of the track group, i.e. rotated by its initial placement.
+///
+class RootMotion {
+public:
+    ///
+    /// \brief Shared pointer alias
+    ///
+    using SharedPtr = shared_ptr<RootMotion>;
+
+    ///
+    /// \brief Constructor
+    /// \param trackName Name of the track the root motion was extracted from.
+    ///
+    RootMotion(string trackName);
+
+    ///
+    /// \brief Returns the name of the track the root motion was extracted from.
+    /// \return Track name
+    ///
+    string getTrackName();
+
+    ///
+    /// \brief Adds a sample of the root motion.
+    /// \param time Time in seconds.
+    /// \param translation Translation relative to the first sample.
+    ///
+    void addKey(float time, const Vector3& translation);
+
+    ///
+    /// \brief Returns the number of samples.
+    /// \return Number of samples
+    ///
+    size_t getKeyCount();
+
+    ///
+    /// \brief Returns the sample times in seconds.
+    /// \return Sample times
+    ///
+    const vector<float>& getTimes();
+
+    ///
+    /// \brief Returns one component of the sample translations.
+    /// \param axis Component index - 0 for x, 1 for y and 2 for z.
+    /// \return Translations of the component
+    ///
+    const vector<float>& getTranslations(int axis);
+
+    ///
+    /// \brief Returns the translation added by each loop of the animation.
+    /// \return Loop translation
+    ///
+    Vector3 getLoopTranslation();
+
+    ///
+    /// \brief Sets the translation added by each loop of the animation.
+    /// \param loopTranslation Loop translation
+    ///
+    void setLoopTranslation(const Vector3& loopTranslation);
+
+    ///
+    /// \brief Returns the periodic loop of the track group or nullptr if it has none.
+    /// \return Periodic loop
+    ///
+    const GrannyPeriodicLoop* getPeriodicLoop();
+
+    ///
+    /// \brief Sets the periodic loop of the track group.
+    /// \param periodicLoop Periodic loop, copied. Pass nullptr if the track group has none.
+    ///
+    void setPeriodicLoop(const GrannyPeriodicLoop* periodicLoop);
+
+protected:
+    ///
+    /// \brief Name of the track the root motion was extracted from.
+    ///
+    string m_trackName;
+
+    ///
+    /// \brief Sample times in seconds.
+    ///
+    vector<float> m_times;
+
+    ///
+    /// \brief Sample translations per component.
+    ///
+    array<vector<float>, 3> m_translations;
+
+    ///
+    /// \brief Translation added by each loop of the animation.
+    ///
+    Vector3 m_loopTranslation;
+
+    ///
+    /// \brief Periodic loop of the track group.
+    ///
+    GrannyPeriodicLoop m_periodicLoop = {};
+
+    ///
+    /// \brief Flag whether the track group has a periodic loop.
+    ///
+    bool m_hasPeriodicLoop = false;
+};
+
+} // namespace GCL::Bindings
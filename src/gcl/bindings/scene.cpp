@@ -22,6 +22,22 @@ void Scene::addModel(Model::SharedPtr model)
     m_models.push_back(model);
 }
 
+vector<Skeleton::SharedPtr> Scene::getSkeletons(size_t hash)
+{
+    const auto skeletons = m_skeletons.find(hash);
+
+    if (skeletons == m_skeletons.end()) {
+        return vector<Skeleton::SharedPtr>();
+    }
+
+    return skeletons->second;
+}
+
+void Scene::addSkeleton(size_t hash, Skeleton::SharedPtr skeleton)
+{
+    m_skeletons[hash].push_back(skeleton);
+}
+
 vector<Animation::SharedPtr> Scene::getAnimations()
 {
     return m_animations;
@@ -42,6 +58,11 @@ void Scene::addImportedFilePath(string importedFilePath)
     m_importedFilePaths.push_back(importedFilePath);
 }
 
+void Scene::addGrannyFile(shared_ptr<GrannyFile> grannyFile)
+{
+    m_grannyFiles.push_back(grannyFile);
+}
+
 set<string> Scene::getSearchPaths()
 {
     return m_searchPaths;
@@ -52,4 +73,14 @@ void Scene::addSearchPath(string searchPath)
     m_searchPaths.insert(searchPath);
 }
 
+GCL::Utilities::TextureLocator::SharedPtr Scene::getTextureLocator()
+{
+    return m_textureLocator;
+}
+
+void Scene::setTextureLocator(GCL::Utilities::TextureLocator::SharedPtr textureLocator)
+{
+    m_textureLocator = textureLocator;
+}
+
 } // namespace GCL::Bindings
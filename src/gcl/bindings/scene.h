@@ -3,11 +3,14 @@
 #include "gcl/bindings/animation.h"
 #include "gcl/bindings/material.h"
 #include "gcl/bindings/model.h"
+#include "gcl/bindings/skeleton.h"
 #include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/texturelocator.h"
 
 #include <algorithm>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace GCL::Bindings {
@@ -48,6 +51,20 @@ public:
     ///
     void addModel(Model::SharedPtr model);
 
+    ///
+    /// \brief Returns all interned skeletons of the scene with the given structural hash.
+    /// \param hash Structural hash of the skeleton.
+    /// \return Skeletons with the given hash, usually at most one.
+    ///
+    vector<Skeleton::SharedPtr> getSkeletons(size_t hash);
+
+    ///
+    /// \brief Intern a skeleton in the scene so models with an identical skeleton can share it.
+    /// \param hash Structural hash of the skeleton.
+    /// \param skeleton Skeleton to be added to the scene.
+    ///
+    void addSkeleton(size_t hash, Skeleton::SharedPtr skeleton);
+
     ///
     /// \brief Returns all animations of the scene.
     /// \return Animations of the scene.
@@ -72,6 +89,12 @@ public:
     ///
     void addImportedFilePath(string importedFilePath);
 
+    ///
+    /// \brief Keeps a granny file alive as long as the scene, its data is referenced by the bindings.
+    /// \param grannyFile Granny file which is freed with the last owner.
+    ///
+    void addGrannyFile(shared_ptr<GrannyFile> grannyFile);
+
     ///
     /// \brief Returns all search paths of the scene.
     /// \return Search paths to look up for scene relevant files e.g. textures.
@@ -84,6 +107,18 @@ public:
     ///
     void addSearchPath(string searchPath);
 
+    ///
+    /// \brief Returns the texture locator of the scene.
+    /// \return Texture locator which indexes the search paths for textures.
+    ///
+    GCL::Utilities::TextureLocator::SharedPtr getTextureLocator();
+
+    ///
+    /// \brief Sets the texture locator of the scene, e.g. to share its index between scenes.
+    /// \param textureLocator Texture locator
+    ///
+    void setTextureLocator(GCL::Utilities::TextureLocator::SharedPtr textureLocator);
+
 protected:
     ///
     /// \brief Models of the scene.
@@ -95,6 +130,11 @@ protected:
     ///
     vector<Material::SharedPtr> m_materials;
 
+    ///
+    /// \brief Interned skeletons of the scene stored by structural hash.
+    ///
+    unordered_map<size_t, vector<Skeleton::SharedPtr>> m_skeletons;
+
     ///
     /// \brief Animations of the scene.
     ///
@@ -105,10 +145,20 @@ protected:
     ///
     vector<string> m_importedFilePaths;
 
+    ///
+    /// \brief Granny files of the imported file paths.
+    ///
+    vector<shared_ptr<GrannyFile>> m_grannyFiles;
+
     ///
     /// \brief Search paths to look up for scene relevant files e.g. textures.
     ///
     set<string> m_searchPaths;
+
+    ///
+    /// \brief Texture locator which indexes the search paths for textures.
+    ///
+    GCL::Utilities::TextureLocator::SharedPtr m_textureLocator = make_shared<GCL::Utilities::TextureLocator>();
 };
 
 } // namespace GCL::Bindings
@@ -16,6 +16,11 @@ using namespace std;
 ///
 class Skeleton {
 public:
+    ///
+    /// \brief Shared pointer alias
+    ///
+    using SharedPtr = shared_ptr<Skeleton>;
+
     ///
     /// \brief Constructer
     /// \param data Granny data of the skeleton.
@@ -0,0 +1,32 @@
+#include "gcl/bindings/texttrack.h"
+
+#include <algorithm>
+
+namespace GCL::Bindings {
+
+TextTrack::TextTrack(GrannyTextTrack* data)
+    : m_name(data->Name ? data->Name : "")
+{
+    m_entries.reserve(static_cast<size_t>(max(data->EntryCount, 0)));
+
+    for (auto i = 0; i < data->EntryCount; i++) {
+        const auto& entry = data->Entries[i];
+        m_entries.push_back({ entry.TimeStamp, entry.Text ? entry.Text : "" });
+    }
+
+    stable_sort(m_entries.begin(), m_entries.end(), [](const TextTrackEntry& left, const TextTrackEntry& right) {
+        return left.time < right.time;
+    });
+}
+
+string TextTrack::getName()
+{
+    return m_name;
+}
+
+const vector<TextTrackEntry>& TextTrack::getEntries()
+{
+    return m_entries;
+}
+
+} // namespace GCL::Bindings
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GCL::Bindings {
+
+using namespace std;
+
+///
+/// \brief Timed event of a text track.
+///
+struct TextTrackEntry {
+    ///
+    /// \brief Time of the event in seconds.
+    ///
+    float time = 0.0f;
+
+    ///
+    /// \brief Text of the event.
+    ///
+    string text;
+};
+
+///
+/// \brief Text track of an animation - timed events like footsteps or sounds.
+///
+class TextTrack {
+public:
+    ///
+    /// \brief Shared pointer alias
+    ///
+    using SharedPtr = shared_ptr<TextTrack>;
+
+    ///
+    /// \brief Constructor - copies the entries of the granny text track.
+    /// \param data Granny text track data.
+    ///
+    TextTrack(GrannyTextTrack* data);
+
+    ///
+    /// \brief Returns the name of the track.
+    /// \return Track name
+    ///
+    string getName();
+
+    ///
+    /// \brief Returns the events of the track ordered by time.
+    /// \return Events
+    ///
+    const vector<TextTrackEntry>& getEntries();
+
+protected:
+    ///
+    /// \brief Name of the track.
+    ///
+    string m_name;
+
+    ///
+    /// \brief Events of the track.
+    ///
+    vector<TextTrackEntry> m_entries;
+};
+
+} // namespace GCL::Bindings
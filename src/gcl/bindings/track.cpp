@@ -33,11 +33,21 @@ vector<CurveScaleKey> Track::getScaleKeys()
     return m_scaleKeys;
 }
 
+size_t Track::getKeyCount()
+{
+    return m_positionKeys.size() + m_rotationKeys.size() + m_scaleKeys.size();
+}
+
 void Track::addPositionKey(CurvePositionKey key)
 {
     m_positionKeys.push_back(key);
 }
 
+void Track::setPositionKeys(vector<CurvePositionKey> keys)
+{
+    m_positionKeys = move(keys);
+}
+
 void Track::addRotationKey(CurveRotationKey key)
 {
     m_rotationKeys.push_back(key);
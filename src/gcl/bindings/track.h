@@ -60,12 +60,24 @@ public:
     ///
     vector<CurveScaleKey> getScaleKeys();
 
+    ///
+    /// \brief Returns the number of keys of all curves.
+    /// \return Number of keys
+    ///
+    size_t getKeyCount();
+
     ///
     /// \brief Add a key to the position curve.
     /// \param Position curve key
     ///
     void addPositionKey(CurvePositionKey key);
 
+    ///
+    /// \brief Replaces all keys of the position curve.
+    /// \param keys Position curve keys
+    ///
+    void setPositionKeys(vector<CurvePositionKey> keys);
+
     ///
     /// \brief Add a key to the rotation curve.
     /// \param Rotation curve key
@@ -0,0 +1,46 @@
+#include "gcl/bindings/vectortrack.h"
+
+namespace GCL::Bindings {
+
+VectorTrack::VectorTrack(GrannyVectorTrack* data)
+    : m_data(data)
+{
+}
+
+GrannyVectorTrack* VectorTrack::getData()
+{
+    return m_data;
+}
+
+string VectorTrack::getName()
+{
+    return m_data->Name ? m_data->Name : "";
+}
+
+int VectorTrack::getDimension()
+{
+    return m_data->Dimension;
+}
+
+void VectorTrack::addKey(float time, const float* values)
+{
+    m_times.push_back(time);
+    m_values.insert(m_values.end(), values, values + m_data->Dimension);
+}
+
+size_t VectorTrack::getKeyCount()
+{
+    return m_times.size();
+}
+
+const vector<float>& VectorTrack::getTimes()
+{
+    return m_times;
+}
+
+const vector<float>& VectorTrack::getValues()
+{
+    return m_values;
+}
+
+} // namespace GCL::Bindings
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GCL::Bindings {
+
+using namespace std;
+
+///
+/// \brief Sampled vector track of an animation, e.g. morph target weights or material parameters.
+///
+/// Samples are stored as one time array and one value array with dimension values per sample.
+///
+class VectorTrack {
+public:
+    ///
+    /// \brief Shared pointer alias
+    ///
+    using SharedPtr = shared_ptr<VectorTrack>;
+
+    ///
+    /// \brief Constructor
+    /// \param data Granny vector track data.
+    ///
+    VectorTrack(GrannyVectorTrack* data);
+
+    ///
+    /// \brief Returns the granny vector track data.
+    /// \return Granny vector track data
+    ///
+    GrannyVectorTrack* getData();
+
+    ///
+    /// \brief Returns the name of the track.
+    /// \return Track name
+    ///
+    string getName();
+
+    ///
+    /// \brief Returns the number of values per sample.
+    /// \return Dimension
+    ///
+    int getDimension();
+
+    ///
+    /// \brief Adds a sample.
+    /// \param time Time in seconds.
+    /// \param values Values of the sample - dimension values.
+    ///
+    void addKey(float time, const float* values);
+
+    ///
+    /// \brief Returns the number of samples.
+    /// \return Number of samples
+    ///
+    size_t getKeyCount();
+
+    ///
+    /// \brief Returns the sample times in seconds.
+    /// \return Sample times
+    ///
+    const vector<float>& getTimes();
+
+    ///
+    /// \brief Returns the sample values, dimension values per sample.
+    /// \return Sample values
+    ///
+    const vector<float>& getValues();
+
+protected:
+    ///
+    /// \brief Granny data of the vector track.
+    ///
+    GrannyVectorTrack* m_data = nullptr;
+
+    ///
+    /// \brief Sample times in seconds.
+    ///
+    vector<float> m_times;
+
+    ///
+    /// \brief Sample values.
+    ///
+    vector<float> m_values;
+};
+
+} // namespace GCL::Bindings
@@ -1,11 +1,15 @@
 #include "gcl/exporter/fbxexporter.h"
 
 #include "gcl/utilities/fbxsdkcommon.h"
+#include "gcl/utilities/tracing.h"
 
 namespace GCL::Exporter {
 
 using namespace GCL::Utilities;
 
+using ScopedSpan = GCL::Utilities::Tracing::ScopedSpan;
+using ScopedStageTimer = GCL::Utilities::ScopedStageTimer;
+
 FbxExporter::FbxExporter(Scene::SharedPtr scene)
     : m_scene(scene)
 {
@@ -38,10 +42,15 @@ FbxExporter::~FbxExporter()
     delete m_exporterMaterial;
     delete m_exporterSkeleton;
     delete m_exporterAnimation;
+    delete m_exporterBounds;
 }
 
 void FbxExporter::initialize()
 {
+    if (!m_options.traceFilePath.empty()) {
+        Tracing::start(m_options.traceFilePath);
+    }
+
     // Initialize the fbx sdk.
     FbxSdkCommon::InitializeSdkObjects(m_fbxManager, m_fbxScene);
 
@@ -50,43 +59,99 @@ void FbxExporter::initialize()
     FbxAxisSystem::ParseAxisSystem(m_options.convertAxis.c_str(), axisSystem);
     axisSystem.ConvertScene(m_fbxScene);
 
+    // Load the persisted texture search index.
+    if (!m_options.textureIndexFilePath.empty()) {
+        m_scene->getTextureLocator()->loadIndex(m_options.textureIndexFilePath);
+    }
+
     if (!m_exporterModuleFactory) {
         m_exporterModuleFactory = new FbxExporterModuleFactory();
     }
 
     m_exporterMaterial = m_exporterModuleFactory->createExporterModuleMaterial(m_scene, m_fbxScene);
+    m_exporterMaterial->setKeepCompressedTextures(m_options.keepCompressedTextures);
     m_exporterMesh = m_exporterModuleFactory->createExporterModuleMesh(m_scene, m_fbxScene);
+    m_exporterMesh->setOptimizeMeshes(m_options.optimizeMeshes);
+    m_exporterMesh->setWeldTolerance(m_options.weldTolerance);
+    m_exporterMesh->setLodCount(m_options.lodCount);
+    m_exporterMesh->setLodReduction(m_options.lodReduction);
+    m_exporterMesh->setLodTargetError(m_options.lodTargetError);
+    m_exporterMesh->setNormalizeSkinWeights(m_options.normalizeSkinWeights);
+    m_exporterMesh->setMaxBoneInfluences(m_options.maxBoneInfluences);
+    m_exporterMesh->setMinBoneWeight(m_options.minBoneWeight);
+    m_exporterMesh->setBonePaletteSize(m_options.bonePaletteSize);
+    m_exporterMesh->setParentRigidMeshes(m_options.parentRigidMeshes);
+    m_exporterMesh->setGenerateTangents(m_options.generateTangents);
+    m_exporterMesh->setExportCollisionHulls(m_options.exportCollisionHulls);
+    m_exporterMesh->setCollisionHullMaxVertices(m_options.collisionHullMaxVertices);
     m_exporterSkeleton = m_exporterModuleFactory->createExporterModuleSkeleton(m_scene, m_fbxScene);
     m_exporterAnimation = m_exporterModuleFactory->createExporterModuleAnimation(m_scene, m_fbxScene);
+    m_exporterBounds = m_exporterModuleFactory->createExporterModuleBounds(m_scene, m_fbxScene);
 }
 
 void FbxExporter::exportToFile(string outputFilepath)
 {
-    exportModels(outputFilepath);
+    {
+        ScopedSpan span("exportToFile", outputFilepath.c_str());
+        ScopedStageTimer timer(m_statistics, "exportToFile");
+
+        exportModels(outputFilepath);
+
+        {
+            ScopedSpan saveSpan("SaveScene", outputFilepath.c_str());
+            ScopedStageTimer saveTimer(m_statistics, "SaveScene");
+            FbxSdkCommon::SaveScene(m_fbxManager, m_fbxScene, outputFilepath.c_str(), false, false);
+        }
+
+        if (!m_options.boundsFilePath.empty()) {
+            ScopedSpan boundsSpan("exportBounds", m_options.boundsFilePath.c_str());
+            ScopedStageTimer boundsTimer(m_statistics, "exportBounds");
+            m_exporterBounds->exportBounds(m_options.boundsFilePath);
+        }
+
+        // Textures are converted in the background during the export of meshes, animations and the scene.
+        {
+            ScopedSpan textureSpan("waitForTextures");
+            ScopedStageTimer textureTimer(m_statistics, "waitForTextures");
+            m_exporterMaterial->waitForTextures();
+        }
 
-    FbxSdkCommon::SaveScene(m_fbxManager, m_fbxScene, outputFilepath.c_str(), false, false);
+        m_statistics.textureCount = m_exporterMaterial->getWrittenTextureCount();
+        m_statistics.emittedKeyCount = m_exporterAnimation->getExportedKeyCount();
+        m_statistics.weldedVertexCount = m_exporterMesh->getWeldedVertexCount();
+        m_statistics.prunedInfluenceCount = m_exporterMesh->getPrunedInfluenceCount();
+        m_statistics.acmrBefore = m_exporterMesh->getAcmrBefore();
+        m_statistics.acmrAfter = m_exporterMesh->getAcmrAfter();
+        m_statistics.updateMemory();
+
+        // Persist the texture search index for the next run.
+        if (!m_options.textureIndexFilePath.empty()) {
+            m_scene->getTextureLocator()->saveIndex(m_options.textureIndexFilePath);
+        }
+    }
+
+    // Write the trace including the spans of the import.
+    if (!m_options.traceFilePath.empty()) {
+        Tracing::write();
+    }
 }
 
 void FbxExporter::exportModels(string outputFilepath)
 {
     if (m_options.exportMaterials) {
+        ScopedSpan span("exportMaterials");
+        ScopedStageTimer timer(m_statistics, "exportMaterials");
         m_exporterMaterial->exportMaterials(outputFilepath);
     }
 
     for (auto model : m_scene->getModels()) {
-        // Export skeleton if enabled.
-        if (m_options.exportSkeleton && model->getBones().size() > 0) {
-            auto exist = m_fbxScene->GetRootNode()->FindChild(model->getBones()[0]->getData().Name);
-
-            if (!exist) {
-                m_exporterSkeleton->exportBones(model);
-            } else {
-                for (auto otherModel : m_scene->getModels()) {
-                    if (otherModel != model && otherModel->getBones()[0]->getNode() == exist) {
-                        model->setBones(otherModel->getBones());
-                    }
-                }
-            }
+        // Export skeleton if enabled. Skeletons are interned on import,
+        // so a skeleton shared by several models is exported only once.
+        if (m_options.exportSkeleton && model->getBones().size() > 0 && !model->getSkeleton()->getNode()) {
+            ScopedSpan span("exportBones", model->getData()->Name);
+            ScopedStageTimer timer(m_statistics, "exportBones");
+            m_exporterSkeleton->exportBones(model);
+            m_statistics.boneCount += model->getBones().size();
         }
 
         if (model->isExcluded()) {
@@ -94,16 +159,35 @@ void FbxExporter::exportModels(string outputFilepath)
         }
 
         if (m_options.exportMeshes) {
+            ScopedSpan span("exportMeshes", model->getData()->Name);
+            ScopedStageTimer timer(m_statistics, "exportMeshes");
             m_exporterMesh->exportMeshes(model, m_options.exportSkeleton);
+
+            for (const auto& mesh : model->getMeshes()) {
+                m_statistics.vertexCount += GrannyGetMeshVertexCount(mesh->getData());
+                m_statistics.triangleCount += GrannyGetMeshIndexCount(mesh->getData()) / 3;
+            }
         }
 
         if (m_options.exportSkeleton && model->getBones().size() > 1) {
+            ScopedSpan span("exportPoses", model->getData()->Name);
+            ScopedStageTimer timer(m_statistics, "exportPoses");
             m_exporterSkeleton->exportPoses(model);
         }
     }
 
     if (m_options.exportAnimation) {
+        ScopedSpan span("exportAnimations");
+        ScopedStageTimer timer(m_statistics, "exportAnimations");
         m_exporterAnimation->exportAnimations();
+
+        for (const auto& animation : m_scene->getAnimations()) {
+            if (!animation->isExcluded()) {
+                for (const auto& track : animation->getTracks()) {
+                    m_statistics.keyCount += track->getKeyCount();
+                }
+            }
+        }
     }
 }
 
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "gcl/exporter/fbxexporteranimation.h"
+#include "gcl/exporter/fbxexporterbounds.h"
 #include "gcl/exporter/fbxexportermaterial.h"
 #include "gcl/exporter/fbxexportermesh.h"
 #include "gcl/exporter/fbxexportermodulefactory.h"
 #include "gcl/exporter/fbxexporterskeleton.h"
 #include "gcl/exporter/fbxexportoptions.h"
+#include "gcl/utilities/statistics.h"
 
 namespace GCL::Exporter {
 
@@ -78,6 +80,15 @@ public:
         return m_fbxScene;
     }
 
+    ///
+    /// \brief Returns the statistics of all exports of this exporter.
+    /// \return Export statistics
+    ///
+    const GCL::Utilities::ConversionStatistics& getStatistics() const
+    {
+        return m_statistics;
+    }
+
 protected:
     ///
     /// \brief Factory to create exporter modules.
@@ -109,6 +120,11 @@ protected:
     ///
     FbxExporterAnimation* m_exporterAnimation = nullptr;
 
+    ///
+    /// \brief Bounds exporter module.
+    ///
+    FbxExporterBounds* m_exporterBounds = nullptr;
+
     ///
     /// \brief Scene of the importing granny file.
     ///
@@ -123,6 +139,11 @@ protected:
     /// \brief Fbx scene for the export by the fbx sdk.
     ///
     FbxScene* m_fbxScene = nullptr;
+
+    ///
+    /// \brief Statistics of all exports.
+    ///
+    GCL::Utilities::ConversionStatistics m_statistics;
 };
 
 } // namespace GCL::Exporter
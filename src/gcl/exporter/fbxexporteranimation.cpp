@@ -1,14 +1,34 @@
 #include "gcl/exporter/fbxexporteranimation.h"
 
 #include <map>
+#include <sstream>
 #include <vector>
 
 namespace GCL::Exporter {
 
+using GCL::Utilities::FbxSdkCommon;
+
 void FbxExporterAnimation::exportAnimations()
 {
     vector<string> modelNames;
 
+    // Morph targets are animated by vector tracks named like them.
+    map<string, vector<FbxBlendShapeChannel*>> morphTargetChannels;
+    for (const auto& model : m_scene->getModels()) {
+        for (const auto& mesh : model->getMeshes()) {
+            auto meshes = mesh->getPartitions();
+            meshes.push_back(mesh);
+
+            for (const auto& exportedMesh : meshes) {
+                for (const auto& morphTarget : exportedMesh->getMorphTargets()) {
+                    if (morphTarget->getChannel()) {
+                        morphTargetChannels[morphTarget->getName()].push_back(morphTarget->getChannel());
+                    }
+                }
+            }
+        }
+    }
+
     for (auto animation : m_scene->getAnimations()) {
         if (animation->isExcluded()) {
             continue;
@@ -72,6 +92,23 @@ void FbxExporterAnimation::exportAnimations()
                 }
             }
         }
+
+        if (animation->getRootMotion()) {
+            exportRootMotion(animation->getRootMotion(), animStack, animLayer);
+        }
+
+        for (const auto& vectorTrack : animation->getVectorTracks()) {
+            exportVectorTrack(vectorTrack, animLayer);
+
+            const auto channels = morphTargetChannels.find(vectorTrack->getName());
+            if (channels != morphTargetChannels.end() && vectorTrack->getDimension() == 1) {
+                exportMorphTargetWeights(vectorTrack, channels->second, animLayer);
+            }
+        }
+
+        for (const auto& textTrack : animation->getTextTracks()) {
+            exportTextTrack(textTrack, animStack);
+        }
     }
 }
 
@@ -138,7 +175,180 @@ void FbxExporterAnimation::exportCurves(Track::SharedPtr track, FbxNode* boneNod
         resample.Apply(fbxTCurves, 3);
         resample.Apply(fbxRCurves, 3);
         resample.Apply(fbxSCurves, 3);
+
+        for (auto i = 0; i < 3; i++) {
+            m_exportedKeyCount += fbxTCurves[i] ? fbxTCurves[i]->KeyGetCount() : 0;
+            m_exportedKeyCount += fbxRCurves[i] ? fbxRCurves[i]->KeyGetCount() : 0;
+            m_exportedKeyCount += fbxSCurves[i] ? fbxSCurves[i]->KeyGetCount() : 0;
+        }
+    }
+}
+
+void FbxExporterAnimation::exportRootMotion(RootMotion::SharedPtr rootMotion, FbxAnimStack* animStack, FbxAnimLayer* animLayer)
+{
+    if (!m_rootMotionNode) {
+        m_rootMotionNode = FbxNode::Create(m_fbxScene, "RootMotion");
+        m_rootMotionNode->SetNodeAttribute(FbxNull::Create(m_fbxScene, "RootMotion"));
+        m_fbxScene->GetRootNode()->AddChild(m_rootMotionNode);
+    }
+
+    // Root motion is sampled densely, so linear keys reproduce it exactly.
+    const char* components[3] = { FBXSDK_CURVENODE_COMPONENT_X, FBXSDK_CURVENODE_COMPONENT_Y, FBXSDK_CURVENODE_COMPONENT_Z };
+    const auto& times = rootMotion->getTimes();
+
+    for (auto axis = 0; axis < 3; axis++) {
+        auto animCurve = m_rootMotionNode->LclTranslation.GetCurve(animLayer, components[axis], true);
+        const auto& translations = rootMotion->getTranslations(axis);
+
+        animCurve->KeyModifyBegin();
+
+        for (size_t i = 0; i < times.size(); i++) {
+            FbxTime time;
+            time.SetSecondDouble(static_cast<double>(times[i]));
+
+            auto keyIndex = animCurve->KeyAdd(time);
+            animCurve->KeySetValue(keyIndex, translations[i]);
+            animCurve->KeySetInterpolation(keyIndex, FbxAnimCurveDef::eInterpolationLinear);
+        }
+
+        animCurve->KeyModifyEnd();
+
+        m_exportedKeyCount += animCurve->KeyGetCount();
+    }
+
+    auto rootTrackProperty = FbxProperty::Create(animStack, FbxStringDT, "RootMotionTrack");
+    rootTrackProperty.ModifyFlag(FbxPropertyFlags::eUserDefined, true);
+    rootTrackProperty.Set(FbxString(rootMotion->getTrackName().c_str()));
+
+    auto loopTranslationProperty = FbxProperty::Create(animStack, FbxDouble3DT, "LoopTranslation");
+    loopTranslationProperty.ModifyFlag(FbxPropertyFlags::eUserDefined, true);
+    loopTranslationProperty.Set(FbxSdkCommon::toFbxDouble3(rootMotion->getLoopTranslation()));
+
+    const auto periodicLoop = rootMotion->getPeriodicLoop();
+    if (!periodicLoop) {
+        return;
+    }
+
+    const auto addDoubleProperty = [animStack](const char* name, float value) {
+        auto property = FbxProperty::Create(animStack, FbxDoubleDT, name);
+        property.ModifyFlag(FbxPropertyFlags::eUserDefined, true);
+        property.Set(static_cast<FbxDouble>(value));
+    };
+
+    const auto addVectorProperty = [animStack](const char* name, const float value[3]) {
+        auto property = FbxProperty::Create(animStack, FbxDouble3DT, name);
+        property.ModifyFlag(FbxPropertyFlags::eUserDefined, true);
+        property.Set(FbxDouble3(static_cast<double>(value[0]), static_cast<double>(value[1]), static_cast<double>(value[2])));
+    };
+
+    addDoubleProperty("PeriodicLoopRadius", periodicLoop->Radius);
+    addDoubleProperty("PeriodicLoopAngle", periodicLoop->dAngle);
+    addDoubleProperty("PeriodicLoopZ", periodicLoop->dZ);
+    addVectorProperty("PeriodicLoopBasisX", periodicLoop->BasisX);
+    addVectorProperty("PeriodicLoopBasisY", periodicLoop->BasisY);
+    addVectorProperty("PeriodicLoopAxis", periodicLoop->Axis);
+}
+
+void FbxExporterAnimation::exportVectorTrack(VectorTrack::SharedPtr vectorTrack, FbxAnimLayer* animLayer)
+{
+    const auto dimension = vectorTrack->getDimension();
+    if (dimension <= 0 || !vectorTrack->getKeyCount()) {
+        return;
     }
+
+    if (!m_vectorTracksNode) {
+        m_vectorTracksNode = FbxNode::Create(m_fbxScene, "VectorTracks");
+        m_vectorTracksNode->SetNodeAttribute(FbxNull::Create(m_fbxScene, "VectorTracks"));
+        m_fbxScene->GetRootNode()->AddChild(m_vectorTracksNode);
+    }
+
+    const auto& times = vectorTrack->getTimes();
+    const auto& values = vectorTrack->getValues();
+
+    for (auto component = 0; component < dimension; component++) {
+        auto propertyName = vectorTrack->getName();
+        if (dimension > 1) {
+            propertyName += "_" + to_string(component);
+        }
+
+        // Animations share the property, each one animates it on its own layer.
+        auto property = m_vectorTracksNode->FindProperty(propertyName.c_str());
+        if (!property.IsValid()) {
+            property = FbxProperty::Create(m_vectorTracksNode, FbxDoubleDT, propertyName.c_str());
+            property.ModifyFlag(FbxPropertyFlags::eUserDefined, true);
+            property.ModifyFlag(FbxPropertyFlags::eAnimatable, true);
+        }
+
+        auto animCurve = property.GetCurve(animLayer, true);
+        if (!animCurve) {
+            continue;
+        }
+
+        animCurve->KeyModifyBegin();
+
+        for (size_t i = 0; i < times.size(); i++) {
+            FbxTime time;
+            time.SetSecondDouble(static_cast<double>(times[i]));
+
+            auto keyIndex = animCurve->KeyAdd(time);
+            animCurve->KeySetValue(keyIndex, values[i * static_cast<size_t>(dimension) + static_cast<size_t>(component)]);
+            animCurve->KeySetInterpolation(keyIndex, FbxAnimCurveDef::eInterpolationLinear);
+        }
+
+        animCurve->KeyModifyEnd();
+
+        m_exportedKeyCount += animCurve->KeyGetCount();
+    }
+}
+
+void FbxExporterAnimation::exportMorphTargetWeights(
+    VectorTrack::SharedPtr vectorTrack,
+    const vector<FbxBlendShapeChannel*>& channels,
+    FbxAnimLayer* animLayer)
+{
+    const auto& times = vectorTrack->getTimes();
+    const auto& values = vectorTrack->getValues();
+
+    for (auto channel : channels) {
+        auto animCurve = channel->DeformPercent.GetCurve(animLayer, true);
+        if (!animCurve) {
+            continue;
+        }
+
+        animCurve->KeyModifyBegin();
+
+        for (size_t i = 0; i < times.size(); i++) {
+            FbxTime time;
+            time.SetSecondDouble(static_cast<double>(times[i]));
+
+            auto keyIndex = animCurve->KeyAdd(time);
+            animCurve->KeySetValue(keyIndex, values[i] * 100.0f);
+            animCurve->KeySetInterpolation(keyIndex, FbxAnimCurveDef::eInterpolationLinear);
+        }
+
+        animCurve->KeyModifyEnd();
+
+        m_exportedKeyCount += animCurve->KeyGetCount();
+    }
+}
+
+void FbxExporterAnimation::exportTextTrack(TextTrack::SharedPtr textTrack, FbxAnimStack* animStack)
+{
+    ostringstream lines;
+    for (const auto& entry : textTrack->getEntries()) {
+        lines << entry.time << '\t' << entry.text << '\n';
+    }
+
+    const auto propertyName = "TextTrack:" + textTrack->getName();
+
+    auto property = FbxProperty::Create(animStack, FbxStringDT, propertyName.c_str());
+    property.ModifyFlag(FbxPropertyFlags::eUserDefined, true);
+    property.Set(FbxString(lines.str().c_str()));
+}
+
+size_t FbxExporterAnimation::getExportedKeyCount() const
+{
+    return m_exportedKeyCount;
 }
 
 void FbxExporterAnimation::exportCurveKey(
@@ -148,6 +358,7 @@ void FbxExporterAnimation::exportCurveKey(
     FbxAnimCurve* animCurveZ)
 {
     auto keyValue = key.getValue();
+    const auto keyTime = FbxSdkCommon::toFbxTime(key.getTime());
 
     animCurveX->KeyModifyBegin();
     animCurveY->KeyModifyBegin();
@@ -155,19 +366,19 @@ void FbxExporterAnimation::exportCurveKey(
 
     // Set key for x-axis.
 
-    auto keyIndexX = animCurveX->KeyAdd(key.getTime());
+    auto keyIndexX = animCurveX->KeyAdd(keyTime);
     animCurveX->KeySetValue(keyIndexX, static_cast<float>(keyValue[0]));
     animCurveX->KeySetInterpolation(keyIndexX, FbxAnimCurveDef::eInterpolationCubic);
 
     // Set key for y-axis.
 
-    auto keyIndexY = animCurveY->KeyAdd(key.getTime());
+    auto keyIndexY = animCurveY->KeyAdd(keyTime);
     animCurveY->KeySetValue(keyIndexY, static_cast<float>(keyValue[1]));
     animCurveY->KeySetInterpolation(keyIndexY, FbxAnimCurveDef::eInterpolationCubic);
 
     // Set key for z-axis.
 
-    auto keyIndexZ = animCurveZ->KeyAdd(key.getTime());
+    auto keyIndexZ = animCurveZ->KeyAdd(keyTime);
     animCurveZ->KeySetValue(keyIndexZ, static_cast<float>(keyValue[2]));
     animCurveZ->KeySetInterpolation(keyIndexZ, FbxAnimCurveDef::eInterpolationCubic);
 
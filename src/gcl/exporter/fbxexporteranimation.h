@@ -1,8 +1,11 @@
 #pragma once
 
 #include "gcl/bindings/abstractcurvekey.h"
+#include "gcl/bindings/rootmotion.h"
 #include "gcl/bindings/scene.h"
+#include "gcl/bindings/texttrack.h"
 #include "gcl/bindings/track.h"
+#include "gcl/bindings/vectortrack.h"
 #include "gcl/exporter/fbxexportermodule.h"
 #include "gcl/importer/grannyformat.h"
 #include "gcl/utilities/fbxsdkcommon.h"
@@ -35,6 +38,52 @@ public:
     ///
     void exportCurves(Track::SharedPtr track, FbxNode* boneNode, FbxAnimLayer* animLayer);
 
+    ///
+    /// \brief Export the extracted root motion of an animation to the fbx scene.
+    ///
+    /// The root motion animates the translation of a "RootMotion" node shared by all animations.
+    /// Loop translation and periodic loop are added as user properties of the animation stack.
+    ///
+    /// \param rootMotion Root motion of the animation.
+    /// \param animStack Anim stack of the animation.
+    /// \param animLayer Anim layer of the animation.
+    ///
+    void exportRootMotion(RootMotion::SharedPtr rootMotion, FbxAnimStack* animStack, FbxAnimLayer* animLayer);
+
+    ///
+    /// \brief Export a vector track of an animation to the fbx scene.
+    ///
+    /// Each component animates a user property of a "VectorTracks" node shared by all animations.
+    /// The property is named like the track, suffixed with "_<component>" if the track has more
+    /// than one component.
+    ///
+    /// \param vectorTrack Vector track of the animation.
+    /// \param animLayer Anim layer of the animation.
+    ///
+    void exportVectorTrack(VectorTrack::SharedPtr vectorTrack, FbxAnimLayer* animLayer);
+
+    ///
+    /// \brief Export a vector track as weight of the blend shape channels named like the track.
+    ///
+    /// Granny morph target weights range from 0 to 1, fbx deform percents from 0 to 100.
+    ///
+    /// \param vectorTrack Vector track of the animation with one component.
+    /// \param channels Blend shape channels of the morph targets named like the track.
+    /// \param animLayer Anim layer of the animation.
+    ///
+    void exportMorphTargetWeights(VectorTrack::SharedPtr vectorTrack, const vector<FbxBlendShapeChannel*>& channels, FbxAnimLayer* animLayer);
+
+    ///
+    /// \brief Export a text track of an animation to the fbx scene.
+    ///
+    /// The entries are added as string user property "TextTrack:<name>" of the animation stack,
+    /// one "<time>\t<text>" line per entry.
+    ///
+    /// \param textTrack Text track of the animation.
+    /// \param animStack Anim stack of the animation.
+    ///
+    void exportTextTrack(TextTrack::SharedPtr textTrack, FbxAnimStack* animStack);
+
     ///
     /// \brief Export an curve key to the fbx scene.
     /// \param key Curve key of a track at a specific time of the animation.
@@ -47,6 +96,28 @@ public:
         FbxAnimCurve* animCurveX,
         FbxAnimCurve* animCurveY,
         FbxAnimCurve* animCurveZ);
+
+    ///
+    /// \brief Returns the number of keys written to the fbx scene after resampling.
+    /// \return Number of keys of all exported curves.
+    ///
+    size_t getExportedKeyCount() const;
+
+protected:
+    ///
+    /// \brief Number of keys of all exported curves.
+    ///
+    size_t m_exportedKeyCount = 0;
+
+    ///
+    /// \brief Node animated by the root motion of all animations.
+    ///
+    FbxNode* m_rootMotionNode = nullptr;
+
+    ///
+    /// \brief Node holding the animated properties of the vector tracks of all animations.
+    ///
+    FbxNode* m_vectorTracksNode = nullptr;
 };
 
 } // namespace GCL::Exporter
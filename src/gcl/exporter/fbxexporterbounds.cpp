@@ -0,0 +1,350 @@
+#include "gcl/exporter/fbxexporterbounds.h"
+
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/poseengine.h"
+#include "gcl/utilities/stringutility.h"
+#include "gcl/utilities/vectormath.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace GCL::Exporter {
+
+using namespace GCL::Utilities::Logging;
+namespace VectorMath = GCL::Utilities::VectorMath;
+
+namespace {
+
+///
+/// \brief Keys of a curve, sampled in order of time.
+///
+struct CurveSampler {
+    vector<double> times;
+    vector<array<double, 3>> values;
+    size_t cursor = 0;
+
+    ///
+    /// \brief Samples the curve at a time, linearly interpolated between keys like the fbx curves.
+    ///
+    /// Times have to increase between calls, so each key is passed once.
+    ///
+    /// \return False if the curve has no keys.
+    ///
+    bool sample(double time, double value[3])
+    {
+        if (times.empty()) {
+            return false;
+        }
+
+        while (cursor + 1 < times.size() && times[cursor + 1] <= time) {
+            cursor++;
+        }
+
+        const auto next = min(cursor + 1, times.size() - 1);
+        const auto span = times[next] - times[cursor];
+        const auto weight = span > 0.0 ? clamp((time - times[cursor]) / span, 0.0, 1.0) : 0.0;
+
+        for (auto axis = 0; axis < 3; axis++) {
+            value[axis] = values[cursor][axis] + (values[next][axis] - values[cursor][axis]) * weight;
+        }
+
+        return true;
+    }
+};
+
+///
+/// \brief Copies the times and values of curve keys.
+///
+template <typename Key>
+CurveSampler createSampler(vector<Key> keys)
+{
+    CurveSampler sampler;
+    sampler.times.reserve(keys.size());
+    sampler.values.reserve(keys.size());
+
+    for (auto& key : keys) {
+        const auto value = key.getValue();
+        sampler.times.push_back(key.getTime());
+        sampler.values.push_back({ value[0], value[1], value[2] });
+    }
+
+    return sampler;
+}
+
+///
+/// \brief Samplers of the curves of an animation track.
+///
+struct TrackSampler {
+    CurveSampler position;
+    CurveSampler rotation;
+    CurveSampler scale;
+};
+
+} // namespace
+
+void FbxExporterBounds::exportBounds(const string& filePath)
+{
+    ofstream file(filesystem::u8path(filePath));
+    if (!file) {
+        warning("Failed to write bounds file \"%s\".", filePath.c_str());
+        return;
+    }
+
+    file.precision(9);
+    file << "{\"models\":[";
+
+    auto isFirst = true;
+    for (const auto& model : m_scene->getModels()) {
+        if (model->isExcluded()) {
+            continue;
+        }
+
+        file << (isFirst ? "\n" : ",\n");
+        writeModelBounds(model, file);
+        isFirst = false;
+    }
+
+    file << "\n],\"animations\":[";
+
+    isFirst = true;
+    for (const auto& animation : m_scene->getAnimations()) {
+        if (animation->isExcluded()) {
+            continue;
+        }
+
+        file << (isFirst ? "\n" : ",\n")
+             << "{\"name\":\"" << escapeJson(animation->getData()->Name)
+             << "\",\"duration\":" << animation->getData()->Duration
+             << ",\"models\":[";
+
+        auto isFirstModel = true;
+        for (const auto& model : m_scene->getModels()) {
+            if (model->isExcluded()) {
+                continue;
+            }
+
+            const auto box = computeAnimationBounds(animation, model);
+            if (box.isEmpty()) {
+                continue;
+            }
+
+            file << (isFirstModel ? "" : ",") << "{\"name\":\"" << escapeJson(model->getData()->Name) << "\",";
+            writeBounds(box, nullptr, file);
+            file << "}";
+            isFirstModel = false;
+        }
+
+        file << "]}";
+        isFirst = false;
+    }
+
+    file << "\n]}\n";
+
+    debug("Wrote bounds to \"%s\".", filePath.c_str());
+}
+
+void FbxExporterBounds::writeModelBounds(Model::SharedPtr model, ostream& stream)
+{
+    vector<Mesh::SharedPtr> meshes;
+    vector<vector<GrannyPWNT34322Vertex>> meshVertices;
+    vector<Bounds::Box> meshBoxes;
+    Bounds::Box modelBox;
+
+    for (const auto& mesh : model->getMeshes()) {
+        if (mesh->isExcluded()) {
+            continue;
+        }
+
+        meshes.push_back(mesh);
+        meshVertices.push_back(mesh->getRigidVertices());
+
+        const auto& vertices = meshVertices.back();
+        meshBoxes.push_back(vertices.empty() ? Bounds::Box() : Bounds::computeBox(vertices.front().Position, vertices.size(), sizeof(GrannyPWNT34322Vertex)));
+        Bounds::merge(modelBox, meshBoxes.back());
+    }
+
+    // The sphere of the model is centered on its box, so it contains the vertices of all meshes.
+    Bounds::Sphere modelSphere;
+    Bounds::getCenter(modelBox, modelSphere.center);
+
+    for (const auto& vertices : meshVertices) {
+        if (!vertices.empty()) {
+            modelSphere.radius = max(modelSphere.radius, Bounds::computeRadius(vertices.front().Position, vertices.size(), sizeof(GrannyPWNT34322Vertex), modelSphere.center));
+        }
+    }
+
+    stream << "{\"name\":\"" << escapeJson(model->getData()->Name) << "\",";
+    writeBounds(modelBox, &modelSphere, stream);
+    stream << ",\"meshes\":[";
+
+    for (size_t i = 0; i < meshes.size(); i++) {
+        const auto& vertices = meshVertices[i];
+
+        Bounds::Sphere meshSphere;
+        Bounds::getCenter(meshBoxes[i], meshSphere.center);
+        if (!vertices.empty()) {
+            meshSphere.radius = Bounds::computeRadius(vertices.front().Position, vertices.size(), sizeof(GrannyPWNT34322Vertex), meshSphere.center);
+        }
+
+        stream << (i == 0 ? "" : ",") << "{\"name\":\"" << escapeJson(meshes[i]->getName()) << "\",";
+        writeBounds(meshBoxes[i], &meshSphere, stream);
+        stream << "}";
+    }
+
+    stream << "]}";
+}
+
+Bounds::Box FbxExporterBounds::computeAnimationBounds(Animation::SharedPtr animation, Model::SharedPtr model)
+{
+    const auto bones = model->getBones();
+    if (bones.empty()) {
+        return Bounds::Box();
+    }
+
+    vector<GrannyBone> grannyBones;
+    map<string, size_t> boneIndices;
+    for (size_t boneIndex = 0; boneIndex < bones.size(); boneIndex++) {
+        grannyBones.push_back(bones[boneIndex]->getData());
+        boneIndices[grannyBones.back().Name] = boneIndex;
+    }
+
+    // Bounding boxes of the vertices bound to each bone, in the space of the bone.
+    vector<Bounds::Box> boneBoxes(bones.size());
+    vector<size_t> boundBones;
+
+    for (const auto& mesh : model->getMeshes()) {
+        if (mesh->isExcluded()) {
+            continue;
+        }
+
+        const auto grannyMesh = mesh->getData();
+        for (auto bindingIndex = 0; bindingIndex < grannyMesh->BoneBindingCount; bindingIndex++) {
+            const auto& boneBinding = grannyMesh->BoneBindings[bindingIndex];
+            const auto boneIndex = boneIndices.find(boneBinding.BoneName);
+            if (boneIndex == boneIndices.end()) {
+                continue;
+            }
+
+            Bounds::Box box;
+            copy(boneBinding.OBBMin, boneBinding.OBBMin + 3, box.min);
+            copy(boneBinding.OBBMax, boneBinding.OBBMax + 3, box.max);
+            if (box.isEmpty()) {
+                continue;
+            }
+
+            if (boneBoxes[boneIndex->second].isEmpty()) {
+                boundBones.push_back(boneIndex->second);
+            }
+
+            Bounds::merge(boneBoxes[boneIndex->second], box);
+        }
+    }
+
+    vector<TrackSampler> trackSamplers(bones.size());
+    vector<bool> isAnimated(bones.size(), false);
+    auto hasTracks = false;
+
+    for (const auto& track : animation->getTracks()) {
+        const auto boneIndex = boneIndices.find(track->getName());
+        if (boneIndex == boneIndices.end()) {
+            continue;
+        }
+
+        auto& trackSampler = trackSamplers[boneIndex->second];
+        trackSampler.position = createSampler(track->getPositionKeys());
+        trackSampler.rotation = createSampler(track->getRotationKeys());
+        trackSampler.scale = createSampler(track->getScaleKeys());
+        isAnimated[boneIndex->second] = true;
+        hasTracks = true;
+    }
+
+    if (!hasTracks || boundBones.empty()) {
+        return Bounds::Box();
+    }
+
+    PoseEngine poseEngine(grannyBones.data(), grannyBones.size(), &model->getData()->InitialPlacement);
+    vector<GrannyTransform> localTransforms;
+    for (const auto& grannyBone : grannyBones) {
+        localTransforms.push_back(grannyBone.LocalTransform);
+    }
+
+    // Sample the poses at the rate the curves got sampled at on import.
+    const auto duration = static_cast<double>(max(animation->getData()->Duration, 0.0f));
+    const auto timeStep = animation->getData()->TimeStep > 0.0f ? static_cast<double>(animation->getData()->TimeStep) : 1.0 / 30.0;
+    const auto frameCount = static_cast<size_t>(ceil(duration / timeStep)) + 1;
+
+    Bounds::Box animationBox;
+
+    for (size_t frame = 0; frame < frameCount; frame++) {
+        const auto time = min(static_cast<double>(frame) * timeStep, duration);
+
+        for (size_t boneIndex = 0; boneIndex < bones.size(); boneIndex++) {
+            if (!isAnimated[boneIndex]) {
+                continue;
+            }
+
+            auto& trackSampler = trackSamplers[boneIndex];
+            auto& transform = localTransforms[boneIndex];
+            double value[3];
+
+            if (trackSampler.position.sample(time, value)) {
+                transform.Flags |= GrannyTransformFlags::GrannyHasPosition;
+                for (auto axis = 0; axis < 3; axis++) {
+                    transform.Position[axis] = static_cast<float>(value[axis]);
+                }
+            }
+
+            if (trackSampler.rotation.sample(time, value)) {
+                transform.Flags |= GrannyTransformFlags::GrannyHasOrientation;
+                const auto orientation = VectorMath::fromEulerAngles(VectorMath::Vector3(
+                    static_cast<float>(value[0]), static_cast<float>(value[1]), static_cast<float>(value[2])));
+                copy(orientation.values, orientation.values + 4, transform.Orientation);
+            }
+
+            if (trackSampler.scale.sample(time, value)) {
+                transform.Flags |= GrannyTransformFlags::GrannyHasScaleShear;
+                for (auto row = 0; row < 3; row++) {
+                    for (auto column = 0; column < 3; column++) {
+                        transform.ScaleShear[row][column] = row == column ? static_cast<float>(value[row]) : 0.0f;
+                    }
+                }
+            }
+        }
+
+        poseEngine.computePose(localTransforms.data());
+
+        for (const auto boneIndex : boundBones) {
+            Bounds::merge(animationBox, Bounds::transform(boneBoxes[boneIndex], poseEngine.getWorldTransform(boneIndex)));
+        }
+    }
+
+    return animationBox;
+}
+
+void FbxExporterBounds::writeBounds(const Bounds::Box& box, const Bounds::Sphere* sphere, ostream& stream)
+{
+    const auto writeVector = [&stream](const char* name, const float vector[3]) {
+        stream << "\"" << name << "\":[" << vector[0] << "," << vector[1] << "," << vector[2] << "]";
+    };
+
+    // Empty boxes, e.g. of meshes without vertices, are written as a point at the origin.
+    const float origin[3] = { 0.0f, 0.0f, 0.0f };
+    const auto isEmpty = box.isEmpty();
+
+    writeVector("min", isEmpty ? origin : box.min);
+    stream << ",";
+    writeVector("max", isEmpty ? origin : box.max);
+
+    if (sphere) {
+        stream << ",";
+        writeVector("center", sphere->center);
+        stream << ",\"radius\":" << sphere->radius;
+    }
+}
+
+} // namespace GCL::Exporter
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "gcl/exporter/fbxexportermodule.h"
+#include "gcl/utilities/bounds.h"
+
+#include <ostream>
+#include <string>
+
+namespace GCL::Exporter {
+
+using namespace std;
+using namespace GCL::Bindings;
+using namespace GCL::Utilities;
+
+///
+/// \brief Computes the bounds of meshes, models and animations and writes them as json metadata.
+///
+/// Static bounds are computed from the vertex positions of the meshes. Animated bounds are
+/// computed from the bone bounding boxes of the mesh bone bindings, transformed by the bone
+/// world transforms of each sampled pose, so no vertex gets skinned. All bounds are in the
+/// space of the imported scene, i.e. after the basis conversion of the import and before the
+/// axis conversion of the fbx scene.
+///
+class FbxExporterBounds : public FbxExporterModule {
+public:
+    // Inherit constructor.
+    using FbxExporterModule::FbxExporterModule;
+
+    ///
+    /// \brief Computes the bounds of the scene and writes them to a json file.
+    /// \param filePath Path of the json file.
+    ///
+    void exportBounds(const string& filePath);
+
+protected:
+    ///
+    /// \brief Writes the static bounds of a model and its meshes.
+    /// \param model The model of which the bounds need to be written.
+    /// \param stream Json output stream.
+    ///
+    void writeModelBounds(Model::SharedPtr model, ostream& stream);
+
+    ///
+    /// \brief Computes the bounds of a model over all sampled poses of an animation.
+    /// \param animation The animation which poses need to be sampled.
+    /// \param model The model which is animated.
+    /// \return Animated bounds or an empty box if the animation does not animate the model.
+    ///
+    Bounds::Box computeAnimationBounds(Animation::SharedPtr animation, Model::SharedPtr model);
+
+    ///
+    /// \brief Writes a bounding box and optionally a bounding sphere as json object members.
+    /// \param box Bounding box
+    /// \param sphere Bounding sphere or nullptr.
+    /// \param stream Json output stream.
+    ///
+    static void writeBounds(const Bounds::Box& box, const Bounds::Sphere* sphere, ostream& stream);
+};
+
+} // namespace GCL::Exporter
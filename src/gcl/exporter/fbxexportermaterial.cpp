@@ -1,5 +1,7 @@
 #include "gcl/exporter/fbxexportermaterial.h"
 
+#include "gcl/utilities/stringutility.h"
+
 #include <filesystem>
 
 namespace GCL::Exporter {
@@ -12,6 +14,8 @@ FbxExporterMaterial::FbxExporterMaterial(Scene::SharedPtr scene, FbxScene* fbxSc
 
 FbxExporterMaterial::~FbxExporterMaterial()
 {
+    m_texturePipeline.wait();
+
     GCL::Utilities::shutdownDevilImageLibrary();
 }
 
@@ -24,6 +28,21 @@ void FbxExporterMaterial::exportMaterials(string outputFilepath)
     }
 }
 
+void FbxExporterMaterial::waitForTextures()
+{
+    m_texturePipeline.wait();
+}
+
+unsigned FbxExporterMaterial::getWrittenTextureCount() const
+{
+    return m_texturePipeline.getWrittenTextureCount();
+}
+
+void FbxExporterMaterial::setKeepCompressedTextures(bool keepCompressedTextures)
+{
+    m_keepCompressedTextures = keepCompressedTextures;
+}
+
 string FbxExporterMaterial::getTextureFilePath(string outputFilepath, GrannyTexture* texture)
 {
     auto sourceTextureFilePath = string(texture->FromFileName);
@@ -39,72 +58,85 @@ string FbxExporterMaterial::getTextureFilePath(string outputFilepath, GrannyText
     }
 
     const auto textureFileNameWithoutExtension = sourceTextureFileName.substr(0, sourceTextureFileName.find_first_of('.'));
-    const auto textureFileNameWithExtension = sanitizeFileName(textureFileNameWithoutExtension).append(".png");
-
-    if (!ifstream(sourceTextureFilePath.c_str()).good()) {
-        if (ifstream(sourceTextureFileName.c_str()).good()) {
-            sourceTextureFilePath = sourceTextureFileName;
-        } else {
-            bool foundTexture = false;
-
-            for (auto& searchPath : m_scene->getSearchPaths()) {
-                const auto lookupPath = searchPath + sourceTextureFileName;
-                if (ifstream(lookupPath.c_str()).good()) {
-                    sourceTextureFilePath = lookupPath;
-                    foundTexture = true;
-                    break;
-                }
-            }
 
-            const auto parentImportedPath = filesystem::path(m_scene->getImportedFilePaths().front())
-                                                .parent_path()
-                                                .parent_path();
-
-            if (!foundTexture) {
-                for (const auto& entry : filesystem::directory_iterator(parentImportedPath, filesystem::directory_options::skip_permission_denied)) {
-                    const auto lookupPath = (entry.path() / sourceTextureFileName).u8string();
-                    if (ifstream(lookupPath.c_str()).good()) {
-                        sourceTextureFilePath = lookupPath;
-                        foundTexture = true;
-                        break;
-                    }
-                }
-            }
+    sourceTextureFilePath = locateTexture(sourceTextureFilePath, sourceTextureFileName);
 
-            if (!foundTexture) {
-                const auto deeperParentImportedPath = parentImportedPath
-                                                          .parent_path()
-                                                          .parent_path();
-                // Do not scan root path and program files as parent paths.
-                if (deeperParentImportedPath.root_path().string() != deeperParentImportedPath.string()) {
-                    if (!regex_match(deeperParentImportedPath.string(), regex("\\\\(Program Files \\(x86\\)|Program Files)\\\\"))) {
-                        for (const auto& entry : filesystem::recursive_directory_iterator(deeperParentImportedPath, filesystem::directory_options::skip_permission_denied)) {
-                            const auto lookupPath = (entry.path() / sourceTextureFileName).u8string();
-                            if (ifstream(lookupPath.c_str()).good()) {
-                                sourceTextureFilePath = lookupPath;
-                                foundTexture = true;
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-        }
+    // Compressed textures can be kept as dds files without re-encoding.
+    auto isCompressed = false;
+    if (m_keepCompressedTextures) {
+        auto sourceExtension = filesystem::u8path(sourceTextureFilePath).extension().u8string();
+        GCL::Utilities::toLower(sourceExtension);
+
+        isCompressed = sourceTextureFilePath.empty()
+            ? texture->Encoding == GrannyS3TCTextureEncoding
+            : sourceExtension == ".dds";
     }
 
+    const auto textureFileNameWithExtension = sanitizeFileName(textureFileNameWithoutExtension).append(isCompressed ? ".dds" : ".png");
+
     auto outputFilepathFileSeparator = outputFilepath.find_last_of('\\');
     if (outputFilepathFileSeparator == string::npos) {
         outputFilepathFileSeparator = outputFilepath.find_last_of('/');
     }
-    const auto targetTextureFilePath = outputFilepath.substr(0, outputFilepathFileSeparator + 1) + textureFileNameWithExtension;
+    const auto targetTextureDirectory = outputFilepath.substr(0, outputFilepathFileSeparator + 1);
 
-    if (ifstream(sourceTextureFilePath.c_str()).good()) {
-        GCL::Utilities::convertImage(sourceTextureFilePath, targetTextureFilePath);
-    } else {
-        GCL::Utilities::exportTexture(texture, targetTextureFilePath, true);
+    // Queue the texture conversion - only the file name is needed for the material.
+    if (!sourceTextureFilePath.empty()) {
+        return m_texturePipeline.convertImage(sourceTextureFilePath, targetTextureDirectory, textureFileNameWithExtension);
+    }
+
+    // Share the ownership of the scene, which keeps the granny file of the texture alive while the job is queued.
+    return m_texturePipeline.exportTexture(shared_ptr<GrannyTexture>(m_scene, texture), targetTextureDirectory, textureFileNameWithExtension, true);
+}
+
+string FbxExporterMaterial::locateTexture(string sourceTextureFilePath, string sourceTextureFileName)
+{
+    using SearchDepth = GCL::Utilities::TextureLocator::SearchDepth;
+
+    error_code errorCode;
+
+    if (filesystem::is_regular_file(filesystem::u8path(sourceTextureFilePath), errorCode)) {
+        return sourceTextureFilePath;
+    }
+
+    if (filesystem::is_regular_file(filesystem::u8path(sourceTextureFileName), errorCode)) {
+        return sourceTextureFileName;
+    }
+
+    // Look up the texture in the indexed search roots - each root is walked only once per locator.
+    const auto textureLocator = m_scene->getTextureLocator();
+
+    for (const auto& searchPath : m_scene->getSearchPaths()) {
+        const auto lookupPath = textureLocator->find(sourceTextureFileName, searchPath, SearchDepth::Directory);
+        if (!lookupPath.empty()) {
+            return lookupPath;
+        }
+    }
+
+    if (m_scene->getImportedFilePaths().empty()) {
+        return "";
+    }
+
+    const auto parentImportedPath = filesystem::u8path(m_scene->getImportedFilePaths().front())
+                                        .parent_path()
+                                        .parent_path();
+
+    auto lookupPath = textureLocator->find(sourceTextureFileName, parentImportedPath.u8string(), SearchDepth::Subdirectories);
+    if (!lookupPath.empty()) {
+        return lookupPath;
+    }
+
+    const auto deeperParentImportedPath = parentImportedPath
+                                              .parent_path()
+                                              .parent_path();
+
+    // Do not scan root path and program files as parent paths.
+    if (deeperParentImportedPath.root_path() == deeperParentImportedPath
+        || regex_search(deeperParentImportedPath.string(), regex("\\\\(Program Files \\(x86\\)|Program Files)(\\\\|$)"))) {
+        return "";
     }
 
-    return textureFileNameWithExtension;
+    return textureLocator->find(sourceTextureFileName, deeperParentImportedPath.u8string(), SearchDepth::Recursive);
 }
 
 FbxSurfaceMaterial* FbxExporterMaterial::addMaterial(
@@ -5,6 +5,8 @@
 #include "gcl/importer/grannyformat.h"
 #include "gcl/utilities/devilimageutility.h"
 #include "gcl/utilities/materialutility.h"
+#include "gcl/utilities/texturelocator.h"
+#include "gcl/utilities/texturepipeline.h"
 #include "gcl/utilities/textureutility.h"
 
 #include <fbxsdk.h>
@@ -41,6 +43,21 @@ public:
     ///
     void exportMaterials(string outputFilepath);
 
+    ///
+    /// \brief Waits until all textures queued by the material export are written.
+    ///
+    void waitForTextures();
+
+    ///
+    /// \brief Returns the number of textures written by the texture pipeline.
+    ///
+    unsigned getWrittenTextureCount() const;
+
+    ///
+    /// \brief Sets whether to keep compressed textures as dds files instead of converting them to png files.
+    ///
+    void setKeepCompressedTextures(bool keepCompressedTextures);
+
 protected:
     ///
     /// \brief Export all materials of the scene to the fbx scene.
@@ -56,6 +73,14 @@ protected:
     ///
     string getTextureFilePath(string outputFilepath, GrannyTexture* texture);
 
+    ///
+    /// \brief Locates the source file of a texture using the texture locator of the scene.
+    /// \param sourceTextureFilePath Original file path of the texture.
+    /// \param sourceTextureFileName File name of the texture without path.
+    /// \return File path of the found texture or an empty string if it was not found.
+    ///
+    string locateTexture(string sourceTextureFilePath, string sourceTextureFileName);
+
     ///
     /// \brief Exports a material of the scene to the fbx scene - part of exportMaterial.
     /// \param material Material which should be added.
@@ -91,6 +116,16 @@ protected:
     /// \brief Exported materials of the current exporting scene stored by material name.
     ///
     map<string, FbxSurfacePhong*> m_fbxMaterials;
+
+    ///
+    /// \brief Converts the textures of the exported materials in the background.
+    ///
+    GCL::Utilities::TexturePipeline m_texturePipeline;
+
+    ///
+    /// \brief Keep compressed textures as dds files.
+    ///
+    bool m_keepCompressedTextures = false;
 };
 
 } // namespace GCL::Exporter
@@ -1,31 +1,857 @@
 #include "gcl/exporter/fbxexportermesh.h"
 
+#include "gcl/utilities/bonepartitioner.h"
+#include "gcl/utilities/convexhull.h"
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/materialtable.h"
+#include "gcl/utilities/meshoptimizer.h"
+#include "gcl/utilities/meshsimplifier.h"
+#include "gcl/utilities/skinweights.h"
+#include "gcl/utilities/tangentgenerator.h"
+#include "gcl/utilities/threadpool.h"
+#include "gcl/utilities/tracing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <future>
 #include <map>
 #include <vector>
 
 namespace GCL::Exporter {
 
+using namespace GCL::Utilities::Logging;
+
 void FbxExporterMesh::exportMeshes(Model::SharedPtr model, bool exportSkeleton)
 {
+    // Hulls follow the triangle indices of the bone bindings, so they need the original geometry.
+    if (exportSkeleton && m_exportCollisionHulls) {
+        exportCollisionHulls(model);
+    }
+
+    vector<Mesh::SharedPtr> meshes;
     for (auto mesh : model->getMeshes()) {
-        if (!mesh->isExcluded()) {
-            exportMesh(model, mesh, exportSkeleton);
+        if (mesh->isExcluded()) {
+            continue;
+        }
+
+        if (m_optimizeMeshes || m_lodCount > 0) {
+            loadPositionRemap(mesh);
+        }
+
+        if (exportSkeleton && m_normalizeSkinWeights && !mesh->isRigid()) {
+            normalizeSkinWeights(mesh);
+        }
+
+        // Meshes referencing more bones than the palette are exported as partitions instead.
+        const auto partitions = exportSkeleton && m_bonePaletteSize > 0 ? partitionMesh(mesh) : vector<Mesh::SharedPtr>();
+        if (partitions.empty()) {
+            meshes.push_back(mesh);
+        } else {
+            for (auto partition : partitions) {
+                mesh->addPartition(partition);
+                meshes.push_back(partition);
+            }
         }
     }
+
+    // Optimize first, welded seams leave more vertices to simplify.
+    if (m_optimizeMeshes) {
+        for (auto mesh : meshes) {
+            optimizeMesh(mesh);
+        }
+    }
+
+    if (m_lodCount > 0) {
+        createLodMeshes(meshes);
+    }
+
+    if (m_generateTangents) {
+        generateTangents(meshes);
+    }
+
+    for (auto mesh : meshes) {
+        exportMesh(model, mesh, exportSkeleton);
+    }
 }
 
 void FbxExporterMesh::exportMesh(Model::SharedPtr model, Mesh::SharedPtr mesh, bool exportSkeleton)
 {
-    auto meshNode = FbxNode::Create(m_fbxScene, mesh->getData()->Name);
+    const auto meshName = mesh->getName();
+    GCL::Utilities::Tracing::ScopedSpan span("exportMesh", meshName.c_str());
+
+    auto meshNode = FbxNode::Create(m_fbxScene, meshName.c_str());
     mesh->setNode(meshNode);
 
-    m_fbxScene->GetRootNode()->AddChild(meshNode);
+    const auto lodMeshes = mesh->getLodMeshes();
+    FbxNode* lodGroupNode = nullptr;
+
+    // Levels of detail are children of a lod group node, the mesh itself is the finest level.
+    if (!lodMeshes.empty()) {
+        const auto lodGroupName = meshName + "_LODGroup";
+        auto lodGroup = FbxLODGroup::Create(m_fbxScene, lodGroupName.c_str());
+        lodGroup->ThresholdsUsedAsPercentage.Set(true);
+
+        lodGroupNode = FbxNode::Create(m_fbxScene, lodGroupName.c_str());
+        lodGroupNode->SetNodeAttribute(lodGroup);
+        lodGroupNode->AddChild(meshNode);
+    }
+
+    // Rigid meshes follow their bone as child node, so they need no skin.
+    const auto rigidBone = exportSkeleton ? getRigidBone(model, mesh) : nullptr;
+    const auto isBoneChild = m_parentRigidMeshes && rigidBone && rigidBone->getNode();
+    const auto isSkinned = exportSkeleton && model->getBones().size() > 0 && !isBoneChild;
+
+    if (isBoneChild) {
+        attachToBone(lodGroupNode ? lodGroupNode : meshNode, rigidBone);
+    } else {
+        m_fbxScene->GetRootNode()->AddChild(lodGroupNode ? lodGroupNode : meshNode);
+    }
 
     auto fbxMesh = exportFbxMesh(mesh);
 
-    if (exportSkeleton && model->getBones().size() > 0) {
+    if (isSkinned) {
         createBoneWeightsAndApplyDeformation(model, mesh, meshNode, fbxMesh);
     }
+
+    for (size_t level = 0; level < lodMeshes.size(); level++) {
+        const auto lodMesh = lodMeshes[level];
+        const auto lodName = meshName + "_LOD" + to_string(level + 1);
+
+        auto lodNode = FbxNode::Create(m_fbxScene, lodName.c_str());
+        lodMesh->setNode(lodNode);
+        lodGroupNode->AddChild(lodNode);
+
+        // Switch to the next level when the mesh covers less screen than the triangle ratio.
+        auto lodGroup = static_cast<FbxLODGroup*>(lodGroupNode->GetNodeAttribute());
+        lodGroup->AddThreshold(100.0 * pow(static_cast<double>(m_lodReduction), static_cast<double>(level + 1)));
+
+        auto lodFbxMesh = exportFbxMesh(lodMesh);
+
+        if (isSkinned) {
+            createBoneWeightsAndApplyDeformation(model, lodMesh, lodNode, lodFbxMesh);
+        }
+    }
+}
+
+void FbxExporterMesh::setNormalizeSkinWeights(bool normalizeSkinWeights)
+{
+    m_normalizeSkinWeights = normalizeSkinWeights;
+}
+
+void FbxExporterMesh::setMaxBoneInfluences(unsigned maxBoneInfluences)
+{
+    m_maxBoneInfluences = maxBoneInfluences;
+}
+
+void FbxExporterMesh::setMinBoneWeight(float minBoneWeight)
+{
+    m_minBoneWeight = minBoneWeight;
+}
+
+size_t FbxExporterMesh::getPrunedInfluenceCount() const
+{
+    return m_prunedInfluenceCount;
+}
+
+void FbxExporterMesh::setBonePaletteSize(unsigned bonePaletteSize)
+{
+    m_bonePaletteSize = bonePaletteSize;
+}
+
+void FbxExporterMesh::setParentRigidMeshes(bool parentRigidMeshes)
+{
+    m_parentRigidMeshes = parentRigidMeshes;
+}
+
+void FbxExporterMesh::setGenerateTangents(bool generateTangents)
+{
+    m_generateTangents = generateTangents;
+}
+
+void FbxExporterMesh::setExportCollisionHulls(bool exportCollisionHulls)
+{
+    m_exportCollisionHulls = exportCollisionHulls;
+}
+
+void FbxExporterMesh::setCollisionHullMaxVertices(unsigned collisionHullMaxVertices)
+{
+    m_collisionHullMaxVertices = collisionHullMaxVertices;
+}
+
+void FbxExporterMesh::setOptimizeMeshes(bool optimizeMeshes)
+{
+    m_optimizeMeshes = optimizeMeshes;
+}
+
+void FbxExporterMesh::setWeldTolerance(float weldTolerance)
+{
+    m_weldTolerance = weldTolerance;
+}
+
+size_t FbxExporterMesh::getWeldedVertexCount() const
+{
+    return m_weldedVertexCount;
+}
+
+double FbxExporterMesh::getAcmrBefore() const
+{
+    return m_optimizedTriangleCount ? static_cast<double>(m_cacheMissesBefore) / static_cast<double>(m_optimizedTriangleCount) : 0.0;
+}
+
+double FbxExporterMesh::getAcmrAfter() const
+{
+    return m_optimizedTriangleCount ? static_cast<double>(m_cacheMissesAfter) / static_cast<double>(m_optimizedTriangleCount) : 0.0;
+}
+
+void FbxExporterMesh::optimizeMesh(Mesh::SharedPtr mesh)
+{
+    GCL::Utilities::Tracing::ScopedSpan span("optimizeMesh", mesh->getName().c_str());
+
+    auto vertices = mesh->getRigidVertices();
+    auto indices = mesh->getIndices();
+    auto positionRemap = mesh->getPositionRemap();
+
+    const auto originalVertexCount = vertices.size();
+    const auto cacheMissesBefore = MeshOptimizer::computeCacheMisses(indices.data(), indices.size(), vertices.size());
+
+    // Weld by all exported attributes, so only vertices which export identically get merged.
+    if (mesh->getMorphTargets().empty()) {
+        constexpr size_t stride = 18;
+        vector<float> attributes;
+        attributes.reserve(vertices.size() * stride);
+
+        for (const auto& vertex : vertices) {
+            attributes.insert(attributes.end(), vertex.Position, vertex.Position + 3);
+            attributes.insert(attributes.end(), vertex.Normal, vertex.Normal + 3);
+            attributes.insert(attributes.end(), vertex.UV1, vertex.UV1 + 2);
+            attributes.insert(attributes.end(), vertex.UV2, vertex.UV2 + 2);
+
+            for (auto i = 0; i < 4; i++) {
+                attributes.push_back(static_cast<float>(vertex.BoneWeights[i]));
+                attributes.push_back(static_cast<float>(vertex.BoneIndices[i]));
+            }
+        }
+
+        vector<unsigned> remap;
+        const auto uniqueCount = MeshOptimizer::weldVertices(
+            attributes.data(), vertices.size(), stride, m_weldTolerance, remap, positionRemap.empty() ? nullptr : positionRemap.data());
+
+        if (uniqueCount < vertices.size()) {
+            vector<GrannyPWNT34322Vertex> uniqueVertices(uniqueCount);
+            for (size_t vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
+                uniqueVertices[remap[vertexIndex]] = vertices[vertexIndex];
+            }
+
+            for (auto& index : indices) {
+                index = remap[index];
+            }
+
+            if (!positionRemap.empty()) {
+                positionRemap = MeshOptimizer::remapPositionRemap(positionRemap, remap, uniqueCount);
+            }
+
+            vertices = move(uniqueVertices);
+        }
+    }
+
+    // Reorder triangles within their material groups, so groups keep their triangle ranges.
+    const auto& materialGroups = mesh->getMaterialGroups();
+    const auto triangleCount = indices.size() / 3;
+
+    if (!materialGroups.empty()) {
+        for (const auto& group : materialGroups) {
+            const auto triFirst = static_cast<size_t>(max(group.TriFirst, 0));
+            const auto triCount = min(static_cast<size_t>(max(group.TriCount, 0)), triangleCount - min(triFirst, triangleCount));
+
+            MeshOptimizer::optimizeVertexCache(indices.data() + triFirst * 3, triCount * 3, vertices.size());
+        }
+    } else {
+        MeshOptimizer::optimizeVertexCache(indices.data(), triangleCount * 3, vertices.size());
+    }
+
+    vector<unsigned> remap;
+    MeshOptimizer::optimizeVertexFetch(indices.data(), indices.size(), vertices.size(), remap);
+
+    vector<GrannyPWNT34322Vertex> orderedVertices(vertices.size());
+    for (size_t vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
+        orderedVertices[remap[vertexIndex]] = vertices[vertexIndex];
+    }
+
+    for (auto morphTarget : mesh->getMorphTargets()) {
+        morphTarget->remapVertices(remap);
+    }
+
+    const auto cacheMissesAfter = MeshOptimizer::computeCacheMisses(indices.data(), indices.size(), orderedVertices.size());
+
+    info("Optimized mesh \"%s\": %zu -> %zu vertices, ACMR %.3f -> %.3f.",
+        mesh->getName().c_str(),
+        originalVertexCount,
+        orderedVertices.size(),
+        triangleCount ? static_cast<double>(cacheMissesBefore) / static_cast<double>(triangleCount) : 0.0,
+        triangleCount ? static_cast<double>(cacheMissesAfter) / static_cast<double>(triangleCount) : 0.0);
+
+    m_weldedVertexCount += originalVertexCount - orderedVertices.size();
+    m_optimizedTriangleCount += triangleCount;
+    m_cacheMissesBefore += cacheMissesBefore;
+    m_cacheMissesAfter += cacheMissesAfter;
+
+    if (!positionRemap.empty()) {
+        positionRemap = MeshOptimizer::remapPositionRemap(positionRemap, remap, orderedVertices.size());
+    }
+
+    mesh->setGeometry(move(orderedVertices), move(indices));
+    mesh->setPositionRemap(move(positionRemap));
+}
+
+void FbxExporterMesh::loadPositionRemap(Mesh::SharedPtr mesh)
+{
+    const auto topology = mesh->getData()->PrimaryTopology;
+    if (!topology || !topology->VertexToVertexMap || !mesh->getPositionRemap().empty()) {
+        return;
+    }
+
+    vector<unsigned> positionRemap;
+    const auto vertexCount = static_cast<size_t>(max(GrannyGetMeshVertexCount(mesh->getData()), 0));
+
+    if (MeshOptimizer::buildPositionRemap(topology->VertexToVertexMap, static_cast<size_t>(max(topology->VertexToVertexCount, 0)), vertexCount, positionRemap)) {
+        mesh->setPositionRemap(move(positionRemap));
+    } else {
+        debug("Vertex to vertex map of mesh \"%s\" does not match its vertices, shared positions are hashed.", mesh->getName().c_str());
+    }
+}
+
+void FbxExporterMesh::setLodCount(unsigned lodCount)
+{
+    m_lodCount = lodCount;
+}
+
+void FbxExporterMesh::setLodReduction(float lodReduction)
+{
+    m_lodReduction = lodReduction;
+}
+
+void FbxExporterMesh::setLodTargetError(float lodTargetError)
+{
+    m_lodTargetError = lodTargetError;
+}
+
+void FbxExporterMesh::createLodMeshes(const vector<Mesh::SharedPtr>& meshes)
+{
+    GCL::Utilities::Tracing::ScopedSpan span("createLodMeshes");
+
+    ThreadPool threadPool(0, "lod");
+    vector<future<vector<Mesh::SharedPtr>>> lodMeshes;
+
+    // Geometry is copied on the calling thread, the workers only simplify.
+    for (auto mesh : meshes) {
+        auto vertices = mesh->getRigidVertices();
+        auto indices = mesh->getIndices();
+        auto materialGroups = mesh->getMaterialGroups();
+        auto positionRemap = mesh->getPositionRemap();
+        auto grannyMesh = mesh->getData();
+
+        lodMeshes.push_back(threadPool.enqueue([this, grannyMesh, vertices = move(vertices), indices = move(indices), materialGroups, positionRemap = move(positionRemap)]() {
+            return simplifyMesh(grannyMesh, vertices, indices, materialGroups, positionRemap);
+        }));
+    }
+
+    for (size_t i = 0; i < meshes.size(); i++) {
+        for (auto lodMesh : lodMeshes[i].get()) {
+            // Levels of partitions keep the bone indices of the partition.
+            lodMesh->setBonePalette(meshes[i]->getBonePalette());
+            meshes[i]->addLodMesh(lodMesh);
+        }
+    }
+}
+
+vector<Mesh::SharedPtr> FbxExporterMesh::simplifyMesh(
+    GrannyMesh* grannyMesh,
+    const vector<GrannyPWNT34322Vertex>& vertices,
+    const vector<unsigned>& indices,
+    vector<GrannyTriMaterialGroup> materialGroups,
+    const vector<unsigned>& positionRemap) const
+{
+    GCL::Utilities::Tracing::ScopedSpan span("simplifyMesh", grannyMesh->Name);
+
+    const auto triangleCount = indices.size() / 3;
+
+    if (vertices.empty() || triangleCount == 0) {
+        return {};
+    }
+
+    if (materialGroups.empty()) {
+        materialGroups.push_back({ 0, 0, static_cast<int>(triangleCount) });
+    }
+
+    // Indices of each material group, simplified separately to keep their boundaries.
+    vector<vector<unsigned>> groupIndices;
+    vector<size_t> groupTriangleCounts;
+    for (const auto& group : materialGroups) {
+        const auto triFirst = min(static_cast<size_t>(max(group.TriFirst, 0)), triangleCount);
+        const auto triLast = min(triFirst + static_cast<size_t>(max(group.TriCount, 0)), triangleCount);
+
+        groupIndices.emplace_back(indices.begin() + static_cast<ptrdiff_t>(triFirst * 3), indices.begin() + static_cast<ptrdiff_t>(triLast * 3));
+        groupTriangleCounts.push_back(triLast - triFirst);
+    }
+
+    // Collapse only vertices of the same dominant bone, so weights do not bleed over joints.
+    vector<unsigned> vertexClasses(vertices.size());
+    for (size_t vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
+        const auto& vertex = vertices[vertexIndex];
+        const auto dominant = max_element(vertex.BoneWeights, vertex.BoneWeights + 4) - vertex.BoneWeights;
+        vertexClasses[vertexIndex] = vertex.BoneIndices[dominant];
+    }
+
+    const auto positionStride = sizeof(GrannyPWNT34322Vertex) / sizeof(float);
+
+    vector<Mesh::SharedPtr> lodMeshes;
+    auto previousTriangleCount = triangleCount;
+
+    for (unsigned level = 1; level <= m_lodCount; level++) {
+        const auto ratio = pow(static_cast<double>(m_lodReduction), static_cast<double>(level));
+        auto error = 0.0f;
+
+        // Each level is simplified from the previous one.
+        for (size_t groupIndex = 0; groupIndex < materialGroups.size(); groupIndex++) {
+            auto& group = groupIndices[groupIndex];
+            const auto targetIndexCount = static_cast<size_t>(static_cast<double>(groupTriangleCounts[groupIndex]) * ratio) * 3;
+
+            auto groupError = 0.0f;
+            group.resize(MeshSimplifier::simplify(
+                group.data(),
+                group.data(),
+                group.size(),
+                vertices[0].Position,
+                vertices.size(),
+                positionStride,
+                vertexClasses.data(),
+                nullptr,
+                positionRemap.empty() ? nullptr : positionRemap.data(),
+                targetIndexCount,
+                m_lodTargetError,
+                &groupError));
+
+            error = max(error, groupError);
+        }
+
+        vector<unsigned> lodIndices;
+        vector<GrannyTriMaterialGroup> lodMaterialGroups;
+
+        for (size_t groupIndex = 0; groupIndex < materialGroups.size(); groupIndex++) {
+            auto group = groupIndices[groupIndex];
+
+            if (m_optimizeMeshes) {
+                MeshOptimizer::optimizeVertexCache(group.data(), group.size(), vertices.size());
+            }
+
+            lodMaterialGroups.push_back({
+                materialGroups[groupIndex].MaterialIndex,
+                static_cast<int>(lodIndices.size() / 3),
+                static_cast<int>(group.size() / 3),
+            });
+
+            lodIndices.insert(lodIndices.end(), group.begin(), group.end());
+        }
+
+        const auto lodTriangleCount = lodIndices.size() / 3;
+        if (lodTriangleCount >= previousTriangleCount) {
+            info("Stop level of detail generation of mesh \"%s\" at level %u, the target error of %.4f is reached.",
+                grannyMesh->Name, level, static_cast<double>(m_lodTargetError));
+            break;
+        }
+
+        previousTriangleCount = lodTriangleCount;
+
+        // Keep only the vertices used by the level, in order of first use.
+        vector<unsigned> remap;
+        const auto lodVertexCount = MeshOptimizer::optimizeVertexFetch(lodIndices.data(), lodIndices.size(), vertices.size(), remap);
+
+        vector<GrannyPWNT34322Vertex> lodVertices(lodVertexCount);
+        for (size_t vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
+            if (remap[vertexIndex] < lodVertexCount) {
+                lodVertices[remap[vertexIndex]] = vertices[vertexIndex];
+            }
+        }
+
+        info("Created level of detail %u of mesh \"%s\": %zu -> %zu triangles, %zu vertices, error %.4f.",
+            level, grannyMesh->Name, triangleCount, lodTriangleCount, lodVertexCount, static_cast<double>(error));
+
+        auto lodMesh = make_shared<Mesh>(grannyMesh);
+        lodMesh->setGeometry(move(lodVertices), move(lodIndices));
+        lodMesh->setMaterialGroups(move(lodMaterialGroups));
+        lodMeshes.push_back(lodMesh);
+    }
+
+    return lodMeshes;
+}
+
+void FbxExporterMesh::generateTangents(const vector<Mesh::SharedPtr>& meshes)
+{
+    GCL::Utilities::Tracing::ScopedSpan span("generateTangents");
+
+    vector<Mesh::SharedPtr> tangentMeshes;
+    for (auto mesh : meshes) {
+        tangentMeshes.push_back(mesh);
+        for (auto lodMesh : mesh->getLodMeshes()) {
+            tangentMeshes.push_back(lodMesh);
+        }
+    }
+
+    ThreadPool threadPool(0, "tangent");
+    vector<future<vector<float>>> tangents;
+
+    // Geometry is decoded once on the calling thread and kept for exportFbxMesh, the workers only read it.
+    for (auto mesh : tangentMeshes) {
+        mesh->loadGeometry();
+
+        tangents.push_back(threadPool.enqueue([mesh]() {
+            const auto& vertices = mesh->getGeometryVertices();
+            const auto& indices = mesh->getGeometryIndices();
+
+            vector<float> cornerTangents;
+            if (!vertices.empty()) {
+                TangentGenerator::generate(
+                    vertices.front().Position,
+                    vertices.front().Normal,
+                    vertices.front().UV1,
+                    vertices.size(),
+                    sizeof(GrannyPWNT34322Vertex),
+                    indices.data(),
+                    indices.size(),
+                    cornerTangents);
+            }
+
+            return cornerTangents;
+        }));
+    }
+
+    for (size_t i = 0; i < tangentMeshes.size(); i++) {
+        tangentMeshes[i]->setTangents(tangents[i].get());
+    }
+}
+
+void FbxExporterMesh::exportCollisionHulls(Model::SharedPtr model)
+{
+    GCL::Utilities::Tracing::ScopedSpan span("exportCollisionHulls", model->getData()->Name);
+
+    const auto bones = model->getBones();
+    map<string, size_t> boneIndices;
+    for (size_t boneIndex = 0; boneIndex < bones.size(); boneIndex++) {
+        boneIndices[bones[boneIndex]->getData().Name] = boneIndex;
+    }
+
+    // Positions of the vertices of the triangles bound to each bone.
+    vector<vector<float>> bonePoints(bones.size());
+
+    for (auto mesh : model->getMeshes()) {
+        const auto grannyMesh = mesh->getData();
+        if (mesh->isExcluded() || grannyMesh->BoneBindingCount == 0) {
+            continue;
+        }
+
+        // The decoded geometry is kept, so the mesh passes after the hulls do not decode it again.
+        mesh->loadGeometry();
+
+        const auto& vertices = mesh->getGeometryVertices();
+        const auto& indices = mesh->getGeometryIndices();
+        const auto triangleCount = indices.size() / 3;
+
+        // Vertices are stamped with the binding which added them last, so no binding adds a vertex twice.
+        vector<int> addedBy(vertices.size(), -1);
+
+        for (auto bindingIndex = 0; bindingIndex < grannyMesh->BoneBindingCount; bindingIndex++) {
+            const auto& boneBinding = grannyMesh->BoneBindings[bindingIndex];
+            const auto boneIndex = boneIndices.find(boneBinding.BoneName);
+            if (boneIndex == boneIndices.end() || !boneBinding.TriangleIndices) {
+                continue;
+            }
+
+            auto& points = bonePoints[boneIndex->second];
+
+            for (auto i = 0; i < boneBinding.TriangleCount; i++) {
+                const auto triangle = static_cast<size_t>(boneBinding.TriangleIndices[i]);
+                if (triangle >= triangleCount) {
+                    continue;
+                }
+
+                for (auto corner = 0; corner < 3; corner++) {
+                    const auto vertexIndex = indices[triangle * 3 + static_cast<size_t>(corner)];
+                    if (vertexIndex < vertices.size() && addedBy[vertexIndex] != bindingIndex) {
+                        addedBy[vertexIndex] = bindingIndex;
+                        points.insert(points.end(), vertices[vertexIndex].Position, vertices[vertexIndex].Position + 3);
+                    }
+                }
+            }
+        }
+    }
+
+    ThreadPool threadPool(0, "hull");
+    vector<future<ConvexHull::Hull>> hulls;
+
+    for (auto& points : bonePoints) {
+        hulls.push_back(threadPool.enqueue([points = move(points), maxVertices = m_collisionHullMaxVertices]() {
+            return ConvexHull::build(points.data(), points.size() / 3, 3 * sizeof(float), maxVertices);
+        }));
+    }
+
+    size_t hullCount = 0;
+
+    for (size_t boneIndex = 0; boneIndex < bones.size(); boneIndex++) {
+        const auto hull = hulls[boneIndex].get();
+        const auto bone = bones[boneIndex];
+
+        if (hull.indices.empty() || !bone->getNode()) {
+            continue;
+        }
+
+        const auto hullName = string(bone->getData().Name) + "_Collision";
+        const auto hullVertexCount = static_cast<int>(hull.positions.size() / 3);
+
+        auto hullNode = FbxNode::Create(m_fbxScene, hullName.c_str());
+        auto hullMesh = FbxMesh::Create(m_fbxScene, hullName.c_str());
+
+        hullMesh->InitControlPoints(hullVertexCount);
+        auto controlPoints = hullMesh->GetControlPoints();
+        for (auto vertexIndex = 0; vertexIndex < hullVertexCount; vertexIndex++) {
+            const auto position = &hull.positions[static_cast<size_t>(vertexIndex) * 3];
+            controlPoints[vertexIndex] = FbxVector4(
+                static_cast<double>(position[0]),
+                static_cast<double>(position[1]),
+                static_cast<double>(position[2]));
+        }
+
+        for (size_t index = 0; index < hull.indices.size(); index += 3) {
+            hullMesh->BeginPolygon();
+            hullMesh->AddPolygon(static_cast<int>(hull.indices[index]));
+            hullMesh->AddPolygon(static_cast<int>(hull.indices[index + 1]));
+            hullMesh->AddPolygon(static_cast<int>(hull.indices[index + 2]));
+            hullMesh->EndPolygon();
+        }
+
+        hullNode->SetNodeAttribute(hullMesh);
+        attachToBone(hullNode, bone);
+        hullCount++;
+    }
+
+    debug("Exported %zu collision hulls of model \"%s\".", hullCount, model->getData()->Name);
+}
+
+void FbxExporterMesh::normalizeSkinWeights(Mesh::SharedPtr mesh)
+{
+    GCL::Utilities::Tracing::ScopedSpan span("normalizeSkinWeights", mesh->getName().c_str());
+
+    auto vertices = mesh->getRigidVertices();
+    if (vertices.empty()) {
+        return;
+    }
+
+    const auto prunedCount = SkinWeights::normalize(
+        vertices.front().BoneWeights,
+        vertices.front().BoneIndices,
+        vertices.size(),
+        sizeof(GrannyPWNT34322Vertex),
+        m_maxBoneInfluences,
+        m_minBoneWeight);
+
+    debug("Normalized skin weights of mesh \"%s\", pruned %zu influences.", mesh->getName().c_str(), prunedCount);
+
+    m_prunedInfluenceCount += prunedCount;
+
+    // The vertex order does not change, so the position remap stays valid.
+    auto positionRemap = mesh->getPositionRemap();
+    mesh->setGeometry(move(vertices), mesh->getIndices());
+    mesh->setPositionRemap(move(positionRemap));
+}
+
+vector<Mesh::SharedPtr> FbxExporterMesh::partitionMesh(Mesh::SharedPtr mesh)
+{
+    GCL::Utilities::Tracing::ScopedSpan span("partitionMesh", mesh->getName().c_str());
+
+    auto grannyMesh = mesh->getData();
+    if (mesh->isRigid() || static_cast<unsigned>(max(grannyMesh->BoneBindingCount, 0)) <= m_bonePaletteSize) {
+        return {};
+    }
+
+    const auto vertices = mesh->getRigidVertices();
+    const auto indices = mesh->getIndices();
+    const auto triangleCount = indices.size() / 3;
+    const auto boneBindingCount = static_cast<unsigned>(grannyMesh->BoneBindingCount);
+
+    // Bones of each triangle, preferably from the triangle to bone map of the topology.
+    vector<unsigned> triangleBoneOffsets(1, 0);
+    vector<unsigned> triangleBones;
+    triangleBoneOffsets.reserve(triangleCount + 1);
+
+    const auto topology = grannyMesh->PrimaryTopology;
+    auto hasTopologyMap = topology && topology->BonesForTriangle && topology->TriangleToBoneIndices
+        && static_cast<size_t>(max(topology->TriangleToBoneCount, 0)) == triangleCount;
+
+    if (hasTopologyMap) {
+        // Each triangle starts its bones at its offset in the bone list, they end at the next offset.
+        for (size_t triangle = 0; triangle < triangleCount && hasTopologyMap; triangle++) {
+            const auto first = topology->TriangleToBoneIndices[triangle];
+            const auto last = triangle + 1 < triangleCount ? topology->TriangleToBoneIndices[triangle + 1] : topology->BonesForTriangleCount;
+            hasTopologyMap = first >= 0 && first <= last && last <= topology->BonesForTriangleCount;
+
+            for (auto i = first; i < last && hasTopologyMap; i++) {
+                const auto bone = topology->BonesForTriangle[i];
+                hasTopologyMap = bone >= 0 && static_cast<unsigned>(bone) < boneBindingCount;
+
+                if (hasTopologyMap && find(triangleBones.begin() + triangleBoneOffsets.back(), triangleBones.end(), static_cast<unsigned>(bone)) == triangleBones.end()) {
+                    triangleBones.push_back(static_cast<unsigned>(bone));
+                }
+            }
+
+            triangleBoneOffsets.push_back(static_cast<unsigned>(triangleBones.size()));
+        }
+
+        if (!hasTopologyMap) {
+            debug("Triangle to bone map of mesh \"%s\" is invalid, bones are taken from the vertices.", grannyMesh->Name);
+            triangleBoneOffsets.assign(1, 0);
+            triangleBones.clear();
+        }
+    }
+
+    if (!hasTopologyMap) {
+        for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+            for (auto corner = 0; corner < 3; corner++) {
+                const auto& vertex = vertices[indices[triangle * 3 + static_cast<size_t>(corner)]];
+
+                for (auto i = 0; i < 4; i++) {
+                    const auto bone = static_cast<unsigned>(vertex.BoneIndices[i]);
+                    if (vertex.BoneWeights[i] && bone < boneBindingCount
+                        && find(triangleBones.begin() + triangleBoneOffsets.back(), triangleBones.end(), bone) == triangleBones.end()) {
+                        triangleBones.push_back(bone);
+                    }
+                }
+            }
+
+            triangleBoneOffsets.push_back(static_cast<unsigned>(triangleBones.size()));
+        }
+    }
+
+    const auto partitions = BonePartitioner::partition(
+        indices.data(), indices.size(), vertices.size(), triangleBoneOffsets.data(), triangleBones.data(), m_bonePaletteSize);
+
+    if (partitions.size() < 2) {
+        return {};
+    }
+
+    // Material group of each triangle to split the groups between the partitions.
+    const auto& materialGroups = mesh->getMaterialGroups();
+    vector<int> triangleMaterials(triangleCount, 0);
+    for (const auto& group : materialGroups) {
+        const auto triFirst = static_cast<size_t>(max(group.TriFirst, 0));
+        const auto triLast = min(triFirst + static_cast<size_t>(max(group.TriCount, 0)), triangleCount);
+
+        for (auto triangle = triFirst; triangle < triLast; triangle++) {
+            triangleMaterials[triangle] = group.MaterialIndex;
+        }
+    }
+
+    vector<Mesh::SharedPtr> partitionMeshes;
+    vector<unsigned> remap(vertices.size());
+    vector<int> paletteIndices(boneBindingCount, -1);
+    size_t droppedWeightCount = 0;
+
+    for (size_t partitionIndex = 0; partitionIndex < partitions.size(); partitionIndex++) {
+        const auto& partition = partitions[partitionIndex];
+
+        for (size_t i = 0; i < partition.bones.size(); i++) {
+            paletteIndices[partition.bones[i]] = static_cast<int>(i);
+        }
+
+        // Keep only the vertices used by the partition, in order of first use.
+        fill(remap.begin(), remap.end(), ~0u);
+        vector<GrannyPWNT34322Vertex> partitionVertices;
+        vector<unsigned> partitionIndices;
+        vector<GrannyTriMaterialGroup> partitionGroups;
+        partitionIndices.reserve(partition.triangles.size() * 3);
+
+        for (const auto triangle : partition.triangles) {
+            const auto triangleIndex = static_cast<int>(partitionIndices.size() / 3);
+            if (!materialGroups.empty()) {
+                if (partitionGroups.empty() || partitionGroups.back().MaterialIndex != triangleMaterials[triangle]) {
+                    partitionGroups.push_back({ triangleMaterials[triangle], triangleIndex, 0 });
+                }
+
+                partitionGroups.back().TriCount++;
+            }
+
+            for (auto corner = 0; corner < 3; corner++) {
+                const auto vertexIndex = indices[triangle * 3 + static_cast<size_t>(corner)];
+
+                if (remap[vertexIndex] == ~0u) {
+                    remap[vertexIndex] = static_cast<unsigned>(partitionVertices.size());
+
+                    // Bone indices of the partition index its palette.
+                    auto vertex = vertices[vertexIndex];
+                    for (auto i = 0; i < 4; i++) {
+                        const auto bone = static_cast<unsigned>(vertex.BoneIndices[i]);
+                        const auto paletteIndex = bone < boneBindingCount ? paletteIndices[bone] : -1;
+
+                        if (paletteIndex < 0) {
+                            droppedWeightCount += vertex.BoneWeights[i] != 0;
+                            vertex.BoneWeights[i] = 0;
+                            vertex.BoneIndices[i] = 0;
+                        } else {
+                            vertex.BoneIndices[i] = static_cast<unsigned char>(paletteIndex);
+                        }
+                    }
+
+                    partitionVertices.push_back(vertex);
+                }
+
+                partitionIndices.push_back(remap[vertexIndex]);
+            }
+        }
+
+        for (const auto bone : partition.bones) {
+            paletteIndices[bone] = -1;
+        }
+
+        auto partitionMesh = make_shared<Mesh>(grannyMesh);
+        partitionMesh->setName(mesh->getName() + "_Part" + to_string(partitionIndex + 1));
+
+        for (auto morphTarget : mesh->getMorphTargets()) {
+            auto partitionMorphTarget = make_shared<MorphTarget>(morphTarget->getName());
+            const auto& vertexIndices = morphTarget->getVertexIndices();
+
+            for (size_t i = 0; i < vertexIndices.size(); i++) {
+                if (remap[vertexIndices[i]] != ~0u) {
+                    partitionMorphTarget->addDelta(remap[vertexIndices[i]], &morphTarget->getPositionDeltas()[i * 3], &morphTarget->getNormalDeltas()[i * 3]);
+                }
+            }
+
+            if (partitionMorphTarget->getDeltaCount() > 0) {
+                partitionMesh->addMorphTarget(partitionMorphTarget);
+            }
+        }
+
+        const auto partitionVertexCount = partitionVertices.size();
+        partitionMesh->setGeometry(move(partitionVertices), move(partitionIndices));
+
+        if (!mesh->getPositionRemap().empty()) {
+            partitionMesh->setPositionRemap(MeshOptimizer::remapPositionRemap(mesh->getPositionRemap(), remap, partitionVertexCount));
+        }
+
+        partitionMesh->setMaterialGroups(move(partitionGroups));
+        partitionMesh->setBonePalette(partition.bones);
+        partitionMeshes.push_back(partitionMesh);
+    }
+
+    if (droppedWeightCount > 0) {
+        warning("Dropped %zu skin weights of mesh \"%s\" which reference bones outside of the triangle to bone map.", droppedWeightCount, grannyMesh->Name);
+    }
+
+    info("Partitioned mesh \"%s\" with %u bones into %zu partitions of at most %u bones using %s.",
+        grannyMesh->Name,
+        boneBindingCount,
+        partitionMeshes.size(),
+        m_bonePaletteSize,
+        hasTopologyMap ? "the triangle to bone map" : "greedy triangle clustering");
+
+    return partitionMeshes;
 }
 
 void FbxExporterMesh::createBoneWeightsAndApplyDeformation(
@@ -34,6 +860,24 @@ void FbxExporterMesh::createBoneWeightsAndApplyDeformation(
     FbxNode* meshNode,
     FbxMesh* fbxMesh)
 {
+    // Rigid meshes get a single cluster for their bone instead of a cluster per bone with all vertices.
+    if (mesh->isRigid()) {
+        auto rigidBone = getRigidBone(model, mesh);
+        if (rigidBone) {
+            auto boneCluster = FbxCluster::Create(m_fbxScene, rigidBone->getData().Name);
+            const auto vertexCount = static_cast<int>(mesh->getRigidVertices().size());
+            for (auto vertexIndex = 0; vertexIndex < vertexCount; vertexIndex++) {
+                boneCluster->AddControlPointIndex(vertexIndex, 1.0);
+            }
+
+            createMeshDeformation(meshNode, fbxMesh, { make_shared<BoneBinding>(rigidBone, boneCluster) });
+        } else {
+            warning("Rigid mesh \"%s\" is not bound to a bone of the skeleton.", mesh->getData()->Name);
+        }
+
+        return;
+    }
+
     map<string, Bone::SharedPtr> boneMap;
     map<string, Bone::SharedPtr> boneMapBinded;
     vector<BoneBinding::SharedPtr> boneBindings;
@@ -42,7 +886,15 @@ void FbxExporterMesh::createBoneWeightsAndApplyDeformation(
         boneMap[bone->getData().Name] = bone;
     }
 
-    for (auto boneBindingIndex = 0; boneBindingIndex < mesh->getData()->BoneBindingCount; boneBindingIndex++) {
+    // The bone indices of partitions index their palette instead of the bone bindings.
+    vector<unsigned> boneBindingIndices = mesh->getBonePalette();
+    if (boneBindingIndices.empty()) {
+        for (auto boneBindingIndex = 0; boneBindingIndex < mesh->getData()->BoneBindingCount; boneBindingIndex++) {
+            boneBindingIndices.push_back(static_cast<unsigned>(boneBindingIndex));
+        }
+    }
+
+    for (const auto boneBindingIndex : boneBindingIndices) {
         auto boneName = mesh->getData()->BoneBindings[boneBindingIndex].BoneName;
         auto boneCluster = FbxCluster::Create(m_fbxScene, boneName);
         auto boneBinding = make_shared<BoneBinding>(boneMap[boneName], boneCluster);
@@ -52,41 +904,70 @@ void FbxExporterMesh::createBoneWeightsAndApplyDeformation(
 
     auto vertices = mesh->getRigidVertices();
 
-    if (mesh->isRigid()) {
-        for (unsigned vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
-            for (auto bineBinding : boneBindings) {
-                bineBinding->getCluster()->AddControlPointIndex(vertexIndex, 255.0);
+    if (!vertices.empty()) {
+        const auto influences = GCL::Utilities::SkinWeights::collectInfluences(
+            vertices[0].BoneWeights,
+            vertices[0].BoneIndices,
+            vertices.size(),
+            sizeof(GrannyPWNT34322Vertex),
+            boneBindings.size());
+
+        for (size_t boneBindingIndex = 0; boneBindingIndex < influences.size(); boneBindingIndex++) {
+            const auto& boneInfluences = influences[boneBindingIndex];
+            auto cluster = boneBindings[boneBindingIndex]->getCluster();
+
+            for (size_t influenceIndex = 0; influenceIndex < boneInfluences.vertices.size(); influenceIndex++) {
+                cluster->AddControlPointIndex(boneInfluences.vertices[influenceIndex], boneInfluences.weights[influenceIndex]);
             }
         }
-    } else {
-        auto vertexCounter = 0;
-        for (auto vertex : vertices) {
-            for (int boneIndicesIndex = 0; boneIndicesIndex < 4; boneIndicesIndex++) {
-                if (boneBindings[vertex.BoneIndices[boneIndicesIndex]] && vertex.BoneWeights[boneIndicesIndex]) {
-                    boneBindings[vertex.BoneIndices[boneIndicesIndex]]
-                        ->getCluster()
-                        ->AddControlPointIndex(vertexCounter, static_cast<double>(vertex.BoneWeights[boneIndicesIndex] / 255.0));
+    }
+
+    // Map bones without bone binding, except for partitions which must stay within their palette.
+    if (mesh->getBonePalette().empty()) {
+        for (auto bone : boneMap) {
+            auto boneName = bone.first;
+            if (!boneMapBinded[boneName]) {
+                auto boneCluster = FbxCluster::Create(m_fbxScene, boneName.c_str());
+                auto boneBinding = make_shared<BoneBinding>(boneMap[boneName], boneCluster);
+                boneBindings.push_back(boneBinding);
+                for (unsigned vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
+                    boneBinding->getCluster()->AddControlPointIndex(vertexIndex, 0);
                 }
             }
-
-            vertexCounter++;
         }
     }
 
-    // Map bones without bone binding.
-    for (auto bone : boneMap) {
-        auto boneName = bone.first;
-        if (!boneMapBinded[boneName]) {
-            auto boneCluster = FbxCluster::Create(m_fbxScene, boneName.c_str());
-            auto boneBinding = make_shared<BoneBinding>(boneMap[boneName], boneCluster);
-            boneBindings.push_back(boneBinding);
-            for (unsigned vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
-                boneBinding->getCluster()->AddControlPointIndex(vertexIndex, 0);
-            }
+    createMeshDeformation(meshNode, fbxMesh, boneBindings);
+}
+
+Bone::SharedPtr FbxExporterMesh::getRigidBone(Model::SharedPtr model, Mesh::SharedPtr mesh)
+{
+    if (!mesh->isRigid() || mesh->getData()->BoneBindingCount < 1) {
+        return nullptr;
+    }
+
+    const string boneName = mesh->getData()->BoneBindings[0].BoneName;
+    for (auto bone : model->getBones()) {
+        if (boneName == bone->getData().Name) {
+            return bone;
         }
     }
 
-    createMeshDeformation(meshNode, fbxMesh, boneBindings);
+    return nullptr;
+}
+
+void FbxExporterMesh::attachToBone(FbxNode* node, Bone::SharedPtr bone)
+{
+    auto boneNode = bone->getNode();
+    auto boneTransform = bone->hasWorldTransform() ? FbxSdkCommon::toFbxMatrix(bone->getWorldTransform()) : boneNode->EvaluateGlobalTransform();
+    auto nodeTransform = boneTransform.Inverse();
+
+    node->LclTranslation.Set(nodeTransform.GetT());
+    node->LclRotation.Set(nodeTransform.GetR());
+    node->LclScaling.Set(nodeTransform.GetS());
+    boneNode->AddChild(node);
+
+    debug("Attached node \"%s\" to bone \"%s\".", node->GetName(), boneNode->GetName());
 }
 
 void FbxExporterMesh::createMeshDeformation(FbxNode* meshNode, FbxMesh* mesh, vector<BoneBinding::SharedPtr> boneBindings)
@@ -110,7 +991,7 @@ void FbxExporterMesh::createMeshDeformation(FbxNode* meshNode, FbxMesh* mesh, ve
 
                 // Set cluster transform matrix.
                 cluster->SetTransformMatrix(meshMatrix);
-                cluster->SetTransformLinkMatrix(boneNode->EvaluateGlobalTransform());
+                cluster->SetTransformLinkMatrix(bone->hasWorldTransform() ? FbxSdkCommon::toFbxMatrix(bone->getWorldTransform()) : boneNode->EvaluateGlobalTransform());
 
                 meshSkin->AddCluster(cluster);
             }
@@ -122,30 +1003,42 @@ void FbxExporterMesh::createMeshDeformation(FbxNode* meshNode, FbxMesh* mesh, ve
 
 FbxMesh* FbxExporterMesh::exportFbxMesh(Mesh::SharedPtr mesh)
 {
-    auto fbxMesh = FbxMesh::Create(m_fbxScene, mesh->getData()->Name);
+    auto fbxMesh = FbxMesh::Create(m_fbxScene, mesh->getNode()->GetName());
     auto vertices = mesh->getRigidVertices();
 
     createControlPoints(fbxMesh, vertices);
     createMaterial(fbxMesh);
     createNormal(fbxMesh, vertices);
     createUV(mesh, fbxMesh, vertices);
+    createTangents(mesh, fbxMesh, vertices);
 
-    const auto indexCount = GrannyGetMeshIndexCount(mesh->getData());
-    const auto indexArray = new int[static_cast<unsigned>(indexCount)];
-    GrannyCopyMeshIndices(mesh->getData(), 4, indexArray);
+    if (!mesh->getMorphTargets().empty()) {
+        createBlendShapes(mesh, fbxMesh, vertices);
+    }
+
+    const auto indices = mesh->getIndices();
+    const auto indexCount = static_cast<int>(indices.size());
 
     bindMaterials(mesh);
 
-    for (auto index = 0; index < indexCount; index += 3) {
-        fbxMesh->BeginPolygon(getMaterialForIndex(mesh, index));
-        fbxMesh->AddPolygon(indexArray[index]);
-        fbxMesh->AddPolygon(indexArray[index + 1]);
-        fbxMesh->AddPolygon(indexArray[index + 2]);
+    // Resolve the material of each triangle once instead of searching the groups per triangle.
+    const auto& materialGroups = mesh->getMaterialGroups();
+    const auto materialSlots = getMaterialSlots(mesh);
+    const auto triangleMaterials = GCL::Utilities::MaterialTable::build(
+        materialGroups.data(),
+        materialGroups.size(),
+        materialSlots.data(),
+        materialSlots.size(),
+        static_cast<size_t>(indexCount / 3));
+
+    for (auto index = 0; index + 2 < indexCount; index += 3) {
+        fbxMesh->BeginPolygon(triangleMaterials[static_cast<size_t>(index / 3)]);
+        fbxMesh->AddPolygon(static_cast<int>(indices[index]));
+        fbxMesh->AddPolygon(static_cast<int>(indices[index + 1]));
+        fbxMesh->AddPolygon(static_cast<int>(indices[index + 2]));
         fbxMesh->EndPolygon();
     }
 
-    delete[] indexArray;
-
     mesh->getNode()->SetNodeAttribute(fbxMesh);
     mesh->getNode()->SetShadingMode(FbxNode::eTextureShading);
 
@@ -166,6 +1059,75 @@ void FbxExporterMesh::createControlPoints(FbxMesh* mesh, vector<GrannyPWNT34322V
     }
 }
 
+void FbxExporterMesh::createBlendShapes(Mesh::SharedPtr mesh, FbxMesh* fbxMesh, const vector<GrannyPWNT34322Vertex>& vertices)
+{
+    const auto meshName = mesh->getData()->Name;
+    const auto vertexCount = static_cast<int>(vertices.size());
+    auto blendShape = FbxBlendShape::Create(m_fbxScene, (string(meshName) + "_BlendShape").c_str());
+
+    for (auto morphTarget : mesh->getMorphTargets()) {
+        if (morphTarget->isExcluded()) {
+            continue;
+        }
+
+        const auto name = morphTarget->getName();
+        auto channel = FbxBlendShapeChannel::Create(m_fbxScene, name.c_str());
+        auto shape = FbxShape::Create(m_fbxScene, name.c_str());
+
+        shape->InitControlPoints(vertexCount);
+        auto controlPoints = shape->GetControlPoints();
+
+        auto normalElement = shape->CreateElementNormal();
+        normalElement->SetMappingMode(FbxLayerElement::eByControlPoint);
+        normalElement->SetReferenceMode(FbxLayerElement::eDirect);
+
+        auto& normals = normalElement->GetDirectArray();
+        normals.Resize(vertexCount);
+
+        for (auto vertexIndex = 0; vertexIndex < vertexCount; vertexIndex++) {
+            const auto& vertex = vertices[static_cast<size_t>(vertexIndex)];
+
+            controlPoints[vertexIndex] = FbxVector4(
+                static_cast<double>(vertex.Position[0]),
+                static_cast<double>(vertex.Position[1]),
+                static_cast<double>(vertex.Position[2]));
+
+            normals.SetAt(vertexIndex, FbxVector4(
+                static_cast<double>(vertex.Normal[0]),
+                static_cast<double>(vertex.Normal[1]),
+                static_cast<double>(vertex.Normal[2])));
+        }
+
+        const auto& vertexIndices = morphTarget->getVertexIndices();
+        const auto& positionDeltas = morphTarget->getPositionDeltas();
+        const auto& normalDeltas = morphTarget->getNormalDeltas();
+
+        for (size_t i = 0; i < vertexIndices.size(); i++) {
+            const auto vertexIndex = static_cast<int>(vertexIndices[i]);
+            const auto positionDelta = &positionDeltas[i * 3];
+            const auto normalDelta = &normalDeltas[i * 3];
+
+            controlPoints[vertexIndex] += FbxVector4(
+                static_cast<double>(positionDelta[0]),
+                static_cast<double>(positionDelta[1]),
+                static_cast<double>(positionDelta[2]),
+                0.0);
+
+            normals.SetAt(vertexIndex, normals.GetAt(vertexIndex) + FbxVector4(
+                static_cast<double>(normalDelta[0]),
+                static_cast<double>(normalDelta[1]),
+                static_cast<double>(normalDelta[2]),
+                0.0));
+        }
+
+        channel->AddTargetShape(shape);
+        blendShape->AddBlendShapeChannel(channel);
+        morphTarget->setChannel(channel);
+    }
+
+    fbxMesh->AddDeformer(blendShape);
+}
+
 void FbxExporterMesh::createMaterial(FbxMesh* mesh)
 {
     auto materialElement = mesh->CreateElementMaterial();
@@ -188,6 +1150,41 @@ void FbxExporterMesh::createNormal(FbxMesh* mesh, vector<GrannyPWNT34322Vertex>
     }
 }
 
+void FbxExporterMesh::createTangents(Mesh::SharedPtr mesh, FbxMesh* fbxMesh, const vector<GrannyPWNT34322Vertex>& vertices)
+{
+    const auto& tangents = mesh->getTangents();
+    const auto indices = mesh->getIndices();
+    if (tangents.size() != indices.size() * 4) {
+        return;
+    }
+
+    // Tangents are per polygon vertex, a vertex at mirrored uvs has one per uv orientation.
+    auto tangentElement = fbxMesh->CreateElementTangent();
+    tangentElement->SetMappingMode(FbxLayerElement::eByPolygonVertex);
+    tangentElement->SetReferenceMode(FbxLayerElement::eDirect);
+
+    auto binormalElement = fbxMesh->CreateElementBinormal();
+    binormalElement->SetMappingMode(FbxLayerElement::eByPolygonVertex);
+    binormalElement->SetReferenceMode(FbxLayerElement::eDirect);
+
+    for (size_t index = 0; index < indices.size(); index++) {
+        const auto tangent = &tangents[index * 4];
+        const auto& vertex = vertices[indices[index]];
+        const FbxVector4 normal(
+            static_cast<double>(vertex.Normal[0]),
+            static_cast<double>(vertex.Normal[1]),
+            static_cast<double>(vertex.Normal[2]),
+            0.0);
+
+        // The uvs get flipped vertically for fbx, which mirrors the bitangent.
+        const auto sign = -static_cast<double>(tangent[3]);
+        const FbxVector4 fbxTangent(static_cast<double>(tangent[0]), static_cast<double>(tangent[1]), static_cast<double>(tangent[2]), sign);
+
+        tangentElement->GetDirectArray().Add(fbxTangent);
+        binormalElement->GetDirectArray().Add(normal.CrossProduct(fbxTangent) * sign);
+    }
+}
+
 void FbxExporterMesh::createUV(Mesh::SharedPtr mesh, FbxMesh* fbxMesh, vector<GrannyPWNT34322Vertex> vertices)
 {
     // Create uv-set 1.
@@ -252,36 +1249,30 @@ void FbxExporterMesh::bindMaterials(Mesh::SharedPtr mesh)
     }
 }
 
-int FbxExporterMesh::getMaterialForIndex(Mesh::SharedPtr mesh, int index)
+vector<int> FbxExporterMesh::getMaterialSlots(Mesh::SharedPtr mesh)
 {
-    if (mesh->getData()->MaterialBindingCount == 0) {
-        return -1;
-    }
-
-    for (auto groupIndex = 0; groupIndex < mesh->getData()->PrimaryTopology->GroupCount; groupIndex++) {
-        auto group = mesh->getData()->PrimaryTopology->Groups[groupIndex];
-        auto groupTriOffset = index / 3;
+    const auto materialBindingCount = static_cast<size_t>(max(mesh->getData()->MaterialBindingCount, 0));
+    vector<int> slots(materialBindingCount, -1);
 
-        if (groupTriOffset >= group.TriFirst && groupTriOffset < (group.TriFirst + group.TriCount)) {
-            FbxSurfaceMaterial* currentMaterial = nullptr;
+    for (size_t materialBindingIndex = 0; materialBindingIndex < materialBindingCount; materialBindingIndex++) {
+        FbxSurfaceMaterial* currentMaterial = nullptr;
 
-            for (auto sceneMaterial : m_scene->getMaterials()) {
-                if (sceneMaterial->getData() == mesh->getData()->MaterialBindings[group.MaterialIndex].Material) {
-                    currentMaterial = sceneMaterial->getNode();
-                    break;
-                }
+        for (auto sceneMaterial : m_scene->getMaterials()) {
+            if (sceneMaterial->getData() == mesh->getData()->MaterialBindings[materialBindingIndex].Material) {
+                currentMaterial = sceneMaterial->getNode();
+                break;
             }
+        }
 
-            for (auto materialIndex = 0; materialIndex < mesh->getNode()->GetMaterialCount(); materialIndex++) {
-                if (mesh->getNode()->GetMaterial(materialIndex) == currentMaterial) {
-                    return materialIndex;
-                }
+        for (auto materialIndex = 0; materialIndex < mesh->getNode()->GetMaterialCount(); materialIndex++) {
+            if (mesh->getNode()->GetMaterial(materialIndex) == currentMaterial) {
+                slots[materialBindingIndex] = materialIndex;
+                break;
             }
-            break;
         }
     }
 
-    return -1;
+    return slots;
 }
 
 string FbxExporterMesh::sanitizeMaterialName(string name)
@@ -30,7 +30,197 @@ public:
     ///
     void exportMeshes(Model::SharedPtr model, bool exportSkeleton = false);
 
+    ///
+    /// \brief Sets whether to weld vertices and reorder triangles and vertices before the export.
+    /// \param optimizeMeshes Optimization flag
+    ///
+    void setOptimizeMeshes(bool optimizeMeshes);
+
+    ///
+    /// \brief Sets the maximum attribute difference of welded vertices.
+    /// \param weldTolerance Weld tolerance
+    ///
+    void setWeldTolerance(float weldTolerance);
+
+    ///
+    /// \brief Returns the number of vertices removed by welding.
+    /// \return Number of welded vertices
+    ///
+    size_t getWeldedVertexCount() const;
+
+    ///
+    /// \brief Returns the average cache miss ratio of the optimized meshes before the optimization.
+    /// \return Average cache miss ratio or zero if no mesh got optimized.
+    ///
+    double getAcmrBefore() const;
+
+    ///
+    /// \brief Returns the average cache miss ratio of the optimized meshes after the optimization.
+    /// \return Average cache miss ratio or zero if no mesh got optimized.
+    ///
+    double getAcmrAfter() const;
+
+    ///
+    /// \brief Sets the number of simplified levels of detail to create for each mesh.
+    /// \param lodCount Number of levels of detail, zero disables the simplification.
+    ///
+    void setLodCount(unsigned lodCount);
+
+    ///
+    /// \brief Sets the ratio of triangles each level of detail keeps of its finer level.
+    /// \param lodReduction Triangle ratio, e.g. 0.5 to halve the triangles per level.
+    ///
+    void setLodReduction(float lodReduction);
+
+    ///
+    /// \brief Sets the maximum simplification error relative to the extent of a mesh.
+    /// \param lodTargetError Relative error, e.g. 0.01 for 1%.
+    ///
+    void setLodTargetError(float lodTargetError);
+
+    ///
+    /// \brief Sets whether to prune and renormalize the skin weights of skinned meshes.
+    /// \param normalizeSkinWeights Normalization flag
+    ///
+    void setNormalizeSkinWeights(bool normalizeSkinWeights);
+
+    ///
+    /// \brief Sets the maximum number of bone influences per vertex.
+    /// \param maxBoneInfluences Number of influences from one to four.
+    ///
+    void setMaxBoneInfluences(unsigned maxBoneInfluences);
+
+    ///
+    /// \brief Sets the minimum weight of a bone influence.
+    /// \param minBoneWeight Minimum weight, e.g. 0.01 for 1%.
+    ///
+    void setMinBoneWeight(float minBoneWeight);
+
+    ///
+    /// \brief Returns the number of bone influences removed by the skin weight normalization.
+    /// \return Number of pruned influences
+    ///
+    size_t getPrunedInfluenceCount() const;
+
+    ///
+    /// \brief Sets the maximum number of bones per exported mesh.
+    /// \param bonePaletteSize Bone palette size, zero disables the partitioning.
+    ///
+    void setBonePaletteSize(unsigned bonePaletteSize);
+
+    ///
+    /// \brief Sets whether to parent rigid meshes to their bone instead of skinning them.
+    /// \param parentRigidMeshes Parenting flag
+    ///
+    void setParentRigidMeshes(bool parentRigidMeshes);
+
+    ///
+    /// \brief Sets whether to generate tangents and bitangents for the exported meshes.
+    /// \param generateTangents Generation flag
+    ///
+    void setGenerateTangents(bool generateTangents);
+
+    ///
+    /// \brief Sets whether to export a convex collision hull per bone.
+    /// \param exportCollisionHulls Export flag
+    ///
+    void setExportCollisionHulls(bool exportCollisionHulls);
+
+    ///
+    /// \brief Sets the maximum number of vertices per collision hull.
+    /// \param collisionHullMaxVertices Number of vertices, zero for no limit.
+    ///
+    void setCollisionHullMaxVertices(unsigned collisionHullMaxVertices);
+
 protected:
+    ///
+    /// \brief Welds the vertices of a mesh and reorders its triangles and vertices.
+    ///
+    /// Triangles are reordered within their material groups for post-transform vertex cache
+    /// efficiency, then vertices are reordered by first use for fetch locality. Meshes with
+    /// morph targets are not welded, since welded vertices could move differently.
+    ///
+    /// \param mesh The mesh which needs to be optimized.
+    ///
+    void optimizeMesh(Mesh::SharedPtr mesh);
+
+    ///
+    /// \brief Limits, prunes and renormalizes the skin weights of a mesh.
+    ///
+    /// Influences are sorted by weight and sum up to exactly 255 afterwards.
+    ///
+    /// \param mesh The mesh which skin weights need to be normalized.
+    ///
+    void normalizeSkinWeights(Mesh::SharedPtr mesh);
+
+    ///
+    /// \brief Partitions a skinned mesh into meshes which reference at most bone palette size bones.
+    ///
+    /// Uses the triangle to bone map of the granny topology if it is valid, otherwise triangles
+    /// are clustered greedily by their skin weights. Partitions keep their material groups and
+    /// morph targets, the bone indices of their vertices index their bone palette.
+    ///
+    /// \param mesh The mesh which needs to be partitioned.
+    /// \return Partition meshes or none if the mesh fits the palette.
+    ///
+    vector<Mesh::SharedPtr> partitionMesh(Mesh::SharedPtr mesh);
+
+    ///
+    /// \brief Sets the position remap of a mesh from the vertex to vertex map of its topology.
+    ///
+    /// Welding and simplification use the remap to find vertices sharing a position instead
+    /// of hashing all positions. Geometry passes keep it up to date when they reorder vertices.
+    ///
+    /// \param mesh The mesh of which the topology map needs to be loaded.
+    ///
+    void loadPositionRemap(Mesh::SharedPtr mesh);
+
+    ///
+    /// \brief Creates the levels of detail of meshes, simplifying the meshes in parallel.
+    /// \param meshes The meshes which need levels of detail.
+    ///
+    void createLodMeshes(const vector<Mesh::SharedPtr>& meshes);
+
+    ///
+    /// \brief Simplifies the geometry of a mesh to its levels of detail.
+    ///
+    /// Material groups are simplified separately, so no triangle changes its material.
+    /// Stops early if a level can not be simplified within the target error.
+    ///
+    /// \param grannyMesh Granny data of the mesh.
+    /// \param vertices The vertices of the mesh.
+    /// \param indices The indices of the mesh.
+    /// \param materialGroups The material groups of the mesh.
+    /// \param positionRemap The position remap of the mesh or none to hash shared positions.
+    /// \return Level of detail meshes, ordered from fine to coarse.
+    ///
+    vector<Mesh::SharedPtr> simplifyMesh(
+        GrannyMesh* grannyMesh,
+        const vector<GrannyPWNT34322Vertex>& vertices,
+        const vector<unsigned>& indices,
+        vector<GrannyTriMaterialGroup> materialGroups,
+        const vector<unsigned>& positionRemap = {}) const;
+
+    ///
+    /// \brief Generates the tangents of meshes and their levels of detail in parallel.
+    ///
+    /// Tangents are generated from the vertices which get exported, i.e. after welding,
+    /// partitioning and simplification, so they match the exported geometry.
+    ///
+    /// \param meshes The meshes which need tangents.
+    ///
+    void generateTangents(const vector<Mesh::SharedPtr>& meshes);
+
+    ///
+    /// \brief Exports a convex hull per bone of the triangles bound to the bone.
+    ///
+    /// The triangles are taken from the triangle indices of the bone bindings of the meshes,
+    /// so the geometry of the meshes must not be replaced yet. Hulls are built in parallel.
+    ///
+    /// \param model The model of which the collision hulls need to be exported.
+    ///
+    void exportCollisionHulls(Model::SharedPtr model);
+
     ///
     /// \brief Export the meshes of the given model to the fbx scene.
     /// \param model A model the mesh is related to.
@@ -56,6 +246,25 @@ protected:
     ///
     void createBoneWeightsAndApplyDeformation(Model::SharedPtr model, Mesh::SharedPtr mesh, FbxNode* meshNode, FbxMesh* fbxMesh);
 
+    ///
+    /// \brief Returns the bone a rigid mesh is bound to.
+    /// \param model A model the mesh is related to.
+    /// \param mesh The mesh of which the bone is needed.
+    /// \return Bone of the mesh or nullptr if the mesh is skinned or its bone is unknown.
+    ///
+    Bone::SharedPtr getRigidBone(Model::SharedPtr model, Mesh::SharedPtr mesh);
+
+    ///
+    /// \brief Attaches the node of a rigid mesh or of a collision hull to its bone node.
+    ///
+    /// The node gets the inverse world transform of the bone as local transform,
+    /// so the mesh keeps its position in the rest pose and follows the bone afterwards.
+    ///
+    /// \param node The fbx node of the mesh, of its lod group or of the hull.
+    /// \param bone The bone of the mesh.
+    ///
+    void attachToBone(FbxNode* node, Bone::SharedPtr bone);
+
     ///
     /// \brief Export a mesh to a fbx mesh.
     /// \param mesh The mesh which needs to be exported as fbx mesh.
@@ -70,6 +279,18 @@ protected:
     ///
     void createControlPoints(FbxMesh* mesh, vector<GrannyPWNT34322Vertex> vertices);
 
+    ///
+    /// \brief Creates a blend shape deformer with one channel per morph target of the mesh.
+    ///
+    /// Shapes start as copy of the base mesh and only the moved vertices of the sparse
+    /// morph target deltas get applied. The fbx writer stores shapes as deltas again.
+    ///
+    /// \param mesh The mesh which morph targets need to be exported.
+    /// \param fbxMesh The fbx mesh of the mesh.
+    /// \param vertices The vertices of the mesh.
+    ///
+    void createBlendShapes(Mesh::SharedPtr mesh, FbxMesh* fbxMesh, const vector<GrannyPWNT34322Vertex>& vertices);
+
     ///
     /// \brief Create unique material geometry element for the mesh.
     /// \param fbxMesh The fbx mesh of the mesh.
@@ -83,6 +304,14 @@ protected:
     ///
     void createNormal(FbxMesh* mesh, vector<GrannyPWNT34322Vertex> vertices);
 
+    ///
+    /// \brief Create tangent and binormal geometry elements for the mesh, if it has tangents.
+    /// \param mesh The mesh which tangents need to be exported.
+    /// \param fbxMesh The fbx mesh of the mesh.
+    /// \param vertices The vertices of the mesh.
+    ///
+    void createTangents(Mesh::SharedPtr mesh, FbxMesh* fbxMesh, const vector<GrannyPWNT34322Vertex>& vertices);
+
     ///
     /// \brief Create uv geometry elements (uv-sets) for the mesh.
     /// \param mesh The mesh which need its uv-set to be created.
@@ -98,11 +327,11 @@ protected:
     void bindMaterials(Mesh::SharedPtr mesh);
 
     ///
-    /// \brief Returns the material index for a geometry topological index.
-    /// \param mesh The mesh which the geometry topological index is related to.
-    /// \param index The geometry topological index of the related mesh.
+    /// \brief Returns the material index of the node for each material binding of a mesh.
+    /// \param mesh The mesh whose materials are bound to its node.
+    /// \return The material index of each material binding, -1 if it is not bound.
     ///
-    int getMaterialForIndex(Mesh::SharedPtr mesh, int index);
+    vector<int> getMaterialSlots(Mesh::SharedPtr mesh);
 
     ///
     /// \brief Sanitizes a material name.
@@ -110,6 +339,97 @@ protected:
     /// \return Sanitized name of the material.
     ///
     virtual string sanitizeMaterialName(string name);
+
+protected:
+    ///
+    /// \brief Flag whether to optimize meshes before the export.
+    ///
+    bool m_optimizeMeshes = false;
+
+    ///
+    /// \brief Maximum attribute difference of welded vertices.
+    ///
+    float m_weldTolerance = 1e-5f;
+
+    ///
+    /// \brief Number of vertices removed by welding.
+    ///
+    size_t m_weldedVertexCount = 0;
+
+    ///
+    /// \brief Number of triangles of the optimized meshes.
+    ///
+    size_t m_optimizedTriangleCount = 0;
+
+    ///
+    /// \brief Vertex cache misses of the optimized meshes before the optimization.
+    ///
+    size_t m_cacheMissesBefore = 0;
+
+    ///
+    /// \brief Vertex cache misses of the optimized meshes after the optimization.
+    ///
+    size_t m_cacheMissesAfter = 0;
+
+    ///
+    /// \brief Number of simplified levels of detail per mesh.
+    ///
+    unsigned m_lodCount = 0;
+
+    ///
+    /// \brief Ratio of triangles each level of detail keeps of its finer level.
+    ///
+    float m_lodReduction = 0.5f;
+
+    ///
+    /// \brief Maximum simplification error relative to the extent of a mesh.
+    ///
+    float m_lodTargetError = 0.01f;
+
+    ///
+    /// \brief Flag whether to prune and renormalize skin weights.
+    ///
+    bool m_normalizeSkinWeights = false;
+
+    ///
+    /// \brief Maximum number of bone influences per vertex.
+    ///
+    unsigned m_maxBoneInfluences = 4;
+
+    ///
+    /// \brief Minimum weight of a bone influence.
+    ///
+    float m_minBoneWeight = 0.0f;
+
+    ///
+    /// \brief Number of bone influences removed by the skin weight normalization.
+    ///
+    size_t m_prunedInfluenceCount = 0;
+
+    ///
+    /// \brief Maximum number of bones per exported mesh, zero disables the partitioning.
+    ///
+    unsigned m_bonePaletteSize = 0;
+
+    ///
+    /// \brief Flag whether to parent rigid meshes to their bone.
+    ///
+    bool m_parentRigidMeshes = false;
+
+    ///
+    /// \brief Flag whether to generate tangents for the exported meshes.
+    ///
+    bool m_generateTangents = false;
+
+    ///
+    /// \brief Flag whether to export a convex collision hull per bone.
+    ///
+    bool m_exportCollisionHulls = false;
+
+    ///
+    /// \brief Maximum number of vertices per collision hull, zero for no limit.
+    ///
+    unsigned m_collisionHullMaxVertices = 32;
 };
 
 } // namespace GCL::Exporter
@@ -30,4 +30,11 @@ FbxExporterAnimation* FbxExporterModuleFactory::createExporterModuleAnimation(
     return new FbxExporterAnimation(scene, fbxScene);
 }
 
+FbxExporterBounds* FbxExporterModuleFactory::createExporterModuleBounds(
+    Scene::SharedPtr scene,
+    FbxScene* fbxScene)
+{
+    return new FbxExporterBounds(scene, fbxScene);
+}
+
 } // namespace GCL::Exporter
@@ -2,6 +2,7 @@
 
 #include "gcl/bindings/scene.h"
 #include "gcl/exporter/fbxexporteranimation.h"
+#include "gcl/exporter/fbxexporterbounds.h"
 #include "gcl/exporter/fbxexportermaterial.h"
 #include "gcl/exporter/fbxexportermesh.h"
 #include "gcl/exporter/fbxexporterskeleton.h"
@@ -54,6 +55,14 @@ public:
     /// \return Exporter module for animations.
     ///
     virtual FbxExporterAnimation* createExporterModuleAnimation(Scene::SharedPtr scene, FbxScene* fbxScene) = 0;
+
+    ///
+    /// \brief Returns bounds exporter module.
+    /// \param scene Scene which needs to be exported.
+    /// \param fbxScene Fbx scene which has to be used for the export.
+    /// \return Exporter module for bounds.
+    ///
+    virtual FbxExporterBounds* createExporterModuleBounds(Scene::SharedPtr scene, FbxScene* fbxScene) = 0;
 };
 
 ///
@@ -92,6 +101,14 @@ public:
     /// \return Exporter module for animations.
     ///
     FbxExporterAnimation* createExporterModuleAnimation(Scene::SharedPtr scene, FbxScene* fbxScene) override;
+
+    ///
+    /// \brief Returns bounds exporter module.
+    /// \param scene Scene which needs to be exported.
+    /// \param fbxScene Fbx scene which has to be used for the export.
+    /// \return Exporter module for bounds.
+    ///
+    FbxExporterBounds* createExporterModuleBounds(Scene::SharedPtr scene, FbxScene* fbxScene) override;
 };
 
 } // namespace GCL::Exporter
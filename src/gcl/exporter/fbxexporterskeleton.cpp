@@ -1,80 +1,40 @@
 #include "gcl/exporter/fbxexporterskeleton.h"
 
+#include "gcl/utilities/fbxsdkcommon.h"
+#include "gcl/utilities/poseengine.h"
+
+#include <unordered_map>
+
 namespace GCL::Exporter {
 
+using GCL::Utilities::FbxSdkCommon;
+using GCL::Utilities::PoseEngine;
+
 void FbxExporterSkeleton::exportBones(Model::SharedPtr model)
 {
+    vector<GrannyBone> grannyBones;
     for (auto bone : model->getBones()) {
-        exportBone(model, bone);
+        grannyBones.push_back(bone->getData());
     }
-}
 
-void FbxExporterSkeleton::exportBone(Model::SharedPtr model, Bone::SharedPtr bone)
-{
-    auto grannyBone = bone->getData();
-    auto parentIndex = grannyBone.ParentIndex;
+    // Compute all bone transforms in one pass instead of letting the sdk walk the hierarchy per bone.
+    PoseEngine poseEngine(grannyBones.data(), grannyBones.size(), &model->getData()->InitialPlacement);
+    poseEngine.computeRestPose();
 
-    // Set bone transformation.
-    auto localTransform = bone->getData().LocalTransform;
-    auto boneTransform = FbxAMatrix(
-        FbxDouble3(0, 0, 0),
-        FbxDouble3(0, 0, 0),
-        FbxDouble3(1, 1, 1));
-
-    if (localTransform.Flags & GrannyTransformFlags::GrannyHasPosition) {
-        boneTransform.SetT(FbxVector4(
-            static_cast<double>(localTransform.Position[0]),
-            static_cast<double>(localTransform.Position[1]),
-            static_cast<double>(localTransform.Position[2])));
+    for (size_t boneIndex = 0; boneIndex < model->getBones().size(); boneIndex++) {
+        auto bone = model->getBones().at(boneIndex);
+        exportBone(model, bone, FbxSdkCommon::toFbxMatrix(poseEngine.getLocalTransform(boneIndex)));
+        bone->setWorldTransform(poseEngine.getWorldTransform(boneIndex));
     }
 
-    if (localTransform.Flags & GrannyTransformFlags::GrannyHasOrientation) {
-        boneTransform.SetQ(FbxQuaternion(
-            static_cast<double>(localTransform.Orientation[0]),
-            static_cast<double>(localTransform.Orientation[1]),
-            static_cast<double>(localTransform.Orientation[2]),
-            static_cast<double>(localTransform.Orientation[3])));
-    }
-
-    if (localTransform.Flags & GrannyTransformFlags::GrannyHasScaleShear) {
-        boneTransform.SetS(FbxDouble3(
-            static_cast<double>(localTransform.ScaleShear[0][0]),
-            static_cast<double>(localTransform.ScaleShear[1][1]),
-            static_cast<double>(localTransform.ScaleShear[2][2])));
-    }
-
-    // Multiply bone transformation by initial model placement.
-    if (parentIndex == GrannyNoParentBone) {
-        auto initialPlacement = model->getData()->InitialPlacement;
-        auto initialTransform = FbxAMatrix(
-            FbxDouble3(0, 0, 0),
-            FbxDouble3(0, 0, 0),
-            FbxDouble3(1, 1, 1));
-
-        if (initialPlacement.Flags & GrannyTransformFlags::GrannyHasPosition) {
-            initialTransform.SetT(FbxDouble3(
-                static_cast<double>(initialPlacement.Position[0]),
-                static_cast<double>(initialPlacement.Position[1]),
-                static_cast<double>(initialPlacement.Position[2])));
-        }
-
-        if (initialPlacement.Flags & GrannyTransformFlags::GrannyHasOrientation) {
-            initialTransform.SetQ(FbxQuaternion(
-                static_cast<double>(initialPlacement.Orientation[0]),
-                static_cast<double>(initialPlacement.Orientation[1]),
-                static_cast<double>(initialPlacement.Orientation[2]),
-                static_cast<double>(initialPlacement.Orientation[3])));
-        }
-
-        if (initialPlacement.Flags & GrannyTransformFlags::GrannyHasScaleShear) {
-            initialTransform.SetS(FbxDouble3(
-                static_cast<double>(initialPlacement.ScaleShear[0][0]),
-                static_cast<double>(initialPlacement.ScaleShear[1][1]),
-                static_cast<double>(initialPlacement.ScaleShear[2][2])));
-        }
+    // Mark the skeleton as exported by its root bone node.
+    model->getSkeleton()->setNode(model->getBones().at(0)->getNode());
+}
 
-        boneTransform = initialTransform * boneTransform;
-    }
+void FbxExporterSkeleton::exportBone(Model::SharedPtr model, Bone::SharedPtr bone, const FbxAMatrix& boneTransform)
+{
+    auto grannyBone = bone->getData();
+    auto parentIndex = grannyBone.ParentIndex;
 
     // Setup the bone node.
     auto boneName = grannyBone.Name;
@@ -165,8 +125,21 @@ void FbxExporterSkeleton::exportBindPose(Model::SharedPtr model)
         auto bindPose = FbxPose::Create(m_fbxScene, bindPoseName.c_str());
         bindPose->SetIsBindPose(true);
 
+        // Bone world transforms were computed on export, other nodes are evaluated by the sdk.
+        unordered_map<FbxNode*, Bone::SharedPtr> nodeBones;
+        for (auto bone : model->getBones()) {
+            if (bone->getNode() && bone->hasWorldTransform()) {
+                nodeBones[bone->getNode()] = bone;
+            }
+        }
+
         for (const auto boneCluster : boneClusters) {
-            bindPose->Add(boneCluster, boneCluster->EvaluateGlobalTransform());
+            auto nodeBone = nodeBones.find(boneCluster);
+            if (nodeBone != nodeBones.end()) {
+                bindPose->Add(boneCluster, FbxSdkCommon::toFbxMatrix(nodeBone->second->getWorldTransform()));
+            } else {
+                bindPose->Add(boneCluster, boneCluster->EvaluateGlobalTransform());
+            }
         }
 
         m_fbxScene->AddPose(bindPose);
@@ -32,8 +32,9 @@ protected:
     /// \brief Export a bone of the scene to the fbx scene.
     /// \param model A model the bone is related to.
     /// \param bone A bone which needs to be exported.
+    /// \param boneTransform Transform of the bone relative to its parent node.
     ///
-    void exportBone(Model::SharedPtr model, Bone::SharedPtr bone);
+    void exportBone(Model::SharedPtr model, Bone::SharedPtr bone, const FbxAMatrix& boneTransform);
 
     ///
     /// \brief Export the bind pose of a model to the fbx scene.
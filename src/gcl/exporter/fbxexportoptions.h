@@ -57,6 +57,135 @@ struct FbxExportOptions {
     /// Default is 3ds max coordinate system (right-handed z-up).
     ///
     string convertAxis = "xzy";
+
+    ///
+    /// \brief Sets the file path to persist the texture search index between runs.
+    ///
+    /// The index maps texture file names to their file paths for each searched directory.
+    /// It gets loaded before and saved after the export. Leave it empty to disable persistence.
+    ///
+    string textureIndexFilePath = "";
+
+    ///
+    /// \brief Sets whether to keep compressed textures as dds files.
+    ///
+    /// Enable this to write S3TC compressed granny textures and dds source files
+    /// without re-encoding them. Otherwise all textures are converted to png files.
+    ///
+    bool keepCompressedTextures = false;
+
+    ///
+    /// \brief Sets whether to optimize the geometry of meshes.
+    ///
+    /// Enable this to weld duplicated vertices, e.g. at seams of meshes exported per material,
+    /// and to reorder triangles and vertices for vertex cache efficiency and fetch locality.
+    /// The average cache miss ratio before and after is logged and added to the statistics.
+    ///
+    bool optimizeMeshes = false;
+
+    ///
+    /// \brief Sets the maximum attribute difference of welded vertices.
+    ///
+    /// Applies to position, normal, uv sets and skin weights of the vertices.
+    ///
+    float weldTolerance = 1e-5f;
+
+    ///
+    /// \brief Sets the number of simplified levels of detail to create for each mesh.
+    ///
+    /// Meshes with levels of detail are exported as fbx lod group, the mesh itself is the
+    /// finest level. Simplification respects uv seams, material groups and dominant bones
+    /// of the skin weights and runs in parallel per mesh. Zero disables the simplification.
+    ///
+    unsigned lodCount = 0;
+
+    ///
+    /// \brief Sets the ratio of triangles each level of detail keeps of its finer level.
+    ///
+    float lodReduction = 0.5f;
+
+    ///
+    /// \brief Sets the maximum simplification error relative to the extent of a mesh.
+    ///
+    /// Levels which can not be simplified within the error are not created.
+    ///
+    float lodTargetError = 0.01f;
+
+    ///
+    /// \brief Sets whether to prune and renormalize the skin weights of skinned meshes.
+    ///
+    /// Enable this to keep at most maxBoneInfluences influences per vertex, to drop influences
+    /// below minBoneWeight and to renormalize the remaining weights, sorted from largest to
+    /// smallest. Reduces the size of the skin clusters.
+    ///
+    bool normalizeSkinWeights = false;
+
+    ///
+    /// \brief Sets the maximum number of bone influences per vertex, e.g. 2 for mobile skinning.
+    ///
+    unsigned maxBoneInfluences = 4;
+
+    ///
+    /// \brief Sets the minimum weight of a bone influence, the largest influence is always kept.
+    ///
+    float minBoneWeight = 0.01f;
+
+    ///
+    /// \brief Sets the maximum number of bones per exported mesh.
+    ///
+    /// Skinned meshes referencing more bones are split into partitions named "<mesh>_Part<n>",
+    /// e.g. 64 for skinning shaders with a bone palette of 64 matrices. Partitions follow the
+    /// triangle to bone map of the granny topology if present. Zero disables the partitioning.
+    ///
+    unsigned bonePaletteSize = 0;
+
+    ///
+    /// \brief Sets whether to parent rigid meshes to their bone.
+    ///
+    /// Rigid meshes, e.g. props and weapons, are bound to a single bone. Enable this to
+    /// export them as child nodes of their bone. Otherwise they get a skin with a single
+    /// cluster for their bone.
+    ///
+    bool parentRigidMeshes = false;
+
+    ///
+    /// \brief Sets whether to export tangents and binormals with the meshes.
+    ///
+    /// Tangents are generated compatible to MikkTSpace from the normals and the first uv-set,
+    /// so applications do not need to generate them on import for normal mapping.
+    ///
+    bool generateTangents = false;
+
+    ///
+    /// \brief Sets whether to export a convex collision hull per bone, e.g. for ragdoll proxies.
+    ///
+    /// Each hull encloses the triangles the bone bindings of the meshes assign to the bone.
+    /// Hulls are exported as meshes named "<bone>_Collision", parented to their bone.
+    ///
+    bool exportCollisionHulls = false;
+
+    ///
+    /// \brief Sets the maximum number of vertices per collision hull, zero for no limit.
+    ///
+    unsigned collisionHullMaxVertices = 32;
+
+    ///
+    /// \brief Sets the file path to write the bounds of meshes, models and animations as json.
+    ///
+    /// Models and meshes get a bounding box and a bounding sphere of their vertices. Animations
+    /// get a bounding box per animated model, enclosing the bone bounding boxes of its meshes in
+    /// all sampled poses. Bounds are in the space of the granny file. Leave it empty to disable.
+    ///
+    string boundsFilePath = "";
+
+    ///
+    /// \brief Sets the file path to write trace spans of the export as chrome trace json.
+    ///
+    /// Open the file in chrome://tracing or https://ui.perfetto.dev to see where the
+    /// export time goes. Use the same file path as the import to get a single trace.
+    /// Leave it empty to disable tracing.
+    ///
+    string traceFilePath = "";
 };
 
 } // namespace GCL::Exporter
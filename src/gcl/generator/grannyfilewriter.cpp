@@ -0,0 +1,354 @@
+#include "gcl/generator/grannyfilewriter.h"
+
+#include "gcl/utilities/checksum.h"
+#include "gcl/utilities/logging.h"
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <tuple>
+
+namespace GCL::Generator {
+
+using namespace GCL::Utilities;
+using namespace GCL::Utilities::Logging;
+
+namespace {
+
+///
+/// \brief Magic value of little endian 64 bit granny files of version 7.
+///
+constexpr unsigned char LittleEndian64Magic[16] = {
+    0xe5, 0x9b, 0x49, 0x5e, 0x6f, 0x63, 0x1f, 0x14, 0x1e, 0x13, 0xeb, 0xa9, 0x90, 0xbe, 0xed, 0xc4
+};
+
+constexpr unsigned int GrannyFileVersion = 7;
+
+constexpr size_t SectionAlignment = 4;
+
+///
+/// \brief Serializes a data tree by its type definitions into a single section.
+///
+class SectionWriter {
+public:
+    ///
+    /// \brief Writes count objects of a type and returns their offset in the section.
+    ///
+    uint32_t writeArray(const GrannyDataTypeDefinition* type, const unsigned char* source, int count)
+    {
+        const auto key = make_tuple(static_cast<const void*>(source), type, count);
+        const auto object = m_objects.find(key);
+        if (object != m_objects.end()) {
+            return object->second;
+        }
+
+        const auto objectSize = static_cast<size_t>(getTypeSize(type));
+        const auto offset = allocate(objectSize * static_cast<size_t>(count));
+        m_objects[key] = offset;
+
+        for (auto i = 0; i < count; i++) {
+            writeMembers(type, source + objectSize * static_cast<size_t>(i), offset + static_cast<uint32_t>(objectSize * static_cast<size_t>(i)));
+        }
+
+        return offset;
+    }
+
+    ///
+    /// \brief Writes a type definition and all referenced type definitions.
+    ///
+    uint32_t writeType(const GrannyDataTypeDefinition* type)
+    {
+        const auto writtenType = m_types.find(type);
+        if (writtenType != m_types.end()) {
+            return writtenType->second;
+        }
+
+        size_t memberCount = 1;
+        while (type[memberCount - 1].Type != GrannyEndMember) {
+            memberCount++;
+        }
+
+        const auto offset = allocate(memberCount * sizeof(GrannyDataTypeDefinition));
+
+        // Register before writing the members, type definitions may reference each other.
+        m_types[type] = offset;
+
+        for (size_t i = 0; i < memberCount; i++) {
+            const auto memberOffset = offset + static_cast<uint32_t>(i * sizeof(GrannyDataTypeDefinition));
+
+            auto member = type[i];
+            member.Name = nullptr;
+            member.ReferenceType = nullptr;
+            member.Ignored_Ignored = nullptr;
+            memcpy(&m_data[memberOffset], &member, sizeof(member));
+
+            if (type[i].Name) {
+                addFixup(memberOffset + offsetof(GrannyDataTypeDefinition, Name), writeString(type[i].Name));
+            }
+
+            if (type[i].ReferenceType) {
+                addFixup(memberOffset + offsetof(GrannyDataTypeDefinition, ReferenceType), writeType(type[i].ReferenceType));
+            }
+        }
+
+        return offset;
+    }
+
+    const vector<unsigned char>& getData() const
+    {
+        return m_data;
+    }
+
+    const vector<GrannyGRNPointerFixup>& getFixups() const
+    {
+        return m_fixups;
+    }
+
+private:
+    uint32_t allocate(size_t size)
+    {
+        const auto offset = (m_data.size() + SectionAlignment - 1) & ~(SectionAlignment - 1);
+        m_data.resize(offset + size);
+
+        return static_cast<uint32_t>(offset);
+    }
+
+    void addFixup(size_t fromOffset, uint32_t toOffset)
+    {
+        m_fixups.push_back({ static_cast<unsigned int>(fromOffset), { GrannyStandardMainSection, toOffset } });
+    }
+
+    uint32_t writeString(const char* text)
+    {
+        const auto writtenString = m_strings.find(text);
+        if (writtenString != m_strings.end()) {
+            return writtenString->second;
+        }
+
+        const auto length = strlen(text) + 1;
+        const auto offset = allocate(length);
+        memcpy(&m_data[offset], text, length);
+        m_strings[text] = offset;
+
+        return offset;
+    }
+
+    template <typename Type>
+    static Type read(const unsigned char* source)
+    {
+        // Members of granny structures are packed and may be unaligned.
+        Type value;
+        memcpy(&value, source, sizeof(Type));
+        return value;
+    }
+
+    void writeMembers(const GrannyDataTypeDefinition* type, const unsigned char* source, uint32_t offset)
+    {
+        for (auto member = type; member->Type != GrannyEndMember; member++) {
+            const auto memberSize = getMemberSize(*member);
+            const auto elementCount = max(member->ArrayWidth, 1);
+            const auto elementSize = memberSize / elementCount;
+
+            for (auto element = 0; element < elementCount; element++) {
+                writeMember(*member, source + element * elementSize, offset + static_cast<uint32_t>(element * elementSize), elementSize);
+            }
+
+            source += memberSize;
+            offset += static_cast<uint32_t>(memberSize);
+        }
+    }
+
+    void writeMember(const GrannyDataTypeDefinition& member, const unsigned char* source, uint32_t offset, int size)
+    {
+        switch (member.Type) {
+        case GrannyInlineMember:
+            writeMembers(member.ReferenceType, source, offset);
+            break;
+
+        case GrannyReferenceMember: {
+            const auto object = read<const unsigned char*>(source);
+            if (object) {
+                addFixup(offset, writeArray(member.ReferenceType, object, 1));
+            }
+            break;
+        }
+
+        case GrannyStringMember: {
+            const auto text = read<const char*>(source);
+            if (text) {
+                addFixup(offset, writeString(text));
+            }
+            break;
+        }
+
+        case GrannyReferenceToArrayMember: {
+            const auto count = read<int>(source);
+            const auto objects = read<const unsigned char*>(source + sizeof(int));
+            memcpy(&m_data[offset], &count, sizeof(count));
+
+            if (count > 0 && objects) {
+                addFixup(offset + sizeof(int), writeArray(member.ReferenceType, objects, count));
+            }
+            break;
+        }
+
+        case GrannyArrayOfReferencesMember: {
+            const auto count = read<int>(source);
+            const auto references = read<const unsigned char*>(source + sizeof(int));
+            memcpy(&m_data[offset], &count, sizeof(count));
+
+            if (count > 0 && references) {
+                const auto arrayOffset = allocate(static_cast<size_t>(count) * sizeof(void*));
+
+                for (auto i = 0; i < count; i++) {
+                    const auto object = read<const unsigned char*>(references + static_cast<size_t>(i) * sizeof(void*));
+                    if (object) {
+                        addFixup(arrayOffset + static_cast<size_t>(i) * sizeof(void*), writeArray(member.ReferenceType, object, 1));
+                    }
+                }
+
+                addFixup(offset + sizeof(int), arrayOffset);
+            }
+            break;
+        }
+
+        case GrannyVariantReferenceMember: {
+            const auto type = read<const GrannyDataTypeDefinition*>(source);
+            const auto object = read<const unsigned char*>(source + sizeof(void*));
+
+            if (type) {
+                addFixup(offset, writeType(type));
+
+                if (object) {
+                    addFixup(offset + sizeof(void*), writeArray(type, object, 1));
+                }
+            }
+            break;
+        }
+
+        case GrannyReferenceToVariantArrayMember: {
+            const auto type = read<const GrannyDataTypeDefinition*>(source);
+            const auto count = read<int>(source + sizeof(void*));
+            const auto objects = read<const unsigned char*>(source + sizeof(void*) + sizeof(int));
+            memcpy(&m_data[offset + sizeof(void*)], &count, sizeof(count));
+
+            if (type) {
+                addFixup(offset, writeType(type));
+
+                if (count > 0 && objects) {
+                    addFixup(offset + sizeof(void*) + sizeof(int), writeArray(type, objects, count));
+                }
+            }
+            break;
+        }
+
+        case GrannyEmptyReferenceMember:
+            break;
+
+        default:
+            memcpy(&m_data[offset], source, static_cast<size_t>(size));
+            break;
+        }
+    }
+
+private:
+    vector<unsigned char> m_data;
+    vector<GrannyGRNPointerFixup> m_fixups;
+    map<tuple<const void*, const GrannyDataTypeDefinition*, int>, uint32_t> m_objects;
+    map<const GrannyDataTypeDefinition*, uint32_t> m_types;
+    map<string, uint32_t> m_strings;
+};
+
+template <typename Type>
+void writeValue(vector<unsigned char>& output, size_t offset, const Type& value)
+{
+    memcpy(&output[offset], &value, sizeof(Type));
+}
+
+} // namespace
+
+vector<unsigned char> encodeGrannyFile(const void* rootObject, GrannyDataTypeDefinition* rootType)
+{
+    SectionWriter sectionWriter;
+    const auto rootObjectOffset = sectionWriter.writeArray(rootType, static_cast<const unsigned char*>(rootObject), 1);
+    const auto rootTypeOffset = sectionWriter.writeType(rootType);
+
+    const auto& sectionData = sectionWriter.getData();
+    const auto& fixups = sectionWriter.getFixups();
+
+    const auto headerOffset = sizeof(GrannyFileMagic);
+    const auto sectionArrayOffset = headerOffset + sizeof(GrannyFileHeader);
+    const auto headerSize = sectionArrayOffset + GrannyStandardSectionCount * sizeof(GrannyGRNSection);
+    const auto dataOffset = (headerSize + SectionAlignment - 1) & ~(SectionAlignment - 1);
+    const auto fixupOffset = (dataOffset + sectionData.size() + SectionAlignment - 1) & ~(SectionAlignment - 1);
+    const auto fileSize = fixupOffset + fixups.size() * sizeof(GrannyGRNPointerFixup);
+
+    vector<unsigned char> output(fileSize);
+
+    GrannyFileMagic magic = {};
+    memcpy(magic.MagicValue, LittleEndian64Magic, sizeof(magic.MagicValue));
+    magic.HeaderSize = static_cast<unsigned int>(headerSize);
+    writeValue(output, 0, magic);
+
+    for (unsigned sectionIndex = 0; sectionIndex < GrannyStandardSectionCount; sectionIndex++) {
+        GrannyGRNSection section = {};
+        section.InternalAlignment = SectionAlignment;
+
+        if (sectionIndex == GrannyStandardMainSection) {
+            section.DataOffset = static_cast<unsigned int>(dataOffset);
+            section.DataSize = static_cast<unsigned int>(sectionData.size());
+            section.PointerFixupArrayOffset = static_cast<unsigned int>(fixupOffset);
+            section.PointerFixupArrayCount = static_cast<unsigned int>(fixups.size());
+        } else {
+            section.DataOffset = static_cast<unsigned int>(fixupOffset);
+            section.PointerFixupArrayOffset = static_cast<unsigned int>(fileSize);
+        }
+
+        section.ExpandedDataSize = section.DataSize;
+        section.First16Bit = section.DataSize;
+        section.First8Bit = section.DataSize;
+        section.MixedMarshallingFixupArrayOffset = static_cast<unsigned int>(fileSize);
+
+        writeValue(output, sectionArrayOffset + sectionIndex * sizeof(GrannyGRNSection), section);
+    }
+
+    if (!sectionData.empty()) {
+        memcpy(&output[dataOffset], sectionData.data(), sectionData.size());
+    }
+
+    if (!fixups.empty()) {
+        memcpy(&output[fixupOffset], fixups.data(), fixups.size() * sizeof(GrannyGRNPointerFixup));
+    }
+
+    GrannyFileHeader header = {};
+    header.Version = GrannyFileVersion;
+    header.TotalSize = static_cast<unsigned int>(fileSize);
+    header.CRC = crc32(output.data() + headerSize, fileSize - headerSize);
+    header.SectionArrayOffset = static_cast<unsigned int>(sectionArrayOffset - headerOffset);
+    header.SectionArrayCount = GrannyStandardSectionCount;
+    header.RootObjectTypeDefinition = { GrannyStandardMainSection, rootTypeOffset };
+    header.RootObject = { GrannyStandardMainSection, rootObjectOffset };
+    header.TypeTag = GrannyEmbeddedTypeTag;
+    writeValue(output, headerOffset, header);
+
+    return output;
+}
+
+bool writeGrannyFile(const string& filePath, const GrannyFileInfo* fileInfo)
+{
+    const auto data = encodeGrannyFile(fileInfo, FileInfoType);
+
+    ofstream file(filesystem::u8path(filePath), ios::binary);
+    if (!file) {
+        warning("Failed to open \"%s\" for writing.", filePath.c_str());
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<streamsize>(data.size()));
+
+    return static_cast<bool>(file);
+}
+
+} // namespace GCL::Generator
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "gcl/generator/grannytypes.h"
+#include "gcl/importer/grannyformat.h"
+
+#include <string>
+#include <vector>
+
+namespace GCL::Generator {
+
+using namespace std;
+
+///
+/// \brief Type tag written to the file header.
+///
+/// Standard tags of granny builds have the high bit set, so this tag never matches the
+/// build that loads the file and the file is always converted by its embedded type
+/// definitions instead of being read as the structures of a particular granny build.
+///
+constexpr unsigned int GrannyEmbeddedTypeTag = 0x0;
+
+///
+/// \brief Encodes a granny data tree as uncompressed little endian 64 bit granny file (version 7).
+///
+/// The tree is written by its type definition into the main section together with the
+/// type definition itself. Pointers are stored as pointer fixups and objects referenced
+/// multiple times are written once. All other standard sections are empty.
+///
+/// \param rootObject Root object of the tree, e.g. a GrannyFileInfo.
+/// \param rootType Type definition of the root object.
+/// \return Encoded granny file.
+///
+vector<unsigned char> encodeGrannyFile(const void* rootObject, GrannyDataTypeDefinition* rootType);
+
+///
+/// \brief Writes a granny file info as uncompressed granny file.
+/// \param filePath Path of the granny file.
+/// \param fileInfo File info to write.
+/// \return Returns whether the file was written.
+///
+bool writeGrannyFile(const string& filePath, const GrannyFileInfo* fileInfo);
+
+} // namespace GCL::Generator
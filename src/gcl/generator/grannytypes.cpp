@@ -0,0 +1,421 @@
+#include "gcl/generator/grannytypes.h"
+
+#include <algorithm>
+
+namespace GCL::Generator {
+
+GrannyDataTypeDefinition Real32Type[] = {
+    { GrannyReal32Member, "Real32" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition Int32Type[] = {
+    { GrannyInt32Member, "Int32" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition UInt32Type[] = {
+    { GrannyUInt32Member, "UInt32" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition UInt16Type[] = {
+    { GrannyUInt16Member, "UInt16" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition UInt8Type[] = {
+    { GrannyUInt8Member, "UInt8" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition StringType[] = {
+    { GrannyStringMember, "String" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition CurveDataHeaderType[] = {
+    { GrannyUInt8Member, "Format" },
+    { GrannyUInt8Member, "Degree" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition CurveDataDaK32fC32fType[] = {
+    { GrannyInlineMember, "CurveDataHeader_DaK32fC32f", CurveDataHeaderType },
+    { GrannyInt16Member, "Padding" },
+    { GrannyReferenceToArrayMember, "Knots", Real32Type },
+    { GrannyReferenceToArrayMember, "Controls", Real32Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition CurveDataDaK16uC16uType[] = {
+    { GrannyInlineMember, "CurveDataHeader_DaK16uC16u", CurveDataHeaderType },
+    { GrannyUInt16Member, "OneOverKnotScaleTrunc" },
+    { GrannyReferenceToArrayMember, "ControlScaleOffsets", Real32Type },
+    { GrannyReferenceToArrayMember, "KnotsControls", UInt16Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition CurveDataDaIdentityType[] = {
+    { GrannyInlineMember, "CurveDataHeader_DaIdentity", CurveDataHeaderType },
+    { GrannyInt16Member, "Dimension" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition Curve2Type[] = {
+    { GrannyVariantReferenceMember, "CurveData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition ArtToolInfoType[] = {
+    { GrannyStringMember, "FromArtToolName" },
+    { GrannyInt32Member, "ArtToolMajorRevision" },
+    { GrannyInt32Member, "ArtToolMinorRevision" },
+    { GrannyInt32Member, "ArtToolPointerSize" },
+    { GrannyReal32Member, "UnitsPerMeter" },
+    { GrannyReal32Member, "Origin", nullptr, 3 },
+    { GrannyReal32Member, "RightVector", nullptr, 3 },
+    { GrannyReal32Member, "UpVector", nullptr, 3 },
+    { GrannyReal32Member, "BackVector", nullptr, 3 },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition ExporterInfoType[] = {
+    { GrannyStringMember, "ExporterName" },
+    { GrannyInt32Member, "ExporterMajorRevision" },
+    { GrannyInt32Member, "ExporterMinorRevision" },
+    { GrannyInt32Member, "ExporterCustomization" },
+    { GrannyInt32Member, "ExporterBuildNumber" },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition PixelLayoutType[] = {
+    { GrannyInt32Member, "BytesPerPixel" },
+    { GrannyInt32Member, "ShiftForComponent", nullptr, 4 },
+    { GrannyInt32Member, "BitsForComponent", nullptr, 4 },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TextureMIPLevelType[] = {
+    { GrannyInt32Member, "Stride" },
+    { GrannyReferenceToArrayMember, "PixelBytes", UInt8Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TextureImageType[] = {
+    { GrannyReferenceToArrayMember, "MIPLevels", TextureMIPLevelType },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TextureType[] = {
+    { GrannyStringMember, "FromFileName" },
+    { GrannyInt32Member, "TextureType" },
+    { GrannyInt32Member, "Width" },
+    { GrannyInt32Member, "Height" },
+    { GrannyInt32Member, "Encoding" },
+    { GrannyInt32Member, "SubFormat" },
+    { GrannyInlineMember, "Layout", PixelLayoutType },
+    { GrannyReferenceToArrayMember, "Images", TextureImageType },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition MaterialMapType[] = {
+    { GrannyStringMember, "Usage" },
+    { GrannyReferenceMember, "Material", MaterialType },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition MaterialType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceToArrayMember, "Maps", MaterialMapType },
+    { GrannyReferenceMember, "Texture", TextureType },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition BoneType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyInt32Member, "ParentIndex" },
+    { GrannyTransformMember, "LocalTransform" },
+    { GrannyReal32Member, "InverseWorld4x4", nullptr, 16 },
+    { GrannyReal32Member, "LODError" },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition SkeletonType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceToArrayMember, "Bones", BoneType },
+    { GrannyInt32Member, "LODType" },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition VertexAnnotationSetType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceToVariantArrayMember, "VertexAnnotations" },
+    { GrannyInt32Member, "IndicesMapFromVertexToAnnotation" },
+    { GrannyReferenceToArrayMember, "VertexAnnotationIndices", Int32Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition VertexDataType[] = {
+    { GrannyReferenceToVariantArrayMember, "Vertices" },
+    { GrannyReferenceToArrayMember, "VertexComponentNames", StringType },
+    { GrannyReferenceToArrayMember, "VertexAnnotationSets", VertexAnnotationSetType },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TriMaterialGroupType[] = {
+    { GrannyInt32Member, "MaterialIndex" },
+    { GrannyInt32Member, "TriFirst" },
+    { GrannyInt32Member, "TriCount" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TriAnnotationSetType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceToVariantArrayMember, "TriAnnotations" },
+    { GrannyInt32Member, "IndicesMapFromTriToAnnotation" },
+    { GrannyReferenceToArrayMember, "TriAnnotationIndices", Int32Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TriTopologyType[] = {
+    { GrannyReferenceToArrayMember, "Groups", TriMaterialGroupType },
+    { GrannyReferenceToArrayMember, "Indices", Int32Type },
+    { GrannyReferenceToArrayMember, "Indices16", UInt16Type },
+    { GrannyReferenceToArrayMember, "VertexToVertexMap", Int32Type },
+    { GrannyReferenceToArrayMember, "VertexToTriangleMap", Int32Type },
+    { GrannyReferenceToArrayMember, "SideToNeighborMap", UInt32Type },
+    { GrannyReferenceToArrayMember, "BonesForTriangle", Int32Type },
+    { GrannyReferenceToArrayMember, "TriangleToBoneIndices", Int32Type },
+    { GrannyReferenceToArrayMember, "TriAnnotationSets", TriAnnotationSetType },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition MorphTargetType[] = {
+    { GrannyStringMember, "ScalarName" },
+    { GrannyReferenceMember, "VertexData", VertexDataType },
+    { GrannyInt32Member, "DataIsDeltas" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition MaterialBindingType[] = {
+    { GrannyReferenceMember, "Material", MaterialType },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition BoneBindingType[] = {
+    { GrannyStringMember, "BoneName" },
+    { GrannyReal32Member, "OBBMin", nullptr, 3 },
+    { GrannyReal32Member, "OBBMax", nullptr, 3 },
+    { GrannyReferenceToArrayMember, "TriangleIndices", Int32Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition MeshType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceMember, "PrimaryVertexData", VertexDataType },
+    { GrannyReferenceToArrayMember, "MorphTargets", MorphTargetType },
+    { GrannyReferenceMember, "PrimaryTopology", TriTopologyType },
+    { GrannyReferenceToArrayMember, "MaterialBindings", MaterialBindingType },
+    { GrannyReferenceToArrayMember, "BoneBindings", BoneBindingType },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition ModelMeshBindingType[] = {
+    { GrannyReferenceMember, "Mesh", MeshType },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition ModelType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceMember, "Skeleton", SkeletonType },
+    { GrannyTransformMember, "InitialPlacement" },
+    { GrannyReferenceToArrayMember, "MeshBindings", ModelMeshBindingType },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition VectorTrackType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyUInt32Member, "TrackKey" },
+    { GrannyInt32Member, "Dimension" },
+    { GrannyInlineMember, "ValueCurve", Curve2Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TransformTrackType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyInt32Member, "Flags" },
+    { GrannyInlineMember, "OrientationCurve", Curve2Type },
+    { GrannyInlineMember, "PositionCurve", Curve2Type },
+    { GrannyInlineMember, "ScaleShearCurve", Curve2Type },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TextTrackEntryType[] = {
+    { GrannyReal32Member, "TimeStamp" },
+    { GrannyStringMember, "Text" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TextTrackType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceToArrayMember, "Entries", TextTrackEntryType },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition PeriodicLoopType[] = {
+    { GrannyReal32Member, "Radius" },
+    { GrannyReal32Member, "dAngle" },
+    { GrannyReal32Member, "dZ" },
+    { GrannyReal32Member, "BasisX", nullptr, 3 },
+    { GrannyReal32Member, "BasisY", nullptr, 3 },
+    { GrannyReal32Member, "Axis", nullptr, 3 },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition TrackGroupType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReferenceToArrayMember, "VectorTracks", VectorTrackType },
+    { GrannyReferenceToArrayMember, "TransformTracks", TransformTrackType },
+    { GrannyReferenceToArrayMember, "TransformLODErrors", Real32Type },
+    { GrannyReferenceToArrayMember, "TextTracks", TextTrackType },
+    { GrannyTransformMember, "InitialPlacement" },
+    { GrannyInt32Member, "Flags" },
+    { GrannyReal32Member, "LoopTranslation", nullptr, 3 },
+    { GrannyReferenceMember, "PeriodicLoop", PeriodicLoopType },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition AnimationType[] = {
+    { GrannyStringMember, "Name" },
+    { GrannyReal32Member, "Duration" },
+    { GrannyReal32Member, "TimeStep" },
+    { GrannyReal32Member, "Oversampling" },
+    { GrannyArrayOfReferencesMember, "TrackGroups", TrackGroupType },
+    { GrannyInt32Member, "DefaultLoopCount" },
+    { GrannyInt32Member, "Flags" },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition FileInfoType[] = {
+    { GrannyReferenceMember, "ArtToolInfo", ArtToolInfoType },
+    { GrannyReferenceMember, "ExporterInfo", ExporterInfoType },
+    { GrannyStringMember, "FromFileName" },
+    { GrannyArrayOfReferencesMember, "Textures", TextureType },
+    { GrannyArrayOfReferencesMember, "Materials", MaterialType },
+    { GrannyArrayOfReferencesMember, "Skeletons", SkeletonType },
+    { GrannyArrayOfReferencesMember, "VertexDatas", VertexDataType },
+    { GrannyArrayOfReferencesMember, "TriTopologies", TriTopologyType },
+    { GrannyArrayOfReferencesMember, "Meshes", MeshType },
+    { GrannyArrayOfReferencesMember, "Models", ModelType },
+    { GrannyArrayOfReferencesMember, "TrackGroups", TrackGroupType },
+    { GrannyArrayOfReferencesMember, "Animations", AnimationType },
+    { GrannyVariantReferenceMember, "ExtendedData" },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition PNT332VertexType[] = {
+    { GrannyReal32Member, "Position", nullptr, 3 },
+    { GrannyReal32Member, "Normal", nullptr, 3 },
+    { GrannyReal32Member, GrannyVertexTextureCoordinatesName "0", nullptr, 2 },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition PWNT3432VertexType[] = {
+    { GrannyReal32Member, "Position", nullptr, 3 },
+    { GrannyNormalUInt8Member, "BoneWeights", nullptr, 4 },
+    { GrannyUInt8Member, "BoneIndices", nullptr, 4 },
+    { GrannyReal32Member, "Normal", nullptr, 3 },
+    { GrannyReal32Member, GrannyVertexTextureCoordinatesName "0", nullptr, 2 },
+    { GrannyEndMember },
+};
+
+GrannyDataTypeDefinition PWNT34322VertexType[] = {
+    { GrannyReal32Member, "Position", nullptr, 3 },
+    { GrannyNormalUInt8Member, "BoneWeights", nullptr, 4 },
+    { GrannyUInt8Member, "BoneIndices", nullptr, 4 },
+    { GrannyReal32Member, "Normal", nullptr, 3 },
+    { GrannyReal32Member, GrannyVertexTextureCoordinatesName "0", nullptr, 3 },
+    { GrannyReal32Member, GrannyVertexTextureCoordinatesName "1", nullptr, 3 },
+    { GrannyReal32Member, GrannyVertexTextureCoordinatesName "2", nullptr, 3 },
+    { GrannyReal32Member, "TextureCoordinateslighting", nullptr, 3 },
+    { GrannyReal32Member, "colourSet1", nullptr, 3 },
+    { GrannyReal32Member, "colourSet2", nullptr, 3 },
+    { GrannyReal32Member, "blend_shape", nullptr, 3 },
+    { GrannyReal32Member, "TextureCoordinates_vertex_id", nullptr, 2 },
+    { GrannyEndMember },
+};
+
+int getMemberSize(const GrannyDataTypeDefinition& member)
+{
+    int size = 0;
+
+    switch (member.Type) {
+    case GrannyInlineMember:
+        size = getTypeSize(member.ReferenceType);
+        break;
+    case GrannyReferenceMember:
+    case GrannyStringMember:
+    case GrannyEmptyReferenceMember:
+        size = static_cast<int>(sizeof(void*));
+        break;
+    case GrannyReferenceToArrayMember:
+    case GrannyArrayOfReferencesMember:
+        size = static_cast<int>(sizeof(int) + sizeof(void*));
+        break;
+    case GrannyVariantReferenceMember:
+        size = static_cast<int>(sizeof(GrannyVariant));
+        break;
+    case GrannyReferenceToVariantArrayMember:
+        size = static_cast<int>(sizeof(void*) + sizeof(int) + sizeof(void*));
+        break;
+    case GrannyTransformMember:
+        size = static_cast<int>(sizeof(GrannyTransform));
+        break;
+    case GrannyReal32Member:
+    case GrannyInt32Member:
+    case GrannyUInt32Member:
+        size = 4;
+        break;
+    case GrannyInt16Member:
+    case GrannyUInt16Member:
+    case GrannyBinormalInt16Member:
+    case GrannyNormalUInt16Member:
+    case GrannyReal16Member:
+        size = 2;
+        break;
+    case GrannyInt8Member:
+    case GrannyUInt8Member:
+    case GrannyBinormalInt8Member:
+    case GrannyNormalUInt8Member:
+        size = 1;
+        break;
+    default:
+        break;
+    }
+
+    return size * max(member.ArrayWidth, 1);
+}
+
+int getTypeSize(const GrannyDataTypeDefinition* type)
+{
+    int size = 0;
+
+    for (auto member = type; member->Type != GrannyEndMember; member++) {
+        size += getMemberSize(*member);
+    }
+
+    return size;
+}
+
+} // namespace GCL::Generator
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+
+namespace GCL::Generator {
+
+// Type definitions of the granny file structures.
+// Members are listed in the order and with the names of the structures in grannyformat.h,
+// which store them packed - each definition describes the memory layout of its structure.
+
+extern GrannyDataTypeDefinition Real32Type[];
+extern GrannyDataTypeDefinition Int32Type[];
+extern GrannyDataTypeDefinition UInt32Type[];
+extern GrannyDataTypeDefinition UInt16Type[];
+extern GrannyDataTypeDefinition UInt8Type[];
+extern GrannyDataTypeDefinition StringType[];
+
+extern GrannyDataTypeDefinition CurveDataHeaderType[];
+extern GrannyDataTypeDefinition CurveDataDaK32fC32fType[];
+extern GrannyDataTypeDefinition CurveDataDaK16uC16uType[];
+extern GrannyDataTypeDefinition CurveDataDaIdentityType[];
+extern GrannyDataTypeDefinition Curve2Type[];
+
+extern GrannyDataTypeDefinition ArtToolInfoType[];
+extern GrannyDataTypeDefinition ExporterInfoType[];
+extern GrannyDataTypeDefinition PixelLayoutType[];
+extern GrannyDataTypeDefinition TextureMIPLevelType[];
+extern GrannyDataTypeDefinition TextureImageType[];
+extern GrannyDataTypeDefinition TextureType[];
+extern GrannyDataTypeDefinition MaterialMapType[];
+extern GrannyDataTypeDefinition MaterialType[];
+extern GrannyDataTypeDefinition BoneType[];
+extern GrannyDataTypeDefinition SkeletonType[];
+extern GrannyDataTypeDefinition VertexAnnotationSetType[];
+extern GrannyDataTypeDefinition VertexDataType[];
+extern GrannyDataTypeDefinition TriMaterialGroupType[];
+extern GrannyDataTypeDefinition TriAnnotationSetType[];
+extern GrannyDataTypeDefinition TriTopologyType[];
+extern GrannyDataTypeDefinition MorphTargetType[];
+extern GrannyDataTypeDefinition MaterialBindingType[];
+extern GrannyDataTypeDefinition BoneBindingType[];
+extern GrannyDataTypeDefinition MeshType[];
+extern GrannyDataTypeDefinition ModelMeshBindingType[];
+extern GrannyDataTypeDefinition ModelType[];
+extern GrannyDataTypeDefinition VectorTrackType[];
+extern GrannyDataTypeDefinition TransformTrackType[];
+extern GrannyDataTypeDefinition TextTrackEntryType[];
+extern GrannyDataTypeDefinition TextTrackType[];
+extern GrannyDataTypeDefinition PeriodicLoopType[];
+extern GrannyDataTypeDefinition TrackGroupType[];
+extern GrannyDataTypeDefinition AnimationType[];
+extern GrannyDataTypeDefinition FileInfoType[];
+
+///
+/// \brief Vertex type with position, normal and one uv channel (GrannyPNT332Vertex).
+///
+extern GrannyDataTypeDefinition PNT332VertexType[];
+
+///
+/// \brief Vertex type of GrannyPWNT3432Vertex.
+///
+extern GrannyDataTypeDefinition PWNT3432VertexType[];
+
+///
+/// \brief Vertex type of GrannyPWNT34322Vertex.
+///
+extern GrannyDataTypeDefinition PWNT34322VertexType[];
+
+///
+/// \brief Returns the size of a structure described by a type definition.
+/// \param type Type definition
+/// \return Size in bytes of the packed members.
+///
+int getTypeSize(const GrannyDataTypeDefinition* type);
+
+///
+/// \brief Returns the size of a member of a type definition.
+/// \param member Member definition
+/// \return Size in bytes including all array elements.
+///
+int getMemberSize(const GrannyDataTypeDefinition& member);
+
+} // namespace GCL::Generator
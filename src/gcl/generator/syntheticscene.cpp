@@ -0,0 +1,652 @@
+#include "gcl/generator/syntheticscene.h"
+
+#include "gcl/generator/grannyfilewriter.h"
+#include "gcl/generator/grannytypes.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace GCL::Generator {
+
+namespace {
+
+constexpr float Pi = 3.14159265358979323846f;
+
+///
+/// \brief Layout of BGRA8888 pixels with alpha.
+///
+constexpr GrannyPixelLayout BGRA8888PixelLayout = { 4, { 16, 8, 0, 24 }, { 8, 8, 8, 8 } };
+
+void setIdentity(GrannyTransform& transform)
+{
+    transform = {};
+    transform.Orientation[3] = 1.0f;
+    transform.ScaleShear[0][0] = 1.0f;
+    transform.ScaleShear[1][1] = 1.0f;
+    transform.ScaleShear[2][2] = 1.0f;
+}
+
+///
+/// \brief Height of the synthetic mesh surface - a wave over the grid.
+///
+float getHeight(float x, float z)
+{
+    return 0.1f * sin(x * 2.0f * Pi) * cos(z * 2.0f * Pi);
+}
+
+unsigned short toBGR565(int red, int green, int blue)
+{
+    return static_cast<unsigned short>(((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3));
+}
+
+} // namespace
+
+SyntheticScene::SyntheticScene(const SyntheticSceneOptions& options)
+    : m_options(options)
+    , m_random(options.seed)
+{
+    m_options.boneCount = max(m_options.boneCount, 1);
+    m_options.meshCount = max(m_options.meshCount, 0);
+    m_options.vertexCount = max(m_options.vertexCount, 4);
+    m_options.materialsPerMesh = max(m_options.materialsPerMesh, 1);
+    m_options.animationCount = max(m_options.animationCount, 0);
+    m_options.animationDuration = max(m_options.animationDuration, 0.0f);
+    m_options.animationTimeStep = max(m_options.animationTimeStep, 1.0f / 1000.0f);
+    m_options.curveDegree = clamp(m_options.curveDegree, 0, 3);
+    m_options.textureCount = max(m_options.textureCount, 0);
+    m_options.textureSize = max(m_options.textureSize, 1);
+
+    createTextures();
+    createSkeleton();
+    createMeshes();
+    createAnimations();
+    createFileInfo();
+}
+
+GrannyFileInfo* SyntheticScene::getFileInfo()
+{
+    return &m_fileInfo;
+}
+
+bool SyntheticScene::writeFile(const string& filePath)
+{
+    return writeGrannyFile(filePath, &m_fileInfo);
+}
+
+const char* SyntheticScene::addString(string text)
+{
+    m_strings.push_back(move(text));
+    return m_strings.back().c_str();
+}
+
+void SyntheticScene::createTextures()
+{
+    for (auto i = 0; i < m_options.textureCount; i++) {
+        m_textures.push_back(createTexture(i));
+    }
+}
+
+GrannyTexture* SyntheticScene::createTexture(int index)
+{
+    const auto isRaw = m_options.textureFormat == TextureFormat::BGRA8888;
+    const auto size = isRaw ? m_options.textureSize : (m_options.textureSize + 3) & ~3;
+
+    auto levelCount = 1;
+    while ((size >> (levelCount - 1)) > 1) {
+        levelCount++;
+    }
+
+    auto texture = allocate<GrannyTexture>();
+    texture->FromFileName = addString("synthetic_texture_" + to_string(index) + ".tga");
+    texture->TextureType = GrannyColorMapTextureType;
+    texture->Width = size;
+    texture->Height = size;
+    texture->ImageCount = 1;
+    texture->Images = allocate<GrannyTextureImage>();
+    texture->Images->MIPLevelCount = levelCount;
+    texture->Images->MIPLevels = allocate<GrannyTextureMIPLevel>(static_cast<size_t>(levelCount));
+
+    if (isRaw) {
+        texture->Encoding = GrannyRawTextureEncoding;
+        texture->Layout = BGRA8888PixelLayout;
+    } else {
+        texture->Encoding = GrannyS3TCTextureEncoding;
+        texture->SubFormat = m_options.textureFormat == TextureFormat::DXT1 ? GrannyS3TCBGR565 : GrannyS3TCBGRA8888InterpolatedAlpha;
+    }
+
+    uniform_int_distribution<int> randomByte(0, 255);
+
+    for (auto level = 0; level < levelCount; level++) {
+        const auto levelSize = max(size >> level, 1);
+        auto& mipLevel = texture->Images->MIPLevels[level];
+
+        if (isRaw) {
+            mipLevel.Stride = levelSize * 4;
+            mipLevel.PixelByteCount = mipLevel.Stride * levelSize;
+
+            auto pixels = allocate<unsigned char>(static_cast<size_t>(mipLevel.PixelByteCount));
+            for (auto y = 0; y < levelSize; y++) {
+                for (auto x = 0; x < levelSize; x++) {
+                    auto pixel = pixels + y * mipLevel.Stride + x * 4;
+                    pixel[0] = static_cast<unsigned char>(x * 255 / levelSize);
+                    pixel[1] = static_cast<unsigned char>(y * 255 / levelSize);
+                    pixel[2] = static_cast<unsigned char>(index * 64 + level * 16);
+                    pixel[3] = static_cast<unsigned char>(randomByte(m_random) | 0x80);
+                }
+            }
+
+            mipLevel.PixelBytes = pixels;
+            continue;
+        }
+
+        // Compressed levels consist of 4x4 blocks, levels below 4x4 pixels use a single block.
+        const auto blockCount = max((levelSize + 3) / 4, 1);
+        const auto blockSize = m_options.textureFormat == TextureFormat::DXT1 ? 8 : 16;
+        mipLevel.Stride = blockCount * blockSize;
+        mipLevel.PixelByteCount = mipLevel.Stride * blockCount;
+
+        auto blocks = allocate<unsigned char>(static_cast<size_t>(mipLevel.PixelByteCount));
+        for (auto y = 0; y < blockCount; y++) {
+            for (auto x = 0; x < blockCount; x++) {
+                auto block = blocks + y * mipLevel.Stride + x * blockSize;
+
+                if (blockSize == 16) {
+                    // Alpha endpoints and random 3 bit alpha indices.
+                    block[0] = 255;
+                    block[1] = static_cast<unsigned char>(randomByte(m_random));
+                    for (auto i = 2; i < 8; i++) {
+                        block[i] = static_cast<unsigned char>(randomByte(m_random));
+                    }
+                    block += 8;
+                }
+
+                // Colour endpoints follow the block position, colour0 > colour1 selects four colour blocks.
+                auto color0 = toBGR565(255, x * 255 / blockCount, y * 255 / blockCount);
+                auto color1 = toBGR565(index * 64, 0, 0);
+                if (color0 <= color1) {
+                    swap(color0, color1);
+                }
+
+                memcpy(block, &color0, sizeof(color0));
+                memcpy(block + 2, &color1, sizeof(color1));
+                for (auto i = 4; i < 8; i++) {
+                    block[i] = static_cast<unsigned char>(randomByte(m_random));
+                }
+            }
+        }
+
+        mipLevel.PixelBytes = blocks;
+    }
+
+    return texture;
+}
+
+void SyntheticScene::createSkeleton()
+{
+    const auto boneCount = m_options.boneCount;
+
+    m_skeleton = allocate<GrannySkeleton>();
+    m_skeleton->Name = addString("synthetic_skeleton");
+    m_skeleton->BoneCount = boneCount;
+    m_skeleton->Bones = allocate<GrannyBone>(static_cast<size_t>(boneCount));
+
+    vector<array<float, 3>> worldPositions(static_cast<size_t>(boneCount));
+    uniform_real_distribution<float> randomOffset(-0.25f, 0.25f);
+
+    for (auto i = 0; i < boneCount; i++) {
+        auto& bone = m_skeleton->Bones[i];
+        bone.Name = addString("bone_" + to_string(i));
+
+        // Bones branch off one of the last few bones to create chains of varying depth.
+        bone.ParentIndex = i == 0 ? GrannyNoParentBone : max(0, i - 1 - static_cast<int>(m_random() % 4));
+
+        setIdentity(bone.LocalTransform);
+        bone.LocalTransform.Flags = GrannyHasPosition;
+        if (i > 0) {
+            bone.LocalTransform.Position[0] = randomOffset(m_random);
+            bone.LocalTransform.Position[1] = 0.5f;
+            bone.LocalTransform.Position[2] = randomOffset(m_random);
+        }
+
+        // Local transforms only translate - the world transform is the sum of all positions up to the root.
+        auto& worldPosition = worldPositions[static_cast<size_t>(i)];
+        for (auto axis = 0; axis < 3; axis++) {
+            worldPosition[axis] = bone.LocalTransform.Position[axis];
+            if (bone.ParentIndex != GrannyNoParentBone) {
+                worldPosition[axis] += worldPositions[static_cast<size_t>(bone.ParentIndex)][axis];
+            }
+        }
+
+        for (auto row = 0; row < 4; row++) {
+            bone.InverseWorld4x4[row][row] = 1.0f;
+        }
+
+        for (auto axis = 0; axis < 3; axis++) {
+            bone.InverseWorld4x4[3][axis] = -worldPosition[axis];
+        }
+    }
+}
+
+void SyntheticScene::createMeshes()
+{
+    for (auto i = 0; i < m_options.meshCount; i++) {
+        m_meshes.push_back(createMesh(i));
+    }
+
+    auto model = allocate<GrannyModel>();
+    model->Name = addString("synthetic_model");
+    model->Skeleton = m_skeleton;
+    setIdentity(model->InitialPlacement);
+    model->MeshBindingCount = static_cast<int>(m_meshes.size());
+    model->MeshBindings = allocate<GrannyModelMeshBinding>(m_meshes.size());
+
+    for (size_t i = 0; i < m_meshes.size(); i++) {
+        model->MeshBindings[i].Mesh = m_meshes[i];
+    }
+
+    m_models.push_back(model);
+}
+
+GrannyMesh* SyntheticScene::createMesh(int meshIndex)
+{
+    const auto gridSize = max(static_cast<int>(ceil(sqrt(static_cast<double>(m_options.vertexCount)))), 2);
+
+    GrannyTriple boundsMin = {};
+    GrannyTriple boundsMax = {};
+
+    auto mesh = allocate<GrannyMesh>();
+    mesh->Name = addString("mesh_" + to_string(meshIndex));
+
+    // Granny structures are packed, so their pointers are not bound to push_back by reference.
+    const auto vertexData = createVertexData(meshIndex, gridSize, boundsMin, boundsMax);
+    const auto topology = createTopology(gridSize);
+    mesh->PrimaryVertexData = vertexData;
+    mesh->PrimaryTopology = topology;
+
+    m_vertexDatas.push_back(vertexData);
+    m_triTopologies.push_back(topology);
+
+    mesh->MaterialBindingCount = m_options.materialsPerMesh;
+    mesh->MaterialBindings = allocate<GrannyMaterialBinding>(static_cast<size_t>(m_options.materialsPerMesh));
+
+    for (auto i = 0; i < m_options.materialsPerMesh; i++) {
+        auto material = allocate<GrannyMaterial>();
+        material->Name = addString("material_" + to_string(meshIndex) + "_" + to_string(i));
+
+        if (!m_textures.empty()) {
+            material->Texture = m_textures[static_cast<size_t>(meshIndex * m_options.materialsPerMesh + i) % m_textures.size()];
+        }
+
+        mesh->MaterialBindings[i].Material = material;
+        m_materials.push_back(material);
+    }
+
+    // Skinned meshes bind a window of up to 256 bones - bone indices of vertices are 8 bit.
+    const auto isRigid = m_options.vertexLayout == VertexLayout::PNT332;
+    const auto bindingCount = isRigid ? 1 : min(m_options.boneCount, 256);
+
+    mesh->BoneBindingCount = bindingCount;
+    mesh->BoneBindings = allocate<GrannyBoneBinding>(static_cast<size_t>(bindingCount));
+
+    for (auto i = 0; i < bindingCount; i++) {
+        auto& boneBinding = mesh->BoneBindings[i];
+        boneBinding.BoneName = m_skeleton->Bones[(meshIndex * bindingCount + i) % m_options.boneCount].Name;
+        memcpy(boneBinding.OBBMin, boundsMin, sizeof(GrannyTriple));
+        memcpy(boneBinding.OBBMax, boundsMax, sizeof(GrannyTriple));
+    }
+
+    return mesh;
+}
+
+GrannyVertexData* SyntheticScene::createVertexData(int meshIndex, int gridSize, GrannyTriple& boundsMin, GrannyTriple& boundsMax)
+{
+    const auto vertexCount = gridSize * gridSize;
+    const auto bindingCount = min(m_options.boneCount, 256);
+
+    auto vertexData = allocate<GrannyVertexData>();
+    vertexData->VertexCount = vertexCount;
+
+    switch (m_options.vertexLayout) {
+    case VertexLayout::PNT332:
+        vertexData->VertexType = PNT332VertexType;
+        break;
+    case VertexLayout::PWNT3432:
+        vertexData->VertexType = PWNT3432VertexType;
+        break;
+    case VertexLayout::PWNT34322:
+        vertexData->VertexType = PWNT34322VertexType;
+        break;
+    }
+
+    const auto vertexSize = static_cast<size_t>(getTypeSize(vertexData->VertexType));
+    vertexData->Vertices = allocate<unsigned char>(vertexSize * static_cast<size_t>(vertexCount));
+
+    auto componentCount = 0;
+    while (vertexData->VertexType[componentCount].Type != GrannyEndMember) {
+        componentCount++;
+    }
+
+    vertexData->VertexComponentNameCount = componentCount;
+    vertexData->VertexComponentNames = allocate<char*>(static_cast<size_t>(componentCount));
+    for (auto i = 0; i < componentCount; i++) {
+        vertexData->VertexComponentNames[i] = const_cast<char*>(addString(vertexData->VertexType[i].Name));
+    }
+
+    for (auto axis = 0; axis < 3; axis++) {
+        boundsMin[axis] = INFINITY;
+        boundsMax[axis] = -INFINITY;
+    }
+
+    for (auto row = 0; row < gridSize; row++) {
+        for (auto column = 0; column < gridSize; column++) {
+            const auto u = static_cast<float>(column) / static_cast<float>(gridSize - 1);
+            const auto v = static_cast<float>(row) / static_cast<float>(gridSize - 1);
+
+            // Meshes are placed next to each other along the x axis.
+            const float position[3] = { static_cast<float>(meshIndex) * 1.25f + u, getHeight(u, v), v };
+
+            // Normal of the height field from its partial derivatives.
+            const auto dx = 0.2f * Pi * cos(u * 2.0f * Pi) * cos(v * 2.0f * Pi);
+            const auto dz = -0.2f * Pi * sin(u * 2.0f * Pi) * sin(v * 2.0f * Pi);
+            const auto length = sqrt(dx * dx + 1.0f + dz * dz);
+            const float normal[3] = { -dx / length, 1.0f / length, -dz / length };
+
+            const float uv[2] = { u, v };
+
+            for (auto axis = 0; axis < 3; axis++) {
+                boundsMin[axis] = min(boundsMin[axis], position[axis]);
+                boundsMax[axis] = max(boundsMax[axis], position[axis]);
+            }
+
+            // Skinned vertices blend the bones bound to the neighbouring grid columns.
+            const auto boneIndex = column * bindingCount / gridSize;
+            const unsigned char boneWeights[4] = { 128, 64, 32, 31 };
+            const unsigned char boneIndices[4] = {
+                static_cast<unsigned char>(boneIndex),
+                static_cast<unsigned char>(min(boneIndex + 1, bindingCount - 1)),
+                static_cast<unsigned char>(max(boneIndex - 1, 0)),
+                static_cast<unsigned char>(min(boneIndex + 2, bindingCount - 1))
+            };
+
+            auto vertexPointer = vertexData->Vertices + static_cast<size_t>(row * gridSize + column) * vertexSize;
+
+            switch (m_options.vertexLayout) {
+            case VertexLayout::PNT332: {
+                GrannyPNT332Vertex vertex = {};
+                memcpy(vertex.Position, position, sizeof(position));
+                memcpy(vertex.Normal, normal, sizeof(normal));
+                memcpy(vertex.UV, uv, sizeof(uv));
+                memcpy(vertexPointer, &vertex, sizeof(vertex));
+                break;
+            }
+
+            case VertexLayout::PWNT3432: {
+                GrannyPWNT3432Vertex vertex = {};
+                memcpy(vertex.Position, position, sizeof(position));
+                memcpy(vertex.BoneWeights, boneWeights, sizeof(boneWeights));
+                memcpy(vertex.BoneIndices, boneIndices, sizeof(boneIndices));
+                memcpy(vertex.Normal, normal, sizeof(normal));
+                memcpy(vertex.UV, uv, sizeof(uv));
+                memcpy(vertexPointer, &vertex, sizeof(vertex));
+                break;
+            }
+
+            case VertexLayout::PWNT34322: {
+                GrannyPWNT34322Vertex vertex = {};
+                memcpy(vertex.Position, position, sizeof(position));
+                memcpy(vertex.BoneWeights, boneWeights, sizeof(boneWeights));
+                memcpy(vertex.BoneIndices, boneIndices, sizeof(boneIndices));
+                memcpy(vertex.Normal, normal, sizeof(normal));
+                memcpy(vertex.UV1, uv, sizeof(uv));
+                memcpy(vertex.UV2, uv, sizeof(uv));
+                memcpy(vertex.UV3, uv, sizeof(uv));
+                memcpy(vertex.TextureCoordinateslighting, uv, sizeof(uv));
+                vertex.colourSet1[0] = u;
+                vertex.colourSet1[1] = v;
+                vertex.colourSet1[2] = 1.0f;
+                vertex.colourSet2[0] = 1.0f;
+                vertex.TextureCoordinates_vertex_id[0] = static_cast<float>(row * gridSize + column);
+                memcpy(vertexPointer, &vertex, sizeof(vertex));
+                break;
+            }
+            }
+        }
+    }
+
+    return vertexData;
+}
+
+GrannyTriTopology* SyntheticScene::createTopology(int gridSize)
+{
+    const auto cellCount = (gridSize - 1) * (gridSize - 1);
+    const auto triangleCount = cellCount * 2;
+    const auto indexCount = triangleCount * 3;
+    const auto materialCount = m_options.materialsPerMesh;
+
+    auto topology = allocate<GrannyTriTopology>();
+
+    // Material groups split the triangles into contiguous ranges.
+    topology->GroupCount = materialCount;
+    topology->Groups = allocate<GrannyTriMaterialGroup>(static_cast<size_t>(materialCount));
+
+    for (auto i = 0; i < materialCount; i++) {
+        const auto first = triangleCount * i / materialCount;
+        const auto last = triangleCount * (i + 1) / materialCount;
+        topology->Groups[i] = { i, first, last - first };
+    }
+
+    vector<int> indices;
+    indices.reserve(static_cast<size_t>(indexCount));
+
+    for (auto row = 0; row < gridSize - 1; row++) {
+        for (auto column = 0; column < gridSize - 1; column++) {
+            const auto topLeft = row * gridSize + column;
+            const auto bottomLeft = topLeft + gridSize;
+
+            indices.insert(indices.end(), { topLeft, bottomLeft, topLeft + 1 });
+            indices.insert(indices.end(), { topLeft + 1, bottomLeft, bottomLeft + 1 });
+        }
+    }
+
+    // Small meshes store 16 bit indices like the granny exporter.
+    if (gridSize * gridSize <= 0x10000) {
+        topology->Index16Count = indexCount;
+        topology->Indices16 = allocate<unsigned short>(static_cast<size_t>(indexCount));
+        transform(indices.begin(), indices.end(), topology->Indices16, [](int index) {
+            return static_cast<unsigned short>(index);
+        });
+    } else {
+        topology->IndexCount = indexCount;
+        topology->Indices = allocate<int>(static_cast<size_t>(indexCount));
+        copy(indices.begin(), indices.end(), topology->Indices);
+    }
+
+    return topology;
+}
+
+void SyntheticScene::createAnimations()
+{
+    const auto boneCount = m_options.boneCount;
+
+    for (auto animationIndex = 0; animationIndex < m_options.animationCount; animationIndex++) {
+        auto trackGroup = allocate<GrannyTrackGroup>();
+        trackGroup->Name = const_cast<char*>(addString("synthetic_model"));
+        trackGroup->TransformTrackCount = boneCount;
+        trackGroup->TransformTracks = allocate<GrannyTransformTrack>(static_cast<size_t>(boneCount));
+        setIdentity(trackGroup->InitialPlacement);
+
+        for (auto i = 0; i < boneCount; i++) {
+            auto& track = trackGroup->TransformTracks[i];
+            track.Name = m_skeleton->Bones[i].Name;
+            track.OrientationCurve = createCurve(4, i, true);
+            track.PositionCurve = createCurve(3, i, false);
+            track.ScaleShearCurve = createIdentityCurve(9);
+        }
+
+        auto animation = allocate<GrannyAnimation>();
+        animation->Name = addString("animation_" + to_string(animationIndex));
+        animation->Duration = m_options.animationDuration;
+        animation->TimeStep = m_options.animationTimeStep;
+        animation->Oversampling = 1.0f;
+        animation->TrackGroupCount = 1;
+        animation->TrackGroups = allocate<GrannyTrackGroup*>();
+        animation->TrackGroups[0] = trackGroup;
+        animation->DefaultLoopCount = 1;
+
+        m_trackGroups.push_back(trackGroup);
+        m_animations.push_back(animation);
+    }
+}
+
+GrannyCurve2 SyntheticScene::createCurve(int dimension, int boneIndex, bool isOrientation)
+{
+    if (m_options.curveFormat == CurveFormat::DaIdentity) {
+        return createIdentityCurve(dimension);
+    }
+
+    const auto& bone = m_skeleton->Bones[boneIndex];
+    const auto duration = m_options.animationDuration;
+    const auto knotCount = static_cast<int>(round(duration / m_options.animationTimeStep)) + 1;
+    const auto phase = static_cast<float>(boneIndex) * 0.37f;
+
+    // Sample the bone motion - a swing around the y axis and a small circle around the rest position.
+    vector<float> knots(static_cast<size_t>(knotCount));
+    vector<float> controls(static_cast<size_t>(knotCount * dimension));
+
+    for (auto knot = 0; knot < knotCount; knot++) {
+        const auto time = knotCount > 1 ? duration * static_cast<float>(knot) / static_cast<float>(knotCount - 1) : 0.0f;
+        const auto angle = 2.0f * Pi * time / max(duration, 0.001f) + phase;
+        auto control = &controls[static_cast<size_t>(knot * dimension)];
+
+        knots[static_cast<size_t>(knot)] = time;
+
+        if (isOrientation) {
+            const auto halfAngle = 0.25f * sin(angle);
+            control[0] = 0.0f;
+            control[1] = sin(halfAngle);
+            control[2] = 0.0f;
+            control[3] = cos(halfAngle);
+        } else {
+            control[0] = bone.LocalTransform.Position[0] + 0.05f * cos(angle);
+            control[1] = bone.LocalTransform.Position[1];
+            control[2] = bone.LocalTransform.Position[2] + 0.05f * sin(angle);
+        }
+    }
+
+    GrannyCurve2 curve = {};
+
+    if (m_options.curveFormat == CurveFormat::DaK32fC32f) {
+        auto curveData = allocate<GrannyCurveDataDAK32fC32f>();
+        curveData->CurveDataHeader = { DaK32fC32f, static_cast<unsigned char>(m_options.curveDegree) };
+        curveData->KnotCount = knotCount;
+        curveData->Knots = allocate<float>(knots.size());
+        curveData->ControlCount = static_cast<int>(controls.size());
+        curveData->Controls = allocate<float>(controls.size());
+        copy(knots.begin(), knots.end(), curveData->Knots);
+        copy(controls.begin(), controls.end(), curveData->Controls);
+
+        curve.CurveData = { CurveDataDaK32fC32fType, curveData };
+        return curve;
+    }
+
+    // Quantized curves store knots in units of 1 / OneOverKnotScale and controls as
+    // control = value * scale + offset, with per dimension scales followed by offsets.
+    float oneOverKnotScale = 65535.0f / max(duration, 0.001f);
+    unsigned int oneOverKnotScaleBits;
+    memcpy(&oneOverKnotScaleBits, &oneOverKnotScale, sizeof(oneOverKnotScaleBits));
+    oneOverKnotScaleBits &= 0xffff0000;
+    memcpy(&oneOverKnotScale, &oneOverKnotScaleBits, sizeof(oneOverKnotScale));
+
+    auto curveData = allocate<GrannyCurveDataDaK16uC16u>();
+    curveData->CurveDataHeader = { DaK16uC16u, static_cast<unsigned char>(m_options.curveDegree) };
+    curveData->OneOverKnotScaleTrunc = static_cast<unsigned short>(oneOverKnotScaleBits >> 16);
+    curveData->ControlScaleOffsetCount = dimension * 2;
+    curveData->ControlScaleOffsets = allocate<float>(static_cast<size_t>(dimension * 2));
+    curveData->KnotControlCount = knotCount * (dimension + 1);
+    curveData->KnotsControls = allocate<unsigned short>(static_cast<size_t>(curveData->KnotControlCount));
+
+    for (auto d = 0; d < dimension; d++) {
+        auto minimum = INFINITY;
+        auto maximum = -INFINITY;
+        for (auto knot = 0; knot < knotCount; knot++) {
+            minimum = min(minimum, controls[static_cast<size_t>(knot * dimension + d)]);
+            maximum = max(maximum, controls[static_cast<size_t>(knot * dimension + d)]);
+        }
+
+        curveData->ControlScaleOffsets[d] = maximum > minimum ? (maximum - minimum) / 65535.0f : 0.0f;
+        curveData->ControlScaleOffsets[dimension + d] = minimum;
+    }
+
+    for (auto knot = 0; knot < knotCount; knot++) {
+        curveData->KnotsControls[knot] = static_cast<unsigned short>(min(round(knots[static_cast<size_t>(knot)] * oneOverKnotScale), 65535.0f));
+
+        for (auto d = 0; d < dimension; d++) {
+            const auto scale = curveData->ControlScaleOffsets[d];
+            const auto offset = curveData->ControlScaleOffsets[dimension + d];
+            const auto value = controls[static_cast<size_t>(knot * dimension + d)];
+            const auto quantized = scale > 0.0f ? round((value - offset) / scale) : 0.0f;
+
+            curveData->KnotsControls[knotCount + knot * dimension + d] = static_cast<unsigned short>(clamp(quantized, 0.0f, 65535.0f));
+        }
+    }
+
+    curve.CurveData = { CurveDataDaK16uC16uType, curveData };
+    return curve;
+}
+
+GrannyCurve2 SyntheticScene::createIdentityCurve(int dimension)
+{
+    auto curveData = allocate<GrannyCurveDataDaIdentity>();
+    curveData->CurveDataHeader = { DaIdentity, 0 };
+    curveData->Dimension = static_cast<short>(dimension);
+
+    GrannyCurve2 curve = {};
+    curve.CurveData = { CurveDataDaIdentityType, curveData };
+    return curve;
+}
+
+void SyntheticScene::createFileInfo()
+{
+    auto artToolInfo = allocate<GrannyArtToolInfo>();
+    artToolInfo->FromArtToolName = addString("GrannyConverterLibrary synthetic scene");
+    artToolInfo->ArtToolMajorRevision = 1;
+    artToolInfo->ArtToolPointerSize = 64;
+    artToolInfo->UnitsPerMeter = 1.0f;
+    artToolInfo->RightVector[0] = 1.0f;
+    artToolInfo->UpVector[1] = 1.0f;
+    artToolInfo->BackVector[2] = 1.0f;
+
+    auto exporterInfo = allocate<GrannyExporterInfo>();
+    exporterInfo->ExporterName = const_cast<char*>(addString("GrannyConverterLibrary"));
+    exporterInfo->ExporterMajorRevision = 2;
+    exporterInfo->ExporterMinorRevision = 11;
+
+    // Copies the pointers of a list into an array owned by the scene.
+    const auto toArray = [this](const auto& list, int& count) {
+        using Pointer = typename decay_t<decltype(list)>::value_type;
+        count = static_cast<int>(list.size());
+
+        auto array = allocate<Pointer>(max<size_t>(list.size(), 1));
+        copy(list.begin(), list.end(), array);
+        return array;
+    };
+
+    vector<GrannySkeleton*> skeletons = { m_skeleton };
+
+    m_fileInfo.ArtToolInfo = artToolInfo;
+    m_fileInfo.ExporterInfo = exporterInfo;
+    m_fileInfo.FromFileName = const_cast<char*>(addString("synthetic.gr2"));
+    m_fileInfo.Textures = toArray(m_textures, m_fileInfo.TextureCount);
+    m_fileInfo.Materials = toArray(m_materials, m_fileInfo.MaterialCount);
+    m_fileInfo.Skeletons = toArray(skeletons, m_fileInfo.SkeletonCount);
+    m_fileInfo.VertexDatas = toArray(m_vertexDatas, m_fileInfo.VertexDataCount);
+    m_fileInfo.TriTopologies = toArray(m_triTopologies, m_fileInfo.TriTopologyCount);
+    m_fileInfo.Meshes = toArray(m_meshes, m_fileInfo.MeshCount);
+    m_fileInfo.Models = toArray(m_models, m_fileInfo.ModelCount);
+    m_fileInfo.TrackGroups = toArray(m_trackGroups, m_fileInfo.TrackGroupCount);
+    m_fileInfo.Animations = toArray(m_animations, m_fileInfo.AnimationCount);
+}
+
+} // namespace GCL::Generator
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace GCL::Generator {
+
+using namespace std;
+
+///
+/// \brief Vertex layouts of generated meshes.
+///
+enum class VertexLayout {
+    ///
+    /// \brief Rigid vertices (GrannyPNT332Vertex) bound to a single bone.
+    ///
+    PNT332,
+
+    ///
+    /// \brief Skinned vertices with one uv channel (GrannyPWNT3432Vertex).
+    ///
+    PWNT3432,
+
+    ///
+    /// \brief Skinned vertices with three uv channels and colour sets (GrannyPWNT34322Vertex).
+    ///
+    PWNT34322
+};
+
+///
+/// \brief Curve formats of generated position and orientation curves.
+///
+enum class CurveFormat {
+    DaK32fC32f,
+    DaK16uC16u,
+    DaIdentity
+};
+
+///
+/// \brief Pixel formats of generated textures.
+///
+enum class TextureFormat {
+    BGRA8888,
+    DXT1,
+    DXT5
+};
+
+///
+/// \brief Parameters of a generated granny scene.
+///
+struct SyntheticSceneOptions {
+    ///
+    /// \brief Number of bones of the skeleton.
+    ///
+    int boneCount = 64;
+
+    ///
+    /// \brief Number of meshes.
+    ///
+    int meshCount = 4;
+
+    ///
+    /// \brief Number of vertices per mesh - rounded up to a square grid.
+    ///
+    int vertexCount = 10000;
+
+    ///
+    /// \brief Number of materials per mesh.
+    ///
+    int materialsPerMesh = 2;
+
+    ///
+    /// \brief Vertex layout of all meshes.
+    ///
+    VertexLayout vertexLayout = VertexLayout::PWNT3432;
+
+    ///
+    /// \brief Number of animations - each animates all bones.
+    ///
+    int animationCount = 1;
+
+    ///
+    /// \brief Duration of each animation in seconds.
+    ///
+    float animationDuration = 5.0f;
+
+    ///
+    /// \brief Time between two knots of the animation curves.
+    ///
+    float animationTimeStep = 1.0f / 30.0f;
+
+    ///
+    /// \brief Format of the position and orientation curves.
+    ///
+    CurveFormat curveFormat = CurveFormat::DaK32fC32f;
+
+    ///
+    /// \brief Degree of keyframed curves.
+    ///
+    int curveDegree = 2;
+
+    ///
+    /// \brief Number of textures shared by the materials.
+    ///
+    int textureCount = 2;
+
+    ///
+    /// \brief Width and height of the textures in pixels.
+    ///
+    int textureSize = 512;
+
+    ///
+    /// \brief Pixel format of the textures.
+    ///
+    TextureFormat textureFormat = TextureFormat::BGRA8888;
+
+    ///
+    /// \brief Seed of the random generator.
+    ///
+    unsigned seed = 1;
+};
+
+///
+/// \brief Granny scene generated from parameters, e.g. to write granny files for load testing.
+///
+/// The scene owns all granny structures referenced by its file info.
+///
+class SyntheticScene {
+public:
+    ///
+    /// \brief Constructor - generates the scene.
+    /// \param options Parameters of the scene.
+    ///
+    explicit SyntheticScene(const SyntheticSceneOptions& options);
+
+    SyntheticScene(const SyntheticScene&) = delete;
+    SyntheticScene& operator=(const SyntheticScene&) = delete;
+
+    ///
+    /// \brief Returns the file info referencing all generated structures.
+    /// \return File info
+    ///
+    GrannyFileInfo* getFileInfo();
+
+    ///
+    /// \brief Writes the scene as granny file.
+    /// \param filePath Path of the granny file.
+    /// \return Returns whether the file was written.
+    ///
+    bool writeFile(const string& filePath);
+
+protected:
+    ///
+    /// \brief Allocates zero initialized structures owned by the scene.
+    ///
+    template <typename Type>
+    Type* allocate(size_t count = 1)
+    {
+        auto objects = shared_ptr<Type>(new Type[count](), default_delete<Type[]>());
+        m_allocations.push_back(objects);
+        return objects.get();
+    }
+
+    ///
+    /// \brief Stores a string owned by the scene.
+    ///
+    const char* addString(string text);
+
+    void createTextures();
+
+    void createSkeleton();
+
+    void createMeshes();
+
+    void createAnimations();
+
+    void createFileInfo();
+
+    GrannyTexture* createTexture(int index);
+
+    GrannyMesh* createMesh(int meshIndex);
+
+    GrannyVertexData* createVertexData(int meshIndex, int gridSize, GrannyTriple& boundsMin, GrannyTriple& boundsMax);
+
+    GrannyTriTopology* createTopology(int gridSize);
+
+    GrannyCurve2 createCurve(int dimension, int boneIndex, bool isOrientation);
+
+    GrannyCurve2 createIdentityCurve(int dimension);
+
+protected:
+    ///
+    /// \brief Parameters of the scene.
+    ///
+    SyntheticSceneOptions m_options;
+
+    ///
+    /// \brief Random generator of the scene content.
+    ///
+    mt19937 m_random;
+
+    ///
+    /// \brief Structures owned by the scene.
+    ///
+    vector<shared_ptr<void>> m_allocations;
+
+    ///
+    /// \brief Strings owned by the scene.
+    ///
+    deque<string> m_strings;
+
+    vector<GrannyTexture*> m_textures;
+
+    vector<GrannyMaterial*> m_materials;
+
+    GrannySkeleton* m_skeleton = nullptr;
+
+    vector<GrannyVertexData*> m_vertexDatas;
+
+    vector<GrannyTriTopology*> m_triTopologies;
+
+    vector<GrannyMesh*> m_meshes;
+
+    vector<GrannyModel*> m_models;
+
+    vector<GrannyTrackGroup*> m_trackGroups;
+
+    vector<GrannyAnimation*> m_animations;
+
+    ///
+    /// \brief File info referencing all structures.
+    ///
+    GrannyFileInfo m_fileInfo = {};
+};
+
+} // namespace GCL::Generator
@@ -1,16 +1,23 @@
 #include "gcl/grannyconverterlibrary.h"
 #include "gcl/exporter/fbxexporter.h"
 #include "gcl/importer/grannyimporter.h"
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/tracing.h"
 
 namespace GCL {
 
 GrannyConverterLibrary::GrannyConverterLibrary()
 {
     InitializeGrannyLibrary();
+
+    // Each library instance keeps the background logger running until it is destroyed.
+    GCL::Utilities::Logging::start();
 }
 
 GrannyConverterLibrary::~GrannyConverterLibrary()
 {
+    GCL::Utilities::Tracing::stop();
+    GCL::Utilities::Logging::shutdown();
 }
 
 } // namespace GCL
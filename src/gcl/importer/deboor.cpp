@@ -21,7 +21,7 @@ vector<float> padded_knots(const vector<float>& knots, unsigned degree)
     return v;
 }
 
-FbxDouble3 de_boor_position(unsigned degree, float time, const vector<float>& knots, const vector<FbxDouble3>& controls)
+Vector3 de_boor_position(unsigned degree, float time, const vector<float>& knots, const vector<Vector3>& controls)
 {
     auto i = degree;
 
@@ -31,7 +31,7 @@ FbxDouble3 de_boor_position(unsigned degree, float time, const vector<float>& kn
 
     i = i - 1;
 
-    vector<FbxDouble3> d;
+    vector<Vector3> d;
 
     for (unsigned j = 0; j <= degree; ++j) {
         d.push_back(controls[j + i - degree]);
@@ -45,19 +45,17 @@ FbxDouble3 de_boor_position(unsigned degree, float time, const vector<float>& kn
                 alpha = (time - knots[j + i - degree]) / (knots[j + 1 + i - r] - knots[j + i - degree]);
             }
 
-            d[j][0] = d[j - 1][0] * (1 - alpha) + d[j][0] * alpha;
-            d[j][1] = d[j - 1][1] * (1 - alpha) + d[j][1] * alpha;
-            d[j][2] = d[j - 1][2] * (1 - alpha) + d[j][2] * alpha;
+            d[j] = GCL::Utilities::VectorMath::lerp(d[j - 1], d[j], alpha);
         }
     }
 
     return d[degree];
 }
 
-FbxDouble3 de_boor_position(unsigned degree, float time, vector<float>& knots, vector<FbxDouble3>& controls)
+Vector3 de_boor_position(unsigned degree, float time, vector<float>& knots, vector<Vector3>& controls)
 {
     if (controls.size() == 0) {
-        return FbxDouble3();
+        return Vector3();
     }
 
     if (knots.size() == 1 || knots.size() < degree + 1)
@@ -66,7 +64,7 @@ FbxDouble3 de_boor_position(unsigned degree, float time, vector<float>& knots, v
     return de_boor_position(degree, time, padded_knots(knots, degree), controls);
 }
 
-FbxQuaternion de_boor_rotation(unsigned degree, float time, const vector<float>& knots, const vector<FbxQuaternion>& controls)
+Quaternion de_boor_rotation(unsigned degree, float time, const vector<float>& knots, const vector<Quaternion>& controls)
 {
     unsigned i = degree;
 
@@ -76,7 +74,7 @@ FbxQuaternion de_boor_rotation(unsigned degree, float time, const vector<float>&
 
     i = i - 1;
 
-    vector<FbxQuaternion> points;
+    vector<Quaternion> points;
 
     for (unsigned j = 0; j <= degree; ++j) {
         points.push_back(controls[j + i - degree]);
@@ -90,17 +88,17 @@ FbxQuaternion de_boor_rotation(unsigned degree, float time, const vector<float>&
                 alpha = (time - knots[j + i - degree]) / (knots[j + 1 + i - r] - knots[j + i - degree]);
             }
 
-            points[j] = points[j - 1].Slerp(points[j], alpha);
+            points[j] = GCL::Utilities::VectorMath::slerp(points[j - 1], points[j], alpha);
         }
     }
 
     return points[degree];
 }
 
-FbxQuaternion de_boor_rotation(unsigned degree, float time, vector<float>& knots, vector<FbxQuaternion>& controls)
+Quaternion de_boor_rotation(unsigned degree, float time, vector<float>& knots, vector<Quaternion>& controls)
 {
     if (controls.size() == 0) {
-        return FbxQuaternion();
+        return Quaternion();
     }
 
     if (knots.size() == 1 || knots.size() < degree + 1) {
@@ -1,8 +1,6 @@
 #pragma once
 
-#include "gcl/importer/grannyformat.h"
-
-#include <fbxsdk.h>
+#include "gcl/utilities/vectormath.h"
 
 #include <memory>
 #include <vector>
@@ -10,6 +8,8 @@
 namespace GCL::Importer {
 
 using namespace std;
+using GCL::Utilities::VectorMath::Quaternion;
+using GCL::Utilities::VectorMath::Vector3;
 
 // De Boor's algorithm to evaluate to interpolate keyframes to bézier spline.
 // Thanks to https://github.com/Arbos/nwn2mdk/blob/master/mdb2fbx/export_gr2.cpp
@@ -30,7 +30,7 @@ vector<float> padded_knots(const vector<float>& knots, unsigned degree);
 /// \param controls
 /// \return
 ///
-FbxDouble3 de_boor_position(unsigned degree, float time, const vector<float>& knots, const vector<FbxDouble3>& controls);
+Vector3 de_boor_position(unsigned degree, float time, const vector<float>& knots, const vector<Vector3>& controls);
 
 ///
 /// \brief de_boor_position
@@ -40,7 +40,7 @@ FbxDouble3 de_boor_position(unsigned degree, float time, const vector<float>& kn
 /// \param controls
 /// \return
 ///
-FbxDouble3 de_boor_position(unsigned degree, float time, vector<float>& knots, vector<FbxDouble3>& controls);
+Vector3 de_boor_position(unsigned degree, float time, vector<float>& knots, vector<Vector3>& controls);
 
 ///
 /// \brief de_boor_rotation
@@ -50,7 +50,7 @@ FbxDouble3 de_boor_position(unsigned degree, float time, vector<float>& knots, v
 /// \param controls
 /// \return
 ///
-FbxQuaternion de_boor_rotation(unsigned degree, float time, const vector<float>& knots, const vector<FbxQuaternion>& controls);
+Quaternion de_boor_rotation(unsigned degree, float time, const vector<float>& knots, const vector<Quaternion>& controls);
 
 ///
 /// \brief de_boor_rotation
@@ -60,6 +60,6 @@ FbxQuaternion de_boor_rotation(unsigned degree, float time, const vector<float>&
 /// \param controls
 /// \return
 ///
-FbxQuaternion de_boor_rotation(unsigned degree, float time, vector<float>& knots, vector<FbxQuaternion>& controls);
+Quaternion de_boor_rotation(unsigned degree, float time, vector<float>& knots, vector<Quaternion>& controls);
 
 } // namespace GCL::Importer
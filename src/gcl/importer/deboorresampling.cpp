@@ -0,0 +1,108 @@
+#include "gcl/importer/deboorresampling.h"
+
+#include "gcl/importer/deboor.h"
+
+#include <cmath>
+
+namespace GCL::Importer {
+
+using namespace std;
+
+namespace VectorMath = GCL::Utilities::VectorMath;
+
+namespace {
+
+vector<float> createKnots(unsigned knotCount, float timeStep)
+{
+    vector<float> knots;
+    knots.reserve(knotCount);
+
+    for (unsigned i = 0; i < knotCount; i++) {
+        knots.emplace_back(static_cast<float>(i) * timeStep);
+    }
+
+    return knots;
+}
+
+} // namespace
+
+vector<ResampledKey> resamplePositionCurve(unsigned degree, unsigned knotCount, const float* controls, unsigned controlCount, float duration, float timeStep)
+{
+    vector<ResampledKey> keys;
+    if (!knotCount) {
+        return keys;
+    }
+
+    auto knots = createKnots(knotCount, timeStep);
+
+    vector<Vector3> positions;
+    positions.reserve(controlCount);
+
+    for (unsigned i = 0; i < controlCount; i++) {
+        positions.emplace_back(controls[(i * 3)], controls[(i * 3) + 1], controls[(i * 3) + 2]);
+    }
+
+    unsigned step = 0;
+    double time = 0;
+
+    while (time < static_cast<double>(duration)) {
+        time = static_cast<double>(static_cast<float>(step) * timeStep);
+
+        ResampledKey key;
+        key.time = time;
+        key.value = de_boor_position(degree, static_cast<float>(time), knots, positions);
+        keys.push_back(key);
+
+        step++;
+    }
+
+    return keys;
+}
+
+vector<ResampledKey> resampleRotationCurve(unsigned degree, unsigned knotCount, const float* controls, unsigned controlCount, float duration, float timeStep, const Vector3& scaleMultiply)
+{
+    vector<ResampledKey> keys;
+    if (!knotCount) {
+        return keys;
+    }
+
+    auto knots = createKnots(knotCount, timeStep);
+
+    vector<Quaternion> orientations;
+    orientations.reserve(controlCount);
+
+    for (unsigned i = 0; i < controlCount; i++) {
+        orientations.emplace_back(controls[(i * 4)], controls[(i * 4) + 1], controls[(i * 4) + 2], controls[(i * 4) + 3]);
+    }
+
+    // Fbx can not handle negative scaling in same way as granny2 does handle it.
+    // Multiply negative scale with rotation matrix to apply negative scaling
+    // also to rotation matrix and just not apply it only to scale matrix.
+    const auto hasNegativeScale = scaleMultiply[0] < 0.0f || scaleMultiply[1] < 0.0f || scaleMultiply[2] < 0.0f;
+    const Vector3 absoluteScale(abs(scaleMultiply[0]), abs(scaleMultiply[1]), abs(scaleMultiply[2]));
+
+    unsigned step = 0;
+    double time = 0;
+
+    while (time < static_cast<double>(duration)) {
+        time = static_cast<double>(static_cast<float>(step) * timeStep);
+
+        const auto quaternion = de_boor_rotation(degree, static_cast<float>(time), knots, orientations);
+        auto transformMatrix = VectorMath::toMatrix(quaternion);
+
+        if (hasNegativeScale) {
+            VectorMath::scaleRows(transformMatrix, absoluteScale);
+        }
+
+        ResampledKey key;
+        key.time = time;
+        key.value = VectorMath::getEulerAngles(transformMatrix);
+        keys.push_back(key);
+
+        step++;
+    }
+
+    return keys;
+}
+
+} // namespace GCL::Importer
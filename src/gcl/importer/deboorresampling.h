@@ -0,0 +1,53 @@
+#pragma once
+
+#include "gcl/utilities/vectormath.h"
+
+#include <vector>
+
+namespace GCL::Importer {
+
+using namespace std;
+using GCL::Utilities::VectorMath::Vector3;
+
+///
+/// \brief Key of a resampled curve.
+///
+struct ResampledKey {
+    double time = 0.0;
+    Vector3 value;
+};
+
+///
+/// \brief Samples a DaK32fC32f position curve at every time step of an animation.
+///
+/// The knots are placed at multiples of the time step, samples are taken from time zero
+/// until the duration is reached.
+///
+/// \param degree Degree of the curve.
+/// \param knotCount Number of knots of the curve.
+/// \param controls Controls of the curve, three floats per control.
+/// \param controlCount Number of controls.
+/// \param duration Duration of the animation.
+/// \param timeStep Time step of the animation.
+/// \return Positions
+///
+vector<ResampledKey> resamplePositionCurve(unsigned degree, unsigned knotCount, const float* controls, unsigned controlCount, float duration, float timeStep);
+
+///
+/// \brief Samples a DaK32fC32f orientation curve at every time step of an animation as euler angles.
+///
+/// Negative scale factors are applied to the rotation, because fbx can not express negative
+/// scaling the way granny does.
+///
+/// \param degree Degree of the curve.
+/// \param knotCount Number of knots of the curve.
+/// \param controls Controls of the curve, four floats (x, y, z, w) per control.
+/// \param controlCount Number of controls.
+/// \param duration Duration of the animation.
+/// \param timeStep Time step of the animation.
+/// \param scaleMultiply Scale of the first scale key of the track.
+/// \return Euler angles in degrees
+///
+vector<ResampledKey> resampleRotationCurve(unsigned degree, unsigned knotCount, const float* controls, unsigned controlCount, float duration, float timeStep, const Vector3& scaleMultiply);
+
+} // namespace GCL::Importer
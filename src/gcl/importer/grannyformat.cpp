@@ -2,6 +2,8 @@
 
 #include "gcl/utilities/logging.h"
 
+#include <Windows.h>
+
 using namespace GCL::Utilities::Logging;
 
 template <typename T>
@@ -43,6 +45,7 @@ bool InitializeGrannyLibrary()
 		GrannyGetMeshVertexCount = GetGrannyFunction<GrannyGetMeshVertexCount_t>(grannyDllHandle, "GrannyGetMeshVertexCount");
 		GrannyGetMeshIndexCount = GetGrannyFunction<GrannyGetMeshIndexCount_t>(grannyDllHandle, "GrannyGetMeshIndexCount");
 		GrannyCopyMeshVertices = GetGrannyFunction<GrannyCopyMeshVertices_t>(grannyDllHandle, "GrannyCopyMeshVertices");
+		GrannyConvertVertexLayouts = GetGrannyFunction<GrannyConvertVertexLayouts_t>(grannyDllHandle, "GrannyConvertVertexLayouts");
 		GrannyCopyMeshIndices = GetGrannyFunction<GrannyCopyMeshIndices_t>(grannyDllHandle, "GrannyCopyMeshIndices");
 		GrannyBuildCompositeTransform4x4 = GetGrannyFunction<GrannyBuildCompositeTransform4x4_t>(grannyDllHandle, "GrannyBuildCompositeTransform4x4");
 		GrannyMeshIsRigid = GetGrannyFunction<GrannyMeshIsRigid_t>(grannyDllHandle, "GrannyMeshIsRigid");
@@ -1,6 +1,9 @@
 #pragma once
 
+#ifdef _WIN32
 #include <Windows.h>
+#endif
+
 #include <fstream>
 
 using namespace std;
@@ -32,10 +35,13 @@ struct GrannyTextureMIPLevel {
 ///
 /// \brief Stores details for a texture image.
 ///
+#pragma pack(push,1)
 struct GrannyTextureImage {
 	int MIPLevelCount;
 	GrannyTextureMIPLevel* MIPLevels;
 };
+#pragma pack(pop)
+static_assert(sizeof(GrannyTextureImage) == 0xc);
 
 ///
 /// \brief Stores a variant of data structure.
@@ -89,6 +95,40 @@ struct GrannyDataTypeDefinition {
 	void* Ignored_Ignored = nullptr;
 };
 
+///
+/// \brief Texture types of a texture.
+///
+enum GrannyTextureType {
+	GrannyColorMapTextureType,
+	GrannyCubeMapTextureType,
+	GrannyTextureTypeForceInt = 0x7fffffff
+};
+
+///
+/// \brief Encodings of the pixel bytes of a texture.
+///
+enum GrannyTextureEncoding {
+	GrannyUserTextureEncoding,
+	GrannyRawTextureEncoding,
+	GrannyS3TCTextureEncoding,
+	GrannyBinkTextureEncoding,
+	GrannyTextureEncodingForceInt = 0x7fffffff
+};
+
+///
+/// \brief Sub formats of S3TC encoded textures.
+///
+/// BGR565 and BGRA5551 are stored as DXT1 blocks, MappedAlpha as DXT3 blocks
+/// and InterpolatedAlpha as DXT5 blocks.
+///
+enum GrannyS3TCTextureFormat {
+	GrannyS3TCBGR565,
+	GrannyS3TCBGRA5551,
+	GrannyS3TCBGRA8888MappedAlpha,
+	GrannyS3TCBGRA8888InterpolatedAlpha,
+	GrannyS3TCTextureFormatForceInt = 0x7fffffff
+};
+
 ///
 /// \brief Stores all data of a texture.
 ///
@@ -445,6 +485,15 @@ struct GrannyPWNT3432Vertex {
 	float UV[2];
 };
 
+///
+/// \brief Stores vertex data of a rigid vertex structure with position, normal and texture coordinates.
+///
+struct GrannyPNT332Vertex {
+	float Position[3];
+	float Normal[3];
+	float UV[2];
+};
+
 #define GrannyVertexTextureCoordinatesName "TextureCoordinates"
 
 ///
@@ -456,7 +505,7 @@ struct GrannyPWNT3432Vertex {
 ///  N: Normal
 ///  T: Texture coordinates for uv channel 1 and 2
 ///
-static GrannyDataTypeDefinition HaloVertexType[] = {
+inline GrannyDataTypeDefinition HaloVertexType[] = {
 	{ GrannyReal32Member, "Position", 0, 3 },
 	{ GrannyNormalUInt8Member, "BoneWeights", 0, 4 },
 	{ GrannyUInt8Member, "BoneIndices", 0, 4 },
@@ -473,6 +522,28 @@ static GrannyDataTypeDefinition HaloVertexType[] = {
 	{ GrannyEndMember },
 };
 
+///
+/// \brief Defines a position and normal vertex structure PN.
+///
+/// Used to decode morph targets, which only differ from the base mesh in position and normal.
+///
+inline GrannyDataTypeDefinition GrannyPN33VertexType[] = {
+	{ GrannyReal32Member, "Position", 0, 3 },
+	{ GrannyReal32Member, "Normal", 0, 3 },
+	{ GrannyEndMember },
+};
+
+///
+/// \brief Stores vertex data of the position and normal vertex structure PN.
+///
+#pragma pack(push,1)
+struct GrannyPN33Vertex {
+	float Position[3];
+	float Normal[3];
+};
+#pragma pack(pop)
+static_assert(sizeof(GrannyPN33Vertex) == 0x18);
+
 ///
 /// \brief Stores vertex data of a variant of 5 components based vertex structure.
 ///
@@ -549,6 +620,35 @@ enum GrannyCurveDataFormat {
 	D3I1K8uC8u = 18
 };
 
+///
+/// \brief Stores animation curve data for variant of a keyframe based curve with 16 bit quantized knots and controls.
+///
+/// KnotsControls stores all knots followed by all controls. Knots are scaled by the float
+/// whose upper 16 bits are OneOverKnotScaleTrunc. Each control component is dequantized
+/// with the scale ControlScaleOffsets[i] and the offset ControlScaleOffsets[Dimension + i].
+///
+#pragma pack(push,1)
+struct GrannyCurveDataDaK16uC16u {
+	GrannyCurveDataHeader CurveDataHeader;
+	unsigned short OneOverKnotScaleTrunc;
+	int ControlScaleOffsetCount;
+	float* ControlScaleOffsets;
+	int KnotControlCount;
+	unsigned short* KnotsControls;
+};
+#pragma pack(pop)
+static_assert(sizeof(GrannyCurveDataDaK16uC16u) == 0x1c);
+
+///
+/// \brief Stores animation curve data for variant of a curve which always evaluates to the identity.
+///
+struct GrannyCurveDataDaIdentity {
+	GrannyCurveDataHeader CurveDataHeader;
+	short Dimension;
+};
+
+static_assert(sizeof(GrannyCurveDataDaIdentity) == 0x4);
+
 ///
 /// \brief Stores all data of an animation like name and tracks.
 ///
@@ -618,6 +718,50 @@ struct GrannyFileMagic {
 
 static_assert(sizeof(GrannyFileMagic) == 0x20);
 
+///
+/// \brief Standard sections of a granny file.
+///
+enum GrannyStandardSectionIndex {
+	GrannyStandardMainSection = 0,
+	GrannyStandardRigidVertexSection = 1,
+	GrannyStandardRigidIndexSection = 2,
+	GrannyStandardDeformableVertexSection = 3,
+	GrannyStandardDeformableIndexSection = 4,
+	GrannyStandardTextureSection = 5,
+	GrannyStandardDiscardableSection = 6,
+	GrannyStandardUnloadedSection = 7,
+	GrannyStandardSectionCount = 8
+};
+
+///
+/// \brief Stores the location, size and fixups of a section of a granny file.
+///
+struct GrannyGRNSection {
+	unsigned int Format;
+	unsigned int DataOffset;
+	unsigned int DataSize;
+	unsigned int ExpandedDataSize;
+	unsigned int InternalAlignment;
+	unsigned int First16Bit;
+	unsigned int First8Bit;
+	unsigned int PointerFixupArrayOffset;
+	unsigned int PointerFixupArrayCount;
+	unsigned int MixedMarshallingFixupArrayOffset;
+	unsigned int MixedMarshallingFixupArrayCount;
+};
+
+static_assert(sizeof(GrannyGRNSection) == 0x2c);
+
+///
+/// \brief Stores a pointer of a section which is fixed up to a target when loading.
+///
+struct GrannyGRNPointerFixup {
+	unsigned int FromOffset;
+	GrannyRef To;
+};
+
+static_assert(sizeof(GrannyGRNPointerFixup) == 0xc);
+
 ///
 /// \brief Stores all header and data blocks of a granny file.
 ///
@@ -709,21 +853,35 @@ enum GrannyTransformFileFlags {
 	Grannytransform_file_flags_forceint = 0x7fffffff
 };
 
+// Calling convention of granny2_x64.dll. The data structures above are platform independent,
+// only the library itself requires Windows.
+#ifdef _WIN32
+#define GRANNY_STDCALL __stdcall
+#else
+#define GRANNY_STDCALL
+#endif
+
 // Type definitions for required functions from granny2_x64.dll.
 
-typedef GrannyFile* (__stdcall* GrannyReadEntireFile_t)(const char* FileName);
-typedef GrannyFileInfo* (__stdcall* GrannyGetFileInfo_t)(GrannyFile* File);
-typedef void(__stdcall* GrannyFreeFile_t)(GrannyFile const* File);
-typedef int(__stdcall* GrannyGetTotalTypeSize_t)(GrannyDataTypeDefinition* TypeDefinition);
-typedef int(__stdcall* GrannyGetMeshVertexCount_t)(GrannyMesh const* Mesh);
-typedef void(__stdcall* GrannyCopyMeshVertices_t)(GrannyMesh const* Mesh, GrannyDataTypeDefinition const* VertexType, void* DestVertices);
-typedef int(__stdcall* GrannyGetMeshIndexCount_t)(GrannyMesh const* Mesh);
-typedef void(__stdcall* GrannyCopyMeshIndices_t)(GrannyMesh const* Mesh, int BytesPerIndex, void* DestIndices);
-typedef void(__stdcall* GrannyBuildCompositeTransform4x4_t)(GrannyTransform const* Transform, float* Composite4x4);
-typedef bool(__stdcall* GrannyMeshIsRigid_t)(GrannyMesh const* Mesh);
-typedef GrannyDataTypeDefinition(__stdcall* GrannyGetMeshVertexType_t)(GrannyMesh const* Mesh);
-
-typedef bool(__stdcall* GrannyComputeBasisConversion_t)(
+typedef GrannyFile* (GRANNY_STDCALL* GrannyReadEntireFile_t)(const char* FileName);
+typedef GrannyFileInfo* (GRANNY_STDCALL* GrannyGetFileInfo_t)(GrannyFile* File);
+typedef void(GRANNY_STDCALL* GrannyFreeFile_t)(GrannyFile const* File);
+typedef int(GRANNY_STDCALL* GrannyGetTotalTypeSize_t)(GrannyDataTypeDefinition* TypeDefinition);
+typedef int(GRANNY_STDCALL* GrannyGetMeshVertexCount_t)(GrannyMesh const* Mesh);
+typedef void(GRANNY_STDCALL* GrannyCopyMeshVertices_t)(GrannyMesh const* Mesh, GrannyDataTypeDefinition const* VertexType, void* DestVertices);
+typedef void(GRANNY_STDCALL* GrannyConvertVertexLayouts_t)(
+	int VertexCount,
+	GrannyDataTypeDefinition const* SourceLayoutType,
+	void const* SourceVertices,
+	GrannyDataTypeDefinition const* DestLayoutType,
+	void* DestVertices);
+typedef int(GRANNY_STDCALL* GrannyGetMeshIndexCount_t)(GrannyMesh const* Mesh);
+typedef void(GRANNY_STDCALL* GrannyCopyMeshIndices_t)(GrannyMesh const* Mesh, int BytesPerIndex, void* DestIndices);
+typedef void(GRANNY_STDCALL* GrannyBuildCompositeTransform4x4_t)(GrannyTransform const* Transform, float* Composite4x4);
+typedef bool(GRANNY_STDCALL* GrannyMeshIsRigid_t)(GrannyMesh const* Mesh);
+typedef GrannyDataTypeDefinition(GRANNY_STDCALL* GrannyGetMeshVertexType_t)(GrannyMesh const* Mesh);
+
+typedef bool(GRANNY_STDCALL* GrannyComputeBasisConversion_t)(
 	GrannyFileInfo const* FileInfo,
 	float DesiredUnitsPerMeter,
 	float const* DesiredOrigin3,
@@ -734,7 +892,7 @@ typedef bool(__stdcall* GrannyComputeBasisConversion_t)(
 	float* ResultLinear3x3,
 	float* ResultInverseLinear3x);
 
-typedef void(__stdcall* GrannyTransformFile_t)(
+typedef void(GRANNY_STDCALL* GrannyTransformFile_t)(
 	GrannyFileInfo* FileInfo,
 	float const* Affine3,
 	float const* Linear3x3,
@@ -743,7 +901,7 @@ typedef void(__stdcall* GrannyTransformFile_t)(
 	float LinearTolerance,
 	unsigned Flags);
 
-typedef void(__stdcall* GrannyCurveMakeStaticDaK32fC32f_t)(
+typedef void(GRANNY_STDCALL* GrannyCurveMakeStaticDaK32fC32f_t)(
 	GrannyCurve2* Curve,
 	GrannyCurveDataDAK32fC32f* CurveData,
 	int KnotCount,
@@ -752,20 +910,20 @@ typedef void(__stdcall* GrannyCurveMakeStaticDaK32fC32f_t)(
 	float const* Knots,
 	float const* Controls);
 
-typedef GrannyCurve2* (__stdcall* GrannyCurveConvertToDaK32fC32f_t)(
+typedef GrannyCurve2* (GRANNY_STDCALL* GrannyCurveConvertToDaK32fC32f_t)(
 	GrannyCurve2 const* SrcCurve,
 	float const* IdentityVector);
 
-typedef void(__stdcall* GrannyFreeCurve_t)(GrannyCurve2* Curve);
-typedef int(__stdcall* GrannyCurveGetKnotCount_t)(GrannyCurve2 const* Curve);
-typedef int(__stdcall* GrannyCurveGetDimension_t)(GrannyCurve2 const* Curve);
-typedef int(__stdcall* GrannyCurveGetDegree_t)(GrannyCurve2 const* Curve);
+typedef void(GRANNY_STDCALL* GrannyFreeCurve_t)(GrannyCurve2* Curve);
+typedef int(GRANNY_STDCALL* GrannyCurveGetKnotCount_t)(GrannyCurve2 const* Curve);
+typedef int(GRANNY_STDCALL* GrannyCurveGetDimension_t)(GrannyCurve2 const* Curve);
+typedef int(GRANNY_STDCALL* GrannyCurveGetDegree_t)(GrannyCurve2 const* Curve);
 typedef float* GrannyCurveIdentityPosition_t;
 typedef float* GrannyCurveIdentityOrientation_t;
 typedef float* GrannyCurveIdentityScaleShear_t;
 typedef float* GrannyCurveIdentityScale_t;
 
-typedef void(__stdcall* GrannyEvaluateCurveAtT_t)(
+typedef void(GRANNY_STDCALL* GrannyEvaluateCurveAtT_t)(
 	int Dimension,
 	bool Normalize,
 	bool BackwardsLoop,
@@ -776,7 +934,7 @@ typedef void(__stdcall* GrannyEvaluateCurveAtT_t)(
 	float* Result,
 	float const* IdentityVector);
 
-typedef void(__stdcall* GrannyEvaluateCurveAtKnotIndex_t)(
+typedef void(GRANNY_STDCALL* GrannyEvaluateCurveAtKnotIndex_t)(
 	int Dimension,
 	bool Normalize,
 	bool BackwardsLoop,
@@ -788,26 +946,26 @@ typedef void(__stdcall* GrannyEvaluateCurveAtKnotIndex_t)(
 	float* Result,
 	float const* IdentityVector);
 
-typedef int(__stdcall* GrannyFindKnot_t)(
+typedef int(GRANNY_STDCALL* GrannyFindKnot_t)(
 	int KnotCount,
 	float* Knots,
 	float t);
 
-typedef int(__stdcall* GrannyFindCloseKnot_t)(
+typedef int(GRANNY_STDCALL* GrannyFindCloseKnot_t)(
 	int KnotCount,
 	float* Knots,
 	float t,
 	int StartinIndex);
 
-typedef bool(__stdcall* GrannyCurveIsKeyframed_t)(GrannyCurve2 const* Curve);
-typedef void(__stdcall* GrannyCurveInitializeFormat_t)(GrannyCurve2* Curve);
-typedef void(__stdcall* GrannyCurveInitializeFormat_t)(GrannyCurve2* Curve);
+typedef bool(GRANNY_STDCALL* GrannyCurveIsKeyframed_t)(GrannyCurve2 const* Curve);
+typedef void(GRANNY_STDCALL* GrannyCurveInitializeFormat_t)(GrannyCurve2* Curve);
+typedef void(GRANNY_STDCALL* GrannyCurveInitializeFormat_t)(GrannyCurve2* Curve);
 typedef GrannyDataTypeDefinition* GrannyCurveDataDaIdentityType_t;
-typedef bool(__stdcall* GrannyTextureHasAlpha_t)(GrannyTexture const* Texture);
+typedef bool(GRANNY_STDCALL* GrannyTextureHasAlpha_t)(GrannyTexture const* Texture);
 typedef GrannyPixelLayout* GrannyRGBA8888PixelFormat_t;
 typedef GrannyPixelLayout* GrannyRGB888PixelFormat_t;
 
-typedef void(__stdcall* GrannyCopyTextureImage_t)(
+typedef void(GRANNY_STDCALL* GrannyCopyTextureImage_t)(
 	GrannyTexture const* Texture,
 	int ImageIndex,
 	int MIPIndex,
@@ -829,6 +987,7 @@ inline GrannyGetTotalTypeSize_t GrannyGetTotalTypeSize = nullptr;
 inline GrannyGetMeshVertexCount_t GrannyGetMeshVertexCount = nullptr;
 inline GrannyGetMeshIndexCount_t GrannyGetMeshIndexCount = nullptr;
 inline GrannyCopyMeshVertices_t GrannyCopyMeshVertices = nullptr;
+inline GrannyConvertVertexLayouts_t GrannyConvertVertexLayouts = nullptr;
 inline GrannyCopyMeshIndices_t GrannyCopyMeshIndices = nullptr;
 inline GrannyBuildCompositeTransform4x4_t GrannyBuildCompositeTransform4x4 = nullptr;
 inline GrannyMeshIsRigid_t GrannyMeshIsRigid = nullptr;
@@ -856,6 +1015,7 @@ inline GrannyRGBA8888PixelFormat_t GrannyRGBA8888PixelFormat = nullptr;
 inline GrannyRGB888PixelFormat_t GrannyRGB888PixelFormat = nullptr;
 inline GrannyCopyTextureImage_t GrannyCopyTextureImage = nullptr;
 
+#ifdef _WIN32
 ///
 /// \brief Returns function pointer to a function from granny2_x64.dll.
 /// \param hModule Granny library
@@ -864,6 +1024,7 @@ inline GrannyCopyTextureImage_t GrannyCopyTextureImage = nullptr;
 ///
 template <typename T>
 T GetGrannyFunction(HMODULE hModule, const char* lpProcName);
+#endif
 
 ///
 /// \brief Initialize functions from granny2_x64.dll.
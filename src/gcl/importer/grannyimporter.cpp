@@ -1,13 +1,18 @@
 #include "gcl/importer/grannyimporter.h"
 
 #include "gcl/utilities/logging.h"
+#include "gcl/utilities/tracing.h"
 
+#include <algorithm>
 #include <filesystem>
 
 namespace GCL::Importer {
 
 using namespace GCL::Utilities::Logging;
 
+using ScopedSpan = GCL::Utilities::Tracing::ScopedSpan;
+using ScopedStageTimer = GCL::Utilities::ScopedStageTimer;
+
 GrannyImporter::GrannyImporter()
     : m_scene(new Scene())
 {
@@ -36,21 +41,23 @@ GrannyImporter::GrannyImporter(GrannyImportOptions options, Scene::SharedPtr sce
 
 GrannyImporter::~GrannyImporter()
 {
-    for (const auto& grannyFile : m_importedGrannyFiles) {
-        GrannyFreeFile(grannyFile);
-    }
-
     delete m_importerMaterial;
     delete m_importerModel;
     delete m_importerSkeleton;
     delete m_importerAnimation;
+    delete m_importerRootMotion;
 }
 
 void GrannyImporter::initialize()
 {
+    if (!m_options.traceFilePath.empty()) {
+        GCL::Utilities::Tracing::start(m_options.traceFilePath);
+    }
+
     m_importerMaterial = new GrannyImporterMaterial(m_scene);
     m_importerModel = new GrannyImporterModel(m_scene);
     m_importerSkeleton = new GrannyImporterSkeleton(m_scene);
+    m_importerRootMotion = new GrannyImporterRootMotion(m_scene);
 
     // If option for deboor animation importer is enabled then use
     // deboor animation importer otherwise default animation importer.
@@ -70,11 +77,26 @@ bool GrannyImporter::importFromFile(const char* grannyFilePath)
 
     info("Import granny file (file: \"%s\") to scene.", grannyFilePath);
 
-    GrannyFile* grannyFile = GrannyReadEntireFile(grannyFilePath);
+    ScopedSpan span("importFromFile", grannyFilePath);
+    ScopedStageTimer timer(m_statistics, "importFromFile");
+
+    GrannyFile* grannyFile = nullptr;
+    {
+        ScopedSpan readSpan("GrannyReadEntireFile", grannyFilePath);
+        ScopedStageTimer readTimer(m_statistics, "GrannyReadEntireFile");
+        grannyFile = GrannyReadEntireFile(grannyFilePath);
+    }
+
+    error_code errorCode;
+    const auto fileSize = filesystem::file_size(filesystem::u8path(grannyFilePath), errorCode);
+    if (!errorCode) {
+        m_statistics.bytesRead += fileSize;
+    }
+
     GrannyFileInfo* grannyFileInfo = GrannyGetFileInfo(grannyFile);
 
-    // Add granny file to list of imported granny files.
-    m_importedGrannyFiles.push_back(grannyFile);
+    // The scene owns the granny file, so exporters and queued texture jobs can outlive the importer.
+    m_scene->addGrannyFile(shared_ptr<GrannyFile>(grannyFile, [](GrannyFile* file) { GrannyFreeFile(file); }));
 
     // Add granny file path to the imported file paths of the scene.
     m_scene->addImportedFilePath(grannyFilePath);
@@ -87,21 +109,120 @@ bool GrannyImporter::importFromFile(const char* grannyFilePath)
         m_scene->addSearchPath(searchPath.u8string());
     }
 
+    // Convert the granny file to the target basis while its data gets imported.
+    const auto basisConversion = convertBasis(grannyFileInfo, grannyFilePath);
+    m_importerModel->setBasisConversion(basisConversion);
+    m_importerAnimation->setBasisConversion(basisConversion);
+
     // Import all materials and models of the granny file to the scene.
     importMaterials(grannyFileInfo, grannyFilePath);
     importModels(grannyFileInfo, grannyFilePath);
 
-    // Import all bones of the granny file to the scene.
-    for (const auto& model : m_scene->getModels()) {
-        model->setBones(m_importerSkeleton->loadBones(model->getData()));
+    // Import the skeletons of all newly imported models of the granny file to the scene.
+    {
+        ScopedSpan skeletonSpan("importSkeletons", grannyFilePath);
+        ScopedStageTimer skeletonTimer(m_statistics, "importSkeletons");
+
+        for (const auto& model : m_scene->getModels()) {
+            if (!model->getSkeleton()) {
+                model->setSkeleton(m_importerSkeleton->importSkeleton(model->getData()));
+                m_statistics.boneCount += model->getBones().size();
+            }
+        }
     }
 
     // Import all animations of the granny file to the scene.
     importAnimations(grannyFileInfo, grannyFilePath);
 
+    m_statistics.updateMemory();
+
     return true;
 }
 
+GCL::Utilities::BasisConversion::Conversion GrannyImporter::convertBasis(GrannyFileInfo* grannyFileInfo, const char* grannyFilePath)
+{
+    namespace BasisConversion = GCL::Utilities::BasisConversion;
+
+    const auto artToolInfo = grannyFileInfo->ArtToolInfo;
+    if (!m_options.convertBasis || !artToolInfo) {
+        return BasisConversion::Conversion();
+    }
+
+    BasisConversion::Basis source;
+    source.unitsPerMeter = artToolInfo->UnitsPerMeter;
+    copy(artToolInfo->RightVector, artToolInfo->RightVector + 3, source.right);
+    copy(artToolInfo->UpVector, artToolInfo->UpVector + 3, source.up);
+    copy(artToolInfo->BackVector, artToolInfo->BackVector + 3, source.back);
+
+    BasisConversion::Basis target;
+    target.unitsPerMeter = m_options.targetUnitsPerMeter;
+    copy(m_options.targetRightVector, m_options.targetRightVector + 3, target.right);
+    copy(m_options.targetUpVector, m_options.targetUpVector + 3, target.up);
+    copy(m_options.targetBackVector, m_options.targetBackVector + 3, target.back);
+
+    const auto conversion = BasisConversion::compute(source, target);
+    if (conversion.isIdentity) {
+        debug("Skip basis conversion because granny file \"%s\" is in the target basis.", grannyFilePath);
+        return conversion;
+    }
+
+    info("Convert granny file \"%s\" from %g to %g units per meter%s.", grannyFilePath,
+        static_cast<double>(artToolInfo->UnitsPerMeter), static_cast<double>(m_options.targetUnitsPerMeter),
+        conversion.isMirrored ? " with mirrored axes" : "");
+
+    ScopedSpan span("convertBasis", grannyFilePath);
+    ScopedStageTimer timer(m_statistics, "convertBasis");
+
+    for (auto i = 0; i < grannyFileInfo->SkeletonCount; i++) {
+        const auto grannySkeleton = grannyFileInfo->Skeletons[i];
+
+        for (auto boneIndex = 0; boneIndex < grannySkeleton->BoneCount; boneIndex++) {
+            auto& grannyBone = grannySkeleton->Bones[boneIndex];
+            BasisConversion::transformTransform(conversion, grannyBone.LocalTransform.Position, grannyBone.LocalTransform.Orientation, grannyBone.LocalTransform.ScaleShear);
+            BasisConversion::transformMatrix(conversion, grannyBone.InverseWorld4x4);
+        }
+    }
+
+    for (auto i = 0; i < grannyFileInfo->ModelCount; i++) {
+        auto& initialPlacement = grannyFileInfo->Models[i]->InitialPlacement;
+        BasisConversion::transformTransform(conversion, initialPlacement.Position, initialPlacement.Orientation, initialPlacement.ScaleShear);
+    }
+
+    for (auto i = 0; i < grannyFileInfo->MeshCount; i++) {
+        const auto grannyMesh = grannyFileInfo->Meshes[i];
+
+        for (auto bindingIndex = 0; bindingIndex < grannyMesh->BoneBindingCount; bindingIndex++) {
+            auto& grannyBoneBinding = grannyMesh->BoneBindings[bindingIndex];
+            BasisConversion::transformBox(conversion, grannyBoneBinding.OBBMin, grannyBoneBinding.OBBMax);
+        }
+    }
+
+    for (auto i = 0; i < grannyFileInfo->TrackGroupCount; i++) {
+        const auto grannyTrackGroup = grannyFileInfo->TrackGroups[i];
+        auto& initialPlacement = grannyTrackGroup->InitialPlacement;
+        BasisConversion::transformTransform(conversion, initialPlacement.Position, initialPlacement.Orientation, initialPlacement.ScaleShear);
+        BasisConversion::transformPoints(conversion, grannyTrackGroup->LoopTranslation, 1, sizeof(grannyTrackGroup->LoopTranslation));
+
+        // The loop rotates around its axis, which turns around with the handedness.
+        if (const auto periodicLoop = grannyTrackGroup->PeriodicLoop) {
+            periodicLoop->Radius *= conversion.scale;
+            periodicLoop->dZ *= conversion.scale;
+            periodicLoop->dAngle *= conversion.isMirrored ? -1.0f : 1.0f;
+            BasisConversion::transformDirections(conversion, periodicLoop->BasisX, 1, sizeof(periodicLoop->BasisX));
+            BasisConversion::transformDirections(conversion, periodicLoop->BasisY, 1, sizeof(periodicLoop->BasisY));
+            BasisConversion::transformDirections(conversion, periodicLoop->Axis, 1, sizeof(periodicLoop->Axis));
+        }
+    }
+
+    // The data of the file is in the target basis now, e.g. for the up axis of the root motion.
+    artToolInfo->UnitsPerMeter = target.unitsPerMeter;
+    copy(target.right, target.right + 3, artToolInfo->RightVector);
+    copy(target.up, target.up + 3, artToolInfo->UpVector);
+    copy(target.back, target.back + 3, artToolInfo->BackVector);
+
+    return conversion;
+}
+
 void GrannyImporter::importMaterials(GrannyFileInfo* grannyFileInfo, const char* grannyFilePath)
 {
     // Load materials from granny file only if it has at least one material.
@@ -111,6 +232,9 @@ void GrannyImporter::importMaterials(GrannyFileInfo* grannyFileInfo, const char*
     }
 
     info("Import materials from granny file \"%s\".", grannyFilePath);
+
+    ScopedSpan span("importMaterials", grannyFilePath);
+    ScopedStageTimer timer(m_statistics, "importMaterials");
     m_importerMaterial->importMaterials(grannyFileInfo);
 }
 
@@ -123,7 +247,15 @@ void GrannyImporter::importModels(GrannyFileInfo* grannyFileInfo, const char* gr
     }
 
     info("Import models from granny file \"%s\".", grannyFilePath);
+
+    ScopedSpan span("importModels", grannyFilePath);
+    ScopedStageTimer timer(m_statistics, "importModels");
     m_importerModel->importModels(grannyFileInfo);
+
+    for (auto i = 0; i < grannyFileInfo->MeshCount; i++) {
+        m_statistics.vertexCount += GrannyGetMeshVertexCount(grannyFileInfo->Meshes[i]);
+        m_statistics.triangleCount += GrannyGetMeshIndexCount(grannyFileInfo->Meshes[i]) / 3;
+    }
 }
 
 void GrannyImporter::importAnimations(GrannyFileInfo* grannyFileInfo, const char* grannyFilePath)
@@ -135,7 +267,27 @@ void GrannyImporter::importAnimations(GrannyFileInfo* grannyFileInfo, const char
     }
 
     info("Import animations from granny file \"%s\".", grannyFilePath);
+
+    ScopedSpan span("importAnimations", grannyFilePath);
+    ScopedStageTimer timer(m_statistics, "importAnimations");
+
+    const auto animationCount = m_scene->getAnimations().size();
     m_importerAnimation->importAnimations(grannyFileInfo);
+
+    const auto animations = m_scene->getAnimations();
+    for (auto i = animationCount; i < animations.size(); i++) {
+        if (m_options.rootMotion != RootMotionMode::Keep) {
+            m_importerRootMotion->extractRootMotion(animations[i], grannyFileInfo, m_options.rootMotion == RootMotionMode::InPlace);
+        }
+
+        for (const auto& track : animations[i]->getTracks()) {
+            m_statistics.keyCount += track->getKeyCount();
+        }
+
+        for (const auto& vectorTrack : animations[i]->getVectorTracks()) {
+            m_statistics.keyCount += vectorTrack->getKeyCount();
+        }
+    }
 }
 
 Scene::SharedPtr GrannyImporter::getScene() const
@@ -143,4 +295,9 @@ Scene::SharedPtr GrannyImporter::getScene() const
     return m_scene;
 }
 
+const GCL::Utilities::ConversionStatistics& GrannyImporter::getStatistics() const
+{
+    return m_statistics;
+}
+
 } // namespace GCL::Importer
@@ -16,8 +16,11 @@
 #include "gcl/importer/grannyimporteranimation_deboor.h"
 #include "gcl/importer/grannyimportermaterial.h"
 #include "gcl/importer/grannyimportermodel.h"
+#include "gcl/importer/grannyimporterrootmotion.h"
 #include "gcl/importer/grannyimporterskeleton.h"
 #include "gcl/importer/grannyimportoptions.h"
+#include "gcl/utilities/basisconversion.h"
+#include "gcl/utilities/statistics.h"
 
 #include <vector>
 
@@ -72,6 +75,18 @@ public:
     ///
     bool importFromFile(const char* fullFilePath);
 
+    ///
+    /// \brief Computes the basis conversion of a granny file and converts its bones and placements in place.
+    ///
+    /// Vertices and curves are converted later by the importer modules while they are decoded.
+    /// The art tool info of the file gets the target basis, since the data is in it afterwards.
+    ///
+    /// \param grannyFileInfo Granny file info
+    /// \param grannyFilePath Granny file path
+    /// \return Basis conversion, the identity if the conversion is disabled.
+    ///
+    GCL::Utilities::BasisConversion::Conversion convertBasis(GrannyFileInfo* grannyFileInfo, const char* grannyFilePath);
+
     ///
     /// \brief Load and add materials from granny file to the scene.
     /// \param grannyFileInfo Granny file info
@@ -99,6 +114,12 @@ public:
     ///
     Scene::SharedPtr getScene() const;
 
+    ///
+    /// \brief Returns the statistics of all imports of this importer.
+    /// \return Import statistics
+    ///
+    const GCL::Utilities::ConversionStatistics& getStatistics() const;
+
 protected:
     ///
     /// \brief Import options which define the way how a scene needs to be imported.
@@ -131,9 +152,14 @@ protected:
     GrannyImporterAnimation* m_importerAnimation = nullptr;
 
     ///
-    /// \brief Granny files of the imported granny files.
+    /// \brief Root motion importer module.
+    ///
+    GrannyImporterRootMotion* m_importerRootMotion = nullptr;
+
+    ///
+    /// \brief Statistics of all imports.
     ///
-    vector<GrannyFile*> m_importedGrannyFiles;
+    GCL::Utilities::ConversionStatistics m_statistics;
 };
 
 } // namespace GCL::Importer
@@ -1,11 +1,14 @@
 #include "gcl/importer/grannyimporteranimation.h"
 
 #include "gcl/utilities/logging.h"
+#include "gcl/utilities/tracing.h"
 
 namespace GCL::Importer {
 
 using namespace GCL::Utilities::Logging;
 
+namespace VectorMath = GCL::Utilities::VectorMath;
+
 GrannyImporterAnimation::GrannyImporterAnimation(Scene::SharedPtr scene)
     : m_scene(scene)
 {
@@ -25,6 +28,9 @@ void GrannyImporterAnimation::importAnimations(GrannyFileInfo* grannyFileInfo) c
     }
 
     const auto grannyAnimation = grannyFileInfo->Animations[0];
+
+    GCL::Utilities::Tracing::ScopedSpan span("importAnimation", grannyAnimation->Name);
+
     auto animation = make_shared<Animation>(grannyAnimation);
 
     // Process animation track groups. Only if animation does have at least one animation track group.
@@ -35,6 +41,14 @@ void GrannyImporterAnimation::importAnimations(GrannyFileInfo* grannyFileInfo) c
             for (auto i = 0; i < grannyTrackGroup->TransformTrackCount; i++) {
                 animation->addTrack(importTrack(animation, grannyTrackGroup->TransformTracks[i]));
             }
+
+            for (auto i = 0; i < grannyTrackGroup->VectorTrackCount; i++) {
+                animation->addVectorTrack(importVectorTrack(animation, &grannyTrackGroup->VectorTracks[i]));
+            }
+
+            for (auto i = 0; i < grannyTrackGroup->TextTrackCount; i++) {
+                animation->addTextTrack(make_shared<TextTrack>(&grannyTrackGroup->TextTracks[i]));
+            }
         }
     } else {
         warning("Skip load animations because animation does not have at least one animation track.");
@@ -45,6 +59,11 @@ void GrannyImporterAnimation::importAnimations(GrannyFileInfo* grannyFileInfo) c
     info("Added animation to scene.");
 }
 
+void GrannyImporterAnimation::setBasisConversion(const GCL::Utilities::BasisConversion::Conversion& basisConversion)
+{
+    m_basisConversion = basisConversion;
+}
+
 Track::SharedPtr GrannyImporterAnimation::importTrack(
     Animation::SharedPtr animation,
     GrannyTransformTrack grannyTransformTrack) const
@@ -59,6 +78,49 @@ Track::SharedPtr GrannyImporterAnimation::importTrack(
     return track;
 }
 
+VectorTrack::SharedPtr GrannyImporterAnimation::importVectorTrack(
+    Animation::SharedPtr animation,
+    GrannyVectorTrack* grannyVectorTrack) const
+{
+    const float duration = animation->getData()->Duration;
+    const float timeStep = animation->getData()->TimeStep;
+
+    auto vectorTrack = make_shared<VectorTrack>(grannyVectorTrack);
+
+    const auto dimension = grannyVectorTrack->Dimension;
+    if (dimension <= 0 || GrannyCurveGetDimension(&grannyVectorTrack->ValueCurve) == 0) {
+        return vectorTrack;
+    }
+
+    // Vector curves have no identity of their own, constant curves evaluate to zero.
+    const vector<float> identity(static_cast<size_t>(dimension), 0.0f);
+    vector<float> values(static_cast<size_t>(dimension));
+
+    unsigned step = 0;
+    double time = 0;
+
+    while (time < static_cast<const double>(duration)) {
+        time = static_cast<const double>(static_cast<float>(step) * timeStep);
+
+        GrannyEvaluateCurveAtT(
+            dimension,
+            false,
+            true,
+            &grannyVectorTrack->ValueCurve,
+            true,
+            duration,
+            static_cast<float>(time),
+            values.data(),
+            identity.data());
+
+        vectorTrack->addKey(static_cast<float>(time), values.data());
+
+        step++;
+    }
+
+    return vectorTrack;
+}
+
 void GrannyImporterAnimation::importScaleCurve(
     Track::SharedPtr track,
     GrannyTransformTrack grannyTransformTrack) const
@@ -70,6 +132,7 @@ void GrannyImporterAnimation::importScaleCurve(
     GrannyCurve2* scaleCurve = GrannyCurveConvertToDaK32fC32f(
         &grannyTransformTrack.ScaleShearCurve,
         GrannyCurveIdentityScaleShear);
+    convertCurveBasis(scaleCurve, 9);
 
     const auto grannyScaleShearCurve = static_cast<GrannyCurveDataDAK32fC32f*>(
         scaleCurve->CurveData.Object);
@@ -80,10 +143,10 @@ void GrannyImporterAnimation::importScaleCurve(
     for (unsigned i = 0; i < grannyKnotCount; i++) {
         CurveScaleKey key(*scaleCurve);
         key.setTime(static_cast<double>(grannyScaleShearCurve->Knots[i]));
-        key.setValue(FbxDouble3(
-            static_cast<double>(grannyScaleShearCurve->Controls[(i * 9)]),
-            static_cast<double>(grannyScaleShearCurve->Controls[(i * 9) + 4]),
-            static_cast<double>(grannyScaleShearCurve->Controls[(i * 9) + 8])));
+        key.setValue(Vector3(
+            grannyScaleShearCurve->Controls[(i * 9)],
+            grannyScaleShearCurve->Controls[(i * 9) + 4],
+            grannyScaleShearCurve->Controls[(i * 9) + 8]));
 
         track->addScaleKey(key);
     }
@@ -106,6 +169,7 @@ void GrannyImporterAnimation::importPositionCurve(
     GrannyCurve2* positionCurve = GrannyCurveConvertToDaK32fC32f(
         &grannyTransformTrack.PositionCurve,
         GrannyCurveIdentityPosition);
+    convertCurveBasis(positionCurve, 3);
 
     const auto grannyPositionCurve = static_cast<GrannyCurveDataDAK32fC32f*>(
         positionCurve->CurveData.Object);
@@ -139,10 +203,7 @@ void GrannyImporterAnimation::importPositionCurve(
 
         CurvePositionKey key(*positionCurve);
         key.setTime(time);
-        key.setValue(FbxDouble3(
-            static_cast<double>(position[0]),
-            static_cast<double>(position[1]),
-            static_cast<double>(position[2])));
+        key.setValue(Vector3(position[0], position[1], position[2]));
 
         track->addPositionKey(key);
 
@@ -166,6 +227,7 @@ void GrannyImporterAnimation::importRotationCurve(
         scaleCurve = GrannyCurveConvertToDaK32fC32f(
             &grannyTransformTrack.ScaleShearCurve,
             GrannyCurveIdentityScaleShear);
+        convertCurveBasis(scaleCurve, 9);
     }
 
     if (GrannyCurveGetDimension(&grannyTransformTrack.OrientationCurve) == 0) {
@@ -175,6 +237,7 @@ void GrannyImporterAnimation::importRotationCurve(
     GrannyCurve2* orientationCurve = GrannyCurveConvertToDaK32fC32f(
         &grannyTransformTrack.OrientationCurve,
         GrannyCurveIdentityOrientation);
+    convertCurveBasis(orientationCurve, 4);
 
     const auto grannyOrientationCurve = static_cast<GrannyCurveDataDAK32fC32f*>(
         orientationCurve->CurveData.Object);
@@ -208,7 +271,7 @@ void GrannyImporterAnimation::importRotationCurve(
                 GrannyCurveIdentityScaleShear);
         }
 
-        float quaternion[4];
+        VectorMath::Quaternion quaternion;
 
         int orientationDimension = GrannyCurveGetDimension(orientationCurve);
         GrannyEvaluateCurveAtT(
@@ -219,31 +282,22 @@ void GrannyImporterAnimation::importRotationCurve(
             true,
             duration,
             static_cast<float>(time),
-            quaternion,
+            quaternion.values,
             GrannyCurveIdentityOrientation);
 
-        FbxAMatrix transformMatrix;
-
-        transformMatrix.SetQ(FbxQuaternion(
-            static_cast<double>(quaternion[0]),
-            static_cast<double>(quaternion[1]),
-            static_cast<double>(quaternion[2]),
-            static_cast<double>(quaternion[3])));
+        auto transformMatrix = VectorMath::toMatrix(quaternion);
 
         // Check for negative scale.
         // Fbx can not handle negative scaling in same way as granny2 does handle it.
         // Multiply negative scale with rotation matrix to apply negative scaling
         // also to rotation matrix and just not apply it only to scale matrix.
         if (scale[0] < 0.0f || scale[4] < 0.0f || scale[8] < 0.0f) {
-            transformMatrix.MultSM(FbxVector4(
-                static_cast<double>(abs(scale[0])),
-                static_cast<double>(abs(scale[4])),
-                static_cast<double>(abs(scale[8]))));
+            VectorMath::scaleRows(transformMatrix, Vector3(abs(scale[0]), abs(scale[4]), abs(scale[8])));
         }
 
         CurveRotationKey key(*orientationCurve);
         key.setTime(time);
-        key.setValue(transformMatrix.GetR());
+        key.setValue(VectorMath::getEulerAngles(transformMatrix));
 
         track->addRotationKey(key);
 
@@ -262,4 +316,31 @@ double GrannyImporterAnimation::calculateTime(const double time) const
     return min2 * frame;
 }
 
+void GrannyImporterAnimation::convertCurveBasis(GrannyCurve2* curve, int dimension) const
+{
+    if (m_basisConversion.isIdentity || GrannyCurveGetDimension(curve) != dimension) {
+        return;
+    }
+
+    const auto curveData = static_cast<GrannyCurveDataDAK32fC32f*>(curve->CurveData.Object);
+    if (!curveData->Controls || curveData->ControlCount < dimension) {
+        return;
+    }
+
+    const auto controls = curveData->Controls;
+    const auto count = static_cast<size_t>(curveData->ControlCount / dimension);
+
+    switch (dimension) {
+    case 3:
+        GCL::Utilities::BasisConversion::transformPoints(m_basisConversion, controls, count, 3 * sizeof(float));
+        break;
+    case 4:
+        GCL::Utilities::BasisConversion::transformQuaternions(m_basisConversion, controls, count);
+        break;
+    case 9:
+        GCL::Utilities::BasisConversion::transformScaleShears(m_basisConversion, controls, count);
+        break;
+    }
+}
+
 } // namespace GCL::Importer
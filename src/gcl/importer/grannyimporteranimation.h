@@ -4,6 +4,7 @@
 #include "gcl/bindings/scene.h"
 #include "gcl/importer/deboor.h"
 #include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/basisconversion.h"
 
 namespace GCL::Importer {
 
@@ -32,6 +33,12 @@ public:
     ///
     void importAnimations(GrannyFileInfo* grannyFileInfo) const;
 
+    ///
+    /// \brief Sets the basis conversion applied to the curves of the next imported granny file.
+    /// \param basisConversion Basis conversion
+    ///
+    void setBasisConversion(const GCL::Utilities::BasisConversion::Conversion& basisConversion);
+
 public:
     ///
     /// \brief Animation tracks in the scene.
@@ -52,6 +59,14 @@ protected:
     ///
     virtual Track::SharedPtr importTrack(Animation::SharedPtr animation, GrannyTransformTrack grannyTransformTrack) const;
 
+    ///
+    /// \brief Imports a vector track by sampling its curve at the time step of the animation.
+    /// \param animation Animation
+    /// \param grannyVectorTrack Granny vector track
+    /// \return Vector track
+    ///
+    VectorTrack::SharedPtr importVectorTrack(Animation::SharedPtr animation, GrannyVectorTrack* grannyVectorTrack) const;
+
     ///
     /// \brief Imports a scale keys from scale curve.
     /// \param track Granny transform track
@@ -82,11 +97,27 @@ protected:
     ///
     double calculateTime(const double time) const;
 
+    ///
+    /// \brief Converts the controls of a curve to the target basis in place.
+    ///
+    /// Curves are linear in their controls, so every value sampled from the converted
+    /// curve is converted as well, without a pass over the sampled keys.
+    ///
+    /// \param curve DaK32fC32f curve, e.g. returned by GrannyCurveConvertToDaK32fC32f.
+    /// \param dimension 3 for position, 4 for orientation and 9 for scale shear curves.
+    ///
+    void convertCurveBasis(GrannyCurve2* curve, int dimension) const;
+
 protected:
     ///
     /// \brief Scene of the importing granny file.
     ///
     Scene::SharedPtr m_scene;
+
+    ///
+    /// \brief Basis conversion of the importing granny file.
+    ///
+    GCL::Utilities::BasisConversion::Conversion m_basisConversion;
 };
 
 } // namespace GCL::Importer
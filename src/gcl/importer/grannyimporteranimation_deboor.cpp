@@ -1,5 +1,7 @@
 #include "gcl/importer/grannyimporteranimation_deboor.h"
 
+#include "gcl/importer/deboorresampling.h"
+
 #include <vector>
 
 namespace GCL::Importer {
@@ -40,6 +42,7 @@ void GrannyImporterAnimationDeboor::importScaleCurve(
     GrannyCurve2* scaleCurve = GrannyCurveConvertToDaK32fC32f(
         &grannyTransformTrack.ScaleShearCurve,
         GrannyCurveIdentityScaleShear);
+    convertCurveBasis(scaleCurve, 9);
 
     const GrannyCurveDataDAK32fC32f* grannyScaleShearCurve = static_cast<GrannyCurveDataDAK32fC32f*>(
         scaleCurve->CurveData.Object);
@@ -50,10 +53,10 @@ void GrannyImporterAnimationDeboor::importScaleCurve(
     for (unsigned i = 0; i < grannyKnotCount; i++) {
         CurveScaleKey key(*scaleCurve);
         key.setTime(static_cast<double>(grannyScaleShearCurve->Knots[i]));
-        key.setValue(FbxDouble3(
-            static_cast<double>(grannyScaleShearCurve->Controls[(i * 9)]),
-            static_cast<double>(grannyScaleShearCurve->Controls[(i * 9) + 4]),
-            static_cast<double>(grannyScaleShearCurve->Controls[(i * 9) + 8])));
+        key.setValue(Vector3(
+            grannyScaleShearCurve->Controls[(i * 9)],
+            grannyScaleShearCurve->Controls[(i * 9) + 4],
+            grannyScaleShearCurve->Controls[(i * 9) + 8]));
 
         track->addScaleKey(key);
     }
@@ -76,55 +79,25 @@ void GrannyImporterAnimationDeboor::importPositionCurve(
     GrannyCurve2* positionCurve = GrannyCurveConvertToDaK32fC32f(
         &grannyTransformTrack.PositionCurve,
         GrannyCurveIdentityPosition);
+    convertCurveBasis(positionCurve, 3);
 
     const GrannyCurveDataDAK32fC32f* grannyPositionCurve = static_cast<GrannyCurveDataDAK32fC32f*>(
         positionCurve->CurveData.Object);
 
-    const unsigned grannyKnotCount = static_cast<unsigned>(
-        grannyPositionCurve->KnotCount);
-
-    if (!grannyKnotCount) {
-        return;
-    }
-
-    vector<float> knots;
-    knots.reserve(grannyKnotCount);
-
-    for (unsigned i = 0; i < grannyKnotCount; i++) {
-        knots.emplace_back(static_cast<float>(i) * (timeStep * 1));
-    }
-
-    const unsigned controlCount = static_cast<unsigned>(grannyPositionCurve->ControlCount) / 3;
-
-    vector<FbxDouble3> controls;
-    controls.reserve(controlCount);
-
-    for (unsigned i = 0; i < controlCount; i++) {
-        controls.emplace_back(
-            grannyPositionCurve->Controls[(i * 3)],
-            grannyPositionCurve->Controls[(i * 3) + 1],
-            grannyPositionCurve->Controls[(i * 3) + 2]);
-    }
-
-    unsigned step = 0;
-    double time = 0;
-
-    while (time < static_cast<double>(duration)) {
-        time = static_cast<double>(static_cast<float>(step) * timeStep);
-
-        auto position = de_boor_position(
-            grannyPositionCurve->CurveDataHeader.Degree,
-            static_cast<float>(time),
-            knots,
-            controls);
+    const auto positions = resamplePositionCurve(
+        grannyPositionCurve->CurveDataHeader.Degree,
+        static_cast<unsigned>(grannyPositionCurve->KnotCount),
+        grannyPositionCurve->Controls,
+        static_cast<unsigned>(grannyPositionCurve->ControlCount) / 3,
+        duration,
+        timeStep);
 
+    for (const auto& position : positions) {
         CurvePositionKey key(grannyTransformTrack.PositionCurve);
-        key.setTime(time);
-        key.setValue(position);
+        key.setTime(position.time);
+        key.setValue(position.value);
 
         track->addPositionKey(key);
-
-        step++;
     }
 
     GrannyFreeCurve(positionCurve);
@@ -145,42 +118,13 @@ void GrannyImporterAnimationDeboor::importRotationCurve(
     GrannyCurve2* orientationCurve = GrannyCurveConvertToDaK32fC32f(
         &grannyTransformTrack.OrientationCurve,
         GrannyCurveIdentityOrientation);
+    convertCurveBasis(orientationCurve, 4);
 
     const GrannyCurveDataDAK32fC32f* grannyOrientationCurve = static_cast<GrannyCurveDataDAK32fC32f*>(
         orientationCurve->CurveData.Object);
 
-    const unsigned grannyKnotCount = static_cast<unsigned>(
-        grannyOrientationCurve->KnotCount);
-
-    if (!grannyKnotCount) {
-        return;
-    }
-
-    vector<float> knots;
-    knots.reserve(grannyKnotCount);
-
-    for (unsigned i = 0; i < grannyKnotCount; i++) {
-        knots.emplace_back(static_cast<float>(i) * (timeStep * 1));
-    }
-
-    const unsigned controlCount = static_cast<unsigned>(grannyOrientationCurve->ControlCount) / 4;
-
-    vector<FbxQuaternion> controls;
-    controls.reserve(controlCount);
-
-    for (unsigned i = 0; i < controlCount; i++) {
-        controls.emplace_back(
-            grannyOrientationCurve->Controls[(i * 4)],
-            grannyOrientationCurve->Controls[(i * 4) + 1],
-            grannyOrientationCurve->Controls[(i * 4) + 2],
-            grannyOrientationCurve->Controls[(i * 4) + 3]);
-    }
-
-    unsigned step = 0;
-    double time = 0;
-
     // Set default scale multiply.
-    auto scaleMultiply = FbxDouble3(1.0, 1.0, 1.0);
+    auto scaleMultiply = Vector3(1.0f, 1.0f, 1.0f);
 
     // Get first scale key as scale multiply for rotation curve.
     // It is required to calculate correct rotation in case
@@ -190,37 +134,21 @@ void GrannyImporterAnimationDeboor::importRotationCurve(
         scaleMultiply = (static_cast<CurveScaleKey>(track->getScaleKeys().at(0))).getValue();
     }
 
-    while (time < static_cast<double>(duration)) {
-        time = static_cast<double>(static_cast<float>(step) * timeStep);
-
-        FbxQuaternion quaternion = de_boor_rotation(
-            grannyOrientationCurve->CurveDataHeader.Degree,
-            static_cast<float>(time),
-            knots,
-            controls);
-
-        FbxAMatrix transformMatrix;
-
-        transformMatrix.SetQ(quaternion);
-
-        // Check for negative scale multiply.
-        // Fbx can not handle negative scaling in same way as granny2 does handle it.
-        // Multiply negative scale with rotation matrix to apply negative scaling
-        // also to rotation matrix and just not apply it only to scale matrix.
-        if (scaleMultiply[0] < 0.0 || scaleMultiply[1] < 0.0 || scaleMultiply[2] < 0.0) {
-            transformMatrix.MultSM(FbxVector4(
-                abs(scaleMultiply[0]),
-                abs(scaleMultiply[1]),
-                abs(scaleMultiply[2])));
-        }
+    const auto rotations = resampleRotationCurve(
+        grannyOrientationCurve->CurveDataHeader.Degree,
+        static_cast<unsigned>(grannyOrientationCurve->KnotCount),
+        grannyOrientationCurve->Controls,
+        static_cast<unsigned>(grannyOrientationCurve->ControlCount) / 4,
+        duration,
+        timeStep,
+        scaleMultiply);
 
+    for (const auto& rotation : rotations) {
         CurveRotationKey key(*orientationCurve);
-        key.setTime(time);
-        key.setValue(transformMatrix.GetR());
+        key.setTime(rotation.time);
+        key.setValue(rotation.value);
 
         track->addRotationKey(key);
-
-        step++;
     }
 
     GrannyFreeCurve(orientationCurve);
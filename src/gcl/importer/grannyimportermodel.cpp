@@ -2,6 +2,8 @@
 
 #include "gcl/utilities/logging.h"
 
+#include <cmath>
+
 namespace GCL::Importer {
 
 using namespace GCL::Utilities::Logging;
@@ -23,6 +25,11 @@ void GrannyImporterModel::importModels(GrannyFileInfo* grannyFileInfo) const
     }
 }
 
+void GrannyImporterModel::setBasisConversion(const GCL::Utilities::BasisConversion::Conversion& basisConversion)
+{
+    m_basisConversion = basisConversion;
+}
+
 Model::SharedPtr GrannyImporterModel::importModel(GrannyModel* grannyModel) const
 {
     info("Import granny model (name: \"%s\") as scene model.", grannyModel->Name);
@@ -30,8 +37,8 @@ Model::SharedPtr GrannyImporterModel::importModel(GrannyModel* grannyModel) cons
     const Model::SharedPtr model = make_shared<Model>(grannyModel);
 
     // Use granny method to translate initial placement in scene correctly.
-    FbxMatrix transform;
-    GrannyBuildCompositeTransform4x4(&grannyModel->InitialPlacement, reinterpret_cast<float*>(&transform));
+    GCL::Utilities::VectorMath::Matrix4 transform;
+    GrannyBuildCompositeTransform4x4(&grannyModel->InitialPlacement, &transform.rows[0][0]);
 
     model->setTransform(transform);
     model->setMeshes(importMeshes(grannyModel));
@@ -49,7 +56,7 @@ vector<Mesh::SharedPtr> GrannyImporterModel::importMeshes(GrannyModel* grannyMod
 
     // Import each mesh of the granny model as scene mesh.
     for (unsigned i = 0; i < meshBindingCount; i++) {
-        meshes.push_back(make_shared<Mesh>(grannyModel->MeshBindings[i].Mesh));
+        meshes.push_back(importMesh(grannyModel->MeshBindings[i].Mesh));
     }
 
     return meshes;
@@ -57,7 +64,87 @@ vector<Mesh::SharedPtr> GrannyImporterModel::importMeshes(GrannyModel* grannyMod
 
 Mesh::SharedPtr GrannyImporterModel::importMesh(GrannyMesh* grannyMesh) const
 {
-    return make_shared<Mesh>(grannyMesh);
+    const auto mesh = make_shared<Mesh>(grannyMesh);
+    mesh->setBasisConversion(m_basisConversion);
+
+    if (grannyMesh->MorphTargetCount > 0) {
+        importMorphTargets(mesh);
+    }
+
+    return mesh;
+}
+
+void GrannyImporterModel::importMorphTargets(Mesh::SharedPtr mesh) const
+{
+    // Deltas below this threshold are treated as unmoved vertices.
+    constexpr float epsilon = 1e-6f;
+
+    const auto grannyMesh = mesh->getData();
+    const auto vertexCount = GrannyGetMeshVertexCount(grannyMesh);
+
+    vector<GrannyPN33Vertex> baseVertices;
+    vector<GrannyPN33Vertex> targetVertices(static_cast<size_t>(vertexCount));
+
+    for (auto i = 0; i < grannyMesh->MorphTargetCount; i++) {
+        const auto& grannyMorphTarget = grannyMesh->MorphTargets[i];
+        const auto vertexData = grannyMorphTarget.VertexData;
+        const auto name = grannyMorphTarget.ScalarName ? grannyMorphTarget.ScalarName : "MorphTarget" + to_string(i);
+
+        if (!vertexData || vertexData->VertexCount != vertexCount) {
+            warning("Skip morph target \"%s\" of mesh \"%s\" because its vertex count differs from the mesh.", name.c_str(), grannyMesh->Name);
+            continue;
+        }
+
+        GrannyConvertVertexLayouts(vertexCount, vertexData->VertexType, vertexData->Vertices, GrannyPN33VertexType, targetVertices.data());
+        convertBasis(targetVertices);
+
+        // Absolute targets need the base mesh to get deltas, decode it only once.
+        if (!grannyMorphTarget.DataIsDeltas && baseVertices.empty()) {
+            baseVertices.resize(static_cast<size_t>(vertexCount));
+            GrannyCopyMeshVertices(grannyMesh, GrannyPN33VertexType, baseVertices.data());
+            convertBasis(baseVertices);
+        }
+
+        const auto morphTarget = make_shared<MorphTarget>(name);
+
+        for (unsigned vertexIndex = 0; vertexIndex < static_cast<unsigned>(vertexCount); vertexIndex++) {
+            float positionDelta[3];
+            float normalDelta[3];
+            auto moved = false;
+
+            for (auto axis = 0; axis < 3; axis++) {
+                positionDelta[axis] = targetVertices[vertexIndex].Position[axis];
+                normalDelta[axis] = targetVertices[vertexIndex].Normal[axis];
+
+                if (!grannyMorphTarget.DataIsDeltas) {
+                    positionDelta[axis] -= baseVertices[vertexIndex].Position[axis];
+                    normalDelta[axis] -= baseVertices[vertexIndex].Normal[axis];
+                }
+
+                moved |= fabs(positionDelta[axis]) > epsilon || fabs(normalDelta[axis]) > epsilon;
+            }
+
+            if (moved) {
+                morphTarget->addDelta(vertexIndex, positionDelta, normalDelta);
+            }
+        }
+
+        debug("Import morph target \"%s\" of mesh \"%s\" with %zu of %d moved vertices.",
+            name.c_str(), grannyMesh->Name, morphTarget->getDeltaCount(), vertexCount);
+
+        mesh->addMorphTarget(morphTarget);
+    }
+}
+
+void GrannyImporterModel::convertBasis(vector<GrannyPN33Vertex>& vertices) const
+{
+    if (m_basisConversion.isIdentity || vertices.empty()) {
+        return;
+    }
+
+    // Deltas are differences of positions and normals, so they convert alike.
+    GCL::Utilities::BasisConversion::transformPoints(m_basisConversion, vertices[0].Position, vertices.size(), sizeof(GrannyPN33Vertex));
+    GCL::Utilities::BasisConversion::transformDirections(m_basisConversion, vertices[0].Normal, vertices.size(), sizeof(GrannyPN33Vertex));
 }
 
 } // namespace GCL::Importer
@@ -4,6 +4,7 @@
 #include "gcl/bindings/mesh.h"
 #include "gcl/bindings/scene.h"
 #include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/basisconversion.h"
 
 #include <vector>
 
@@ -34,6 +35,12 @@ public:
     ///
     void importModels(GrannyFileInfo* grannyFileInfo) const;
 
+    ///
+    /// \brief Sets the basis conversion applied to the vertices of the meshes of the next imported granny file.
+    /// \param basisConversion Basis conversion
+    ///
+    void setBasisConversion(const GCL::Utilities::BasisConversion::Conversion& basisConversion);
+
 protected:
     ///
     /// \brief Imports a granny model as scene model.
@@ -56,11 +63,32 @@ protected:
     ///
     Mesh::SharedPtr importMesh(GrannyMesh* grannyMesh) const;
 
+    ///
+    /// \brief Imports the morph targets of a granny mesh as sparse deltas.
+    ///
+    /// Targets are decoded one by one into a shared buffer, only vertices which
+    /// move are kept. Absolute targets are converted to deltas to the base mesh.
+    ///
+    /// \param mesh Mesh of the granny mesh.
+    ///
+    void importMorphTargets(Mesh::SharedPtr mesh) const;
+
+    ///
+    /// \brief Converts decoded morph target or base vertices to the target basis in place.
+    /// \param vertices Decoded vertices
+    ///
+    void convertBasis(vector<GrannyPN33Vertex>& vertices) const;
+
 protected:
     ///
     /// \brief Scene of the importing granny file.
     ///
     Scene::SharedPtr m_scene;
+
+    ///
+    /// \brief Basis conversion of the importing granny file.
+    ///
+    GCL::Utilities::BasisConversion::Conversion m_basisConversion;
 };
 
 } // namespace GCL::Importer
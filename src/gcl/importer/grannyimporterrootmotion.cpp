@@ -0,0 +1,118 @@
+#include "gcl/importer/grannyimporterrootmotion.h"
+
+#include "gcl/utilities/logging.h"
+
+#include <set>
+
+namespace GCL::Importer {
+
+using namespace GCL::Utilities::Logging;
+
+namespace VectorMath = GCL::Utilities::VectorMath;
+
+GrannyImporterRootMotion::GrannyImporterRootMotion(Scene::SharedPtr scene)
+    : m_scene(scene)
+{
+}
+
+void GrannyImporterRootMotion::extractRootMotion(Animation::SharedPtr animation, GrannyFileInfo* grannyFileInfo, bool bakeInPlace) const
+{
+    const auto grannyAnimation = animation->getData();
+    const auto rootTrack = findRootTrack(animation);
+
+    if (!rootTrack || !grannyAnimation->TrackGroupCount) {
+        debug("Skip root motion extraction because animation \"%s\" has no tracks.", grannyAnimation->Name);
+        return;
+    }
+
+    auto positionKeys = rootTrack->getPositionKeys();
+    if (positionKeys.empty()) {
+        debug("Skip root motion extraction because root track \"%s\" has no position keys.", rootTrack->getName().c_str());
+        return;
+    }
+
+    const auto grannyTrackGroup = grannyAnimation->TrackGroups[0];
+    const auto& orientation = grannyTrackGroup->InitialPlacement.Orientation;
+    const VectorMath::Quaternion placement(orientation[0], orientation[1], orientation[2], orientation[3]);
+    const auto inversePlacement = VectorMath::conjugate(placement);
+
+    // Up axis of the granny file in the space of the root track.
+    Vector3 up(0.0f, 1.0f, 0.0f);
+    if (grannyFileInfo->ArtToolInfo) {
+        const auto& upVector = grannyFileInfo->ArtToolInfo->UpVector;
+        const Vector3 fileUp(upVector[0], upVector[1], upVector[2]);
+
+        if (VectorMath::length(fileUp) > 0.0f) {
+            up = VectorMath::rotate(inversePlacement, VectorMath::normalize(fileUp));
+        }
+    }
+
+    auto rootMotion = make_shared<RootMotion>(rootTrack->getName());
+    rootMotion->setLoopTranslation(Vector3(
+        grannyTrackGroup->LoopTranslation[0],
+        grannyTrackGroup->LoopTranslation[1],
+        grannyTrackGroup->LoopTranslation[2]));
+    rootMotion->setPeriodicLoop(grannyTrackGroup->PeriodicLoop);
+
+    const auto origin = positionKeys.front().getValue();
+
+    for (auto& key : positionKeys) {
+        const auto position = key.getValue();
+        const auto delta = VectorMath::subtract(position, origin);
+
+        // Ground plane part of the translation.
+        const auto translation = VectorMath::subtract(delta, VectorMath::scale(up, VectorMath::dot(delta, up)));
+
+        rootMotion->addKey(static_cast<float>(key.getTime()), VectorMath::rotate(placement, translation));
+
+        if (bakeInPlace) {
+            key.setValue(VectorMath::subtract(position, translation));
+        }
+    }
+
+    if (bakeInPlace) {
+        rootTrack->setPositionKeys(move(positionKeys));
+    }
+
+    animation->setRootMotion(rootMotion);
+
+    debug("Extracted root motion of animation \"%s\" from track \"%s\".", grannyAnimation->Name, rootTrack->getName().c_str());
+}
+
+Track::SharedPtr GrannyImporterRootMotion::findRootTrack(Animation::SharedPtr animation) const
+{
+    const auto tracks = animation->getTracks();
+    if (tracks.empty()) {
+        return nullptr;
+    }
+
+    set<string> rootBoneNames;
+    for (const auto& model : m_scene->getModels()) {
+        for (const auto& bone : model->getBones()) {
+            if (bone->getData().ParentIndex == GrannyNoParentBone) {
+                rootBoneNames.insert(bone->getData().Name);
+            }
+        }
+    }
+
+    for (const auto& track : tracks) {
+        if (rootBoneNames.count(track->getName())) {
+            return track;
+        }
+    }
+
+    const auto grannyAnimation = animation->getData();
+    if (grannyAnimation->TrackGroupCount && grannyAnimation->TrackGroups[0]->Name) {
+        const string trackGroupName = grannyAnimation->TrackGroups[0]->Name;
+
+        for (const auto& track : tracks) {
+            if (track->getName() == trackGroupName) {
+                return track;
+            }
+        }
+    }
+
+    return tracks.front();
+}
+
+} // namespace GCL::Importer
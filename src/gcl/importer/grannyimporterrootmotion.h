@@ -0,0 +1,56 @@
+#pragma once
+
+#include "gcl/bindings/animation.h"
+#include "gcl/bindings/rootmotion.h"
+#include "gcl/bindings/scene.h"
+#include "gcl/bindings/track.h"
+#include "gcl/importer/grannyformat.h"
+
+namespace GCL::Importer {
+
+using namespace std;
+using namespace GCL::Bindings;
+
+///
+/// \brief Extracts the root motion of imported animations.
+///
+class GrannyImporterRootMotion {
+public:
+    ///
+    /// \brief Constructor
+    /// \param scene Scene of the imported animations.
+    ///
+    GrannyImporterRootMotion(Scene::SharedPtr scene);
+
+    ///
+    /// \brief Extracts the root motion of an animation from the sampled keys of its root track.
+    ///
+    /// The root motion is the translation of the root track relative to its first key,
+    /// projected onto the ground plane of the granny file. The height stays in the track.
+    ///
+    /// \param animation Imported animation
+    /// \param grannyFileInfo Granny file info of the animation, defines the up axis.
+    /// \param bakeInPlace Removes the root motion from the root track if true.
+    ///
+    void extractRootMotion(Animation::SharedPtr animation, GrannyFileInfo* grannyFileInfo, bool bakeInPlace) const;
+
+protected:
+    ///
+    /// \brief Finds the track of the root bone of an animation.
+    ///
+    /// Prefers the track of a root bone of the imported skeletons and falls back to the
+    /// track named like the track group, i.e. the model, and then to the first track.
+    ///
+    /// \param animation Imported animation
+    /// \return Root track or nullptr if the animation has no tracks.
+    ///
+    Track::SharedPtr findRootTrack(Animation::SharedPtr animation) const;
+
+protected:
+    ///
+    /// \brief Scene of the imported animations.
+    ///
+    Scene::SharedPtr m_scene;
+};
+
+} // namespace GCL::Importer
@@ -1,7 +1,92 @@
 #include "gcl/importer/grannyimporterskeleton.h"
 
+#include "gcl/utilities/logging.h"
+
+#include <cstring>
+#include <functional>
+
 namespace GCL::Importer {
 
+using namespace GCL::Utilities::Logging;
+
+namespace {
+
+///
+/// \brief Combines a value into a hash (boost::hash_combine).
+///
+void hashCombine(size_t& hash, size_t value)
+{
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+///
+/// \brief Combines the bits of a float into a hash. Negative zero is hashed as zero.
+///
+void hashCombine(size_t& hash, float value)
+{
+    value += 0.0f;
+
+    unsigned bits;
+    memcpy(&bits, &value, sizeof(bits));
+    hashCombine(hash, static_cast<size_t>(bits));
+}
+
+///
+/// \brief Combines all components of a transform into a hash.
+///
+void hashCombine(size_t& hash, const GrannyTransform& transform)
+{
+    hashCombine(hash, static_cast<size_t>(transform.Flags));
+
+    for (const auto value : transform.Position) {
+        hashCombine(hash, value);
+    }
+
+    for (const auto value : transform.Orientation) {
+        hashCombine(hash, value);
+    }
+
+    for (const auto& row : transform.ScaleShear) {
+        for (const auto value : row) {
+            hashCombine(hash, value);
+        }
+    }
+}
+
+///
+/// \brief Compares all components of two transforms.
+///
+bool compareTransforms(const GrannyTransform& left, const GrannyTransform& right)
+{
+    if (left.Flags != right.Flags) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < 3; i++) {
+        if (left.Position[i] != right.Position[i]) {
+            return false;
+        }
+    }
+
+    for (unsigned i = 0; i < 4; i++) {
+        if (left.Orientation[i] != right.Orientation[i]) {
+            return false;
+        }
+    }
+
+    for (unsigned i = 0; i < 3; i++) {
+        for (unsigned j = 0; j < 3; j++) {
+            if (left.ScaleShear[i][j] != right.ScaleShear[i][j]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
 GrannyImporterSkeleton::GrannyImporterSkeleton(Scene::SharedPtr scene)
     : m_scene(scene)
 {
@@ -11,6 +96,32 @@ GrannyImporterSkeleton::~GrannyImporterSkeleton()
 {
 }
 
+Skeleton::SharedPtr GrannyImporterSkeleton::importSkeleton(GrannyModel* grannyModel) const
+{
+    const auto grannySkeleton = grannyModel->Skeleton;
+
+    if (!grannySkeleton) {
+        return nullptr;
+    }
+
+    const auto hash = hashSkeleton(grannySkeleton);
+
+    // Reuse an already imported skeleton with the same structure.
+    for (const auto& skeleton : m_scene->getSkeletons(hash)) {
+        if (compareSkeletons(skeleton->getData(), grannySkeleton)) {
+            debug("Reuse imported skeleton (name: \"%s\") for granny model (name: \"%s\").", skeleton->getData()->Name, grannyModel->Name);
+            return skeleton;
+        }
+    }
+
+    const auto skeleton = make_shared<Skeleton>(grannySkeleton);
+    skeleton->setBones(loadBones(grannyModel));
+
+    m_scene->addSkeleton(hash, skeleton);
+
+    return skeleton;
+}
+
 vector<Bone::SharedPtr> GrannyImporterSkeleton::loadBones(GrannyModel* grannyModel) const
 {
     unsigned boneCount = static_cast<unsigned>(grannyModel->Skeleton->BoneCount);
@@ -26,4 +137,49 @@ vector<Bone::SharedPtr> GrannyImporterSkeleton::loadBones(GrannyModel* grannyMod
     return bones;
 }
 
+size_t GrannyImporterSkeleton::hashSkeleton(const GrannySkeleton* grannySkeleton)
+{
+    size_t hash = static_cast<size_t>(grannySkeleton->BoneCount);
+
+    for (auto i = 0; i < grannySkeleton->BoneCount; i++) {
+        const auto& grannyBone = grannySkeleton->Bones[i];
+
+        hashCombine(hash, std::hash<string>()(grannyBone.Name ? grannyBone.Name : ""));
+        hashCombine(hash, static_cast<size_t>(grannyBone.ParentIndex));
+        hashCombine(hash, grannyBone.LocalTransform);
+    }
+
+    return hash;
+}
+
+bool GrannyImporterSkeleton::compareSkeletons(const GrannySkeleton* left, const GrannySkeleton* right)
+{
+    if (left == right) {
+        return true;
+    }
+
+    if (left->BoneCount != right->BoneCount) {
+        return false;
+    }
+
+    for (auto i = 0; i < left->BoneCount; i++) {
+        const auto& leftBone = left->Bones[i];
+        const auto& rightBone = right->Bones[i];
+
+        if (leftBone.ParentIndex != rightBone.ParentIndex) {
+            return false;
+        }
+
+        if (strcmp(leftBone.Name ? leftBone.Name : "", rightBone.Name ? rightBone.Name : "") != 0) {
+            return false;
+        }
+
+        if (!compareTransforms(leftBone.LocalTransform, rightBone.LocalTransform)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace GCL::Importer
@@ -2,6 +2,7 @@
 
 #include "gcl/bindings/bone.h"
 #include "gcl/bindings/scene.h"
+#include "gcl/bindings/skeleton.h"
 #include "gcl/importer/grannyformat.h"
 
 #include <vector>
@@ -27,6 +28,18 @@ public:
     ///
     ~GrannyImporterSkeleton();
 
+    ///
+    /// \brief Imports the skeleton of the granny model.
+    ///
+    /// Skeletons are interned in the scene by their structure, so a model whose
+    /// skeleton equals an already imported one (e.g. render mesh and skeleton file)
+    /// shares the existing skeleton and its bones.
+    ///
+    /// \param grannyModel Granny model
+    /// \return Skeleton of the granny model or nullptr if the model has no skeleton.
+    ///
+    Skeleton::SharedPtr importSkeleton(GrannyModel* grannyModel) const;
+
     ///
     /// \brief Load all bones from the granny model and return.
     /// \param grannyModel Granny model
@@ -34,6 +47,22 @@ public:
     ///
     vector<Bone::SharedPtr> loadBones(GrannyModel* grannyModel) const;
 
+protected:
+    ///
+    /// \brief Calculates a structural hash of a skeleton from bone names, parent indices and local transforms.
+    /// \param grannySkeleton Granny skeleton
+    /// \return Structural hash
+    ///
+    static size_t hashSkeleton(const GrannySkeleton* grannySkeleton);
+
+    ///
+    /// \brief Compares two skeletons by bone names, parent indices and local transforms.
+    /// \param left Granny skeleton
+    /// \param right Granny skeleton
+    /// \return Returns whether both skeletons are structurally equal.
+    ///
+    static bool compareSkeletons(const GrannySkeleton* left, const GrannySkeleton* right);
+
 protected:
     ///
     /// \brief Scene of the importing granny file.
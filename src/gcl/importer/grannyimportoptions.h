@@ -1,7 +1,32 @@
 #pragma once
 
+#include <string>
+
 namespace GCL::Importer {
 
+using namespace std;
+
+///
+/// \brief Handling of the root motion of animations.
+///
+enum class RootMotionMode {
+    ///
+    /// \brief Root motion stays in the root track.
+    ///
+    Keep,
+
+    ///
+    /// \brief Root motion is extracted into a separate curve and stays in the root track.
+    ///
+    Extract,
+
+    ///
+    /// \brief Root motion is extracted into a separate curve and removed from the root track,
+    /// so the skeleton animates in place.
+    ///
+    InPlace
+};
+
 ///
 /// \brief Enableable / disableable options for the import of a model.
 ///
@@ -10,6 +35,55 @@ struct GrannyImportOptions {
     /// \brief Sets whether to import animation using deboor animation importer.
     ///
     bool importAnimationDeboor = false;
+
+    ///
+    /// \brief Sets how to handle the root motion of animations.
+    ///
+    /// Root motion is the ground plane translation of the root track relative to its first key.
+    /// Extracted root motion is exported as animated "RootMotion" node, together with the loop
+    /// translation and periodic loop of the track group as properties of the animation stack.
+    ///
+    RootMotionMode rootMotion = RootMotionMode::Keep;
+
+    ///
+    /// \brief Sets whether to convert the axes and units of each granny file to the target basis.
+    ///
+    /// The basis of a file is read from its art tool info. Vertices are converted as they are
+    /// decoded, curves by their controls before they are sampled, and bones, placements and
+    /// bone binding boxes once in place, so no later pass over the scene is needed. The origin
+    /// of the art tool is kept. Files without art tool info are imported as they are.
+    /// The axis system of the export options should describe the target basis.
+    ///
+    bool convertBasis = false;
+
+    ///
+    /// \brief Sets the number of units per meter of the target basis, e.g. 100 for centimeters.
+    ///
+    float targetUnitsPerMeter = 100.0f;
+
+    ///
+    /// \brief Sets the right axis of the target basis.
+    ///
+    float targetRightVector[3] = { 1.0f, 0.0f, 0.0f };
+
+    ///
+    /// \brief Sets the up axis of the target basis.
+    ///
+    float targetUpVector[3] = { 0.0f, 1.0f, 0.0f };
+
+    ///
+    /// \brief Sets the back axis of the target basis.
+    ///
+    float targetBackVector[3] = { 0.0f, 0.0f, 1.0f };
+
+    ///
+    /// \brief Sets the file path to write trace spans of the import as chrome trace json.
+    ///
+    /// Open the file in chrome://tracing or https://ui.perfetto.dev to see where the
+    /// import time goes. The trace is written after each export and when the library
+    /// is destroyed. Leave it empty to disable tracing.
+    ///
+    string traceFilePath = "";
 };
 
 } // namespace GCL::Importer
@@ -0,0 +1,243 @@
+#include "gcl/utilities/basisconversion.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE__)
+#define GCL_BASIS_CONVERSION_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace GCL::Utilities::BasisConversion {
+
+using namespace std;
+
+namespace {
+
+///
+/// \brief Returns the vector at an index.
+///
+float* getVector(float* vectors, size_t stride, size_t index)
+{
+    return reinterpret_cast<float*>(reinterpret_cast<unsigned char*>(vectors) + index * stride);
+}
+
+///
+/// \brief Returns the number of vectors of which four floats can be loaded without reading past the last vector.
+///
+/// The fourth float of a vector is the first float of the next one at the latest, so every
+/// vector but the last can be loaded. The last one may end the buffer, e.g. the normal of the
+/// last vertex of tightly packed PN33 vertices, wherever it lies within its element.
+///
+size_t getVectorCount(size_t count)
+{
+    return count > 0 ? count - 1 : 0;
+}
+
+///
+/// \brief Writes the axes of a basis as columns of a matrix. Returns false if an axis has no length.
+///
+bool getAxes(const Basis& basis, double axes[3][3])
+{
+    const float* vectors[3] = { basis.right, basis.up, basis.back };
+
+    for (auto column = 0; column < 3; column++) {
+        const auto vector = vectors[column];
+        const auto length = sqrt(static_cast<double>(vector[0]) * vector[0] + static_cast<double>(vector[1]) * vector[1] + static_cast<double>(vector[2]) * vector[2]);
+        if (length <= 0.0) {
+            return false;
+        }
+
+        for (auto row = 0; row < 3; row++) {
+            axes[row][column] = vector[row] / length;
+        }
+    }
+
+    return true;
+}
+
+double getDeterminant(const double m[3][3])
+{
+    return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+        - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+        + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+///
+/// \brief Multiplies each vector by a matrix in place, one vector per SSE register.
+///
+void transformVectors(const float matrix[3][3], float sign, float* vectors, size_t count, size_t stride)
+{
+    size_t index = 0;
+
+#ifdef GCL_BASIS_CONVERSION_SSE
+    const auto vectorCount = getVectorCount(count);
+    if (vectorCount > 0) {
+        const auto column0 = _mm_set_ps(0.0f, sign * matrix[2][0], sign * matrix[1][0], sign * matrix[0][0]);
+        const auto column1 = _mm_set_ps(0.0f, sign * matrix[2][1], sign * matrix[1][1], sign * matrix[0][1]);
+        const auto column2 = _mm_set_ps(0.0f, sign * matrix[2][2], sign * matrix[1][2], sign * matrix[0][2]);
+
+        for (; index < vectorCount; index++) {
+            const auto vector = getVector(vectors, stride, index);
+            const auto value = _mm_loadu_ps(vector);
+            const auto result = _mm_add_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(column0, _mm_shuffle_ps(value, value, _MM_SHUFFLE(0, 0, 0, 0))),
+                    _mm_mul_ps(column1, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1)))),
+                _mm_mul_ps(column2, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 2, 2))));
+
+            // The fourth lane belongs to whatever follows the vector and is not written back.
+            float lanes[4];
+            _mm_storeu_ps(lanes, result);
+            copy(lanes, lanes + 3, vector);
+        }
+    }
+#endif
+
+    for (; index < count; index++) {
+        const auto vector = getVector(vectors, stride, index);
+        const float value[3] = { vector[0], vector[1], vector[2] };
+
+        for (auto row = 0; row < 3; row++) {
+            vector[row] = sign * (matrix[row][0] * value[0] + matrix[row][1] * value[1] + matrix[row][2] * value[2]);
+        }
+    }
+}
+
+} // namespace
+
+Conversion compute(const Basis& source, const Basis& target)
+{
+    Conversion conversion;
+
+    double sourceAxes[3][3];
+    double targetAxes[3][3];
+    if (!getAxes(source, sourceAxes) || !getAxes(target, targetAxes)) {
+        return conversion;
+    }
+
+    const auto determinant = getDeterminant(sourceAxes);
+    if (fabs(determinant) < 1e-6) {
+        return conversion;
+    }
+
+    // Source coordinates to right, up and back components, then to target coordinates.
+    double inverse[3][3];
+    for (auto row = 0; row < 3; row++) {
+        for (auto column = 0; column < 3; column++) {
+            const auto r0 = (column + 1) % 3;
+            const auto r1 = (column + 2) % 3;
+            const auto c0 = (row + 1) % 3;
+            const auto c1 = (row + 2) % 3;
+            inverse[row][column] = (sourceAxes[r0][c0] * sourceAxes[r1][c1] - sourceAxes[r0][c1] * sourceAxes[r1][c0]) / determinant;
+        }
+    }
+
+    double axes[3][3];
+    for (auto row = 0; row < 3; row++) {
+        for (auto column = 0; column < 3; column++) {
+            axes[row][column] = targetAxes[row][0] * inverse[0][column] + targetAxes[row][1] * inverse[1][column] + targetAxes[row][2] * inverse[2][column];
+            conversion.axes[row][column] = static_cast<float>(axes[row][column]);
+        }
+    }
+
+    if (source.unitsPerMeter > 0.0f && target.unitsPerMeter > 0.0f) {
+        conversion.scale = target.unitsPerMeter / source.unitsPerMeter;
+    }
+
+    conversion.isMirrored = getDeterminant(axes) < 0.0;
+    conversion.isIdentity = conversion.scale == 1.0f;
+
+    for (auto row = 0; row < 3; row++) {
+        for (auto column = 0; column < 3; column++) {
+            conversion.isIdentity &= fabs(axes[row][column] - (row == column ? 1.0 : 0.0)) < 1e-6;
+        }
+    }
+
+    return conversion;
+}
+
+void transformPoints(const Conversion& conversion, float* positions, size_t count, size_t stride)
+{
+    transformVectors(conversion.axes, conversion.scale, positions, count, stride);
+}
+
+void transformDirections(const Conversion& conversion, float* directions, size_t count, size_t stride)
+{
+    transformVectors(conversion.axes, 1.0f, directions, count, stride);
+}
+
+void transformQuaternions(const Conversion& conversion, float* quaternions, size_t count)
+{
+    // The rotation axis is a pseudo vector, it turns around with the handedness.
+    transformVectors(conversion.axes, conversion.isMirrored ? -1.0f : 1.0f, quaternions, count, 4 * sizeof(float));
+}
+
+void transformScaleShears(const Conversion& conversion, float* scaleShears, size_t count)
+{
+    const auto& axes = conversion.axes;
+
+    for (size_t index = 0; index < count; index++) {
+        const auto scaleShear = scaleShears + index * 9;
+
+        // axes * scaleShear * transpose(axes), the unit scale cancels out.
+        float product[3][3];
+        for (auto row = 0; row < 3; row++) {
+            for (auto column = 0; column < 3; column++) {
+                product[row][column] = axes[row][0] * scaleShear[column] + axes[row][1] * scaleShear[3 + column] + axes[row][2] * scaleShear[6 + column];
+            }
+        }
+
+        for (auto row = 0; row < 3; row++) {
+            for (auto column = 0; column < 3; column++) {
+                scaleShear[row * 3 + column] = product[row][0] * axes[column][0] + product[row][1] * axes[column][1] + product[row][2] * axes[column][2];
+            }
+        }
+    }
+}
+
+void transformTransform(const Conversion& conversion, float position[3], float orientation[4], float scaleShear[3][3])
+{
+    transformPoints(conversion, position, 1, 3 * sizeof(float));
+    transformQuaternions(conversion, orientation, 1);
+    transformScaleShears(conversion, &scaleShear[0][0], 1);
+}
+
+void transformMatrix(const Conversion& conversion, float matrix[4][4])
+{
+    float linear[9];
+    for (auto row = 0; row < 3; row++) {
+        copy(matrix[row], matrix[row] + 3, linear + row * 3);
+    }
+
+    // Conjugation with the axes commutes with the transposition of row vector matrices.
+    transformScaleShears(conversion, linear, 1);
+
+    for (auto row = 0; row < 3; row++) {
+        copy(linear + row * 3, linear + row * 3 + 3, matrix[row]);
+    }
+
+    transformPoints(conversion, matrix[3], 1, sizeof(matrix[3]));
+}
+
+void transformBox(const Conversion& conversion, float min[3], float max[3])
+{
+    float center[3];
+    float extent[3];
+    for (auto axis = 0; axis < 3; axis++) {
+        center[axis] = (min[axis] + max[axis]) * 0.5f;
+        extent[axis] = (max[axis] - min[axis]) * 0.5f;
+    }
+
+    transformPoints(conversion, center, 1, sizeof(center));
+
+    for (auto row = 0; row < 3; row++) {
+        const auto& axes = conversion.axes[row];
+        const auto rowExtent = conversion.scale * (fabs(axes[0]) * extent[0] + fabs(axes[1]) * extent[1] + fabs(axes[2]) * extent[2]);
+
+        min[row] = center[row] - rowExtent;
+        max[row] = center[row] + rowExtent;
+    }
+}
+
+} // namespace GCL::Utilities::BasisConversion
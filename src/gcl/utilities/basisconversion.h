@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+
+namespace GCL::Utilities::BasisConversion {
+
+///
+/// \brief Axes and units of a coordinate system, e.g. of the art tool of a granny file.
+///
+struct Basis {
+    ///
+    /// \brief Number of units per meter.
+    ///
+    float unitsPerMeter = 1.0f;
+
+    float right[3] = { 1.0f, 0.0f, 0.0f };
+    float up[3] = { 0.0f, 1.0f, 0.0f };
+    float back[3] = { 0.0f, 0.0f, 1.0f };
+};
+
+///
+/// \brief Linear conversion from one basis to another.
+///
+/// Vectors are converted as v' = axes * v, positions are additionally scaled by the unit scale.
+/// Transforms are converted by conjugation, so bone hierarchies and curves stay consistent.
+///
+struct Conversion {
+    ///
+    /// \brief Rotation or reflection between the axes, one row per converted component.
+    ///
+    float axes[3][3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+
+    ///
+    /// \brief Unit scale of positions.
+    ///
+    float scale = 1.0f;
+
+    ///
+    /// \brief Whether the conversion changes the handedness, i.e. flips the winding of triangles.
+    ///
+    bool isMirrored = false;
+
+    ///
+    /// \brief Whether the conversion keeps everything as it is.
+    ///
+    bool isIdentity = true;
+};
+
+///
+/// \brief Computes the conversion between two bases.
+///
+/// The axes of each basis are normalized and expected to be orthogonal. The origin of
+/// the source basis is kept.
+///
+/// \param source Basis of the data, e.g. of the art tool.
+/// \param target Basis the data gets converted to.
+/// \return Conversion or the identity if a basis is degenerated.
+///
+Conversion compute(const Basis& source, const Basis& target);
+
+///
+/// \brief Converts positions in place, one position per SSE register.
+/// \param positions Position of the first point, three floats.
+/// \param count Number of positions.
+/// \param stride Number of bytes between consecutive positions.
+///
+void transformPoints(const Conversion& conversion, float* positions, size_t count, size_t stride);
+
+///
+/// \brief Converts directions in place, e.g. normals or morph target normal deltas.
+/// \param directions First direction, three floats.
+/// \param count Number of directions.
+/// \param stride Number of bytes between consecutive directions.
+///
+void transformDirections(const Conversion& conversion, float* directions, size_t count, size_t stride);
+
+///
+/// \brief Converts packed granny quaternions (x, y, z, w) in place.
+/// \param quaternions First quaternion, four floats.
+/// \param count Number of quaternions.
+///
+void transformQuaternions(const Conversion& conversion, float* quaternions, size_t count);
+
+///
+/// \brief Converts packed 3x3 scale shear matrices in place.
+/// \param scaleShears First matrix, nine floats.
+/// \param count Number of matrices.
+///
+void transformScaleShears(const Conversion& conversion, float* scaleShears, size_t count);
+
+///
+/// \brief Converts the parts of a granny transform in place, e.g. of a bone local transform or an initial placement.
+/// \param position Position, three floats.
+/// \param orientation Quaternion (x, y, z, w).
+/// \param scaleShear 3x3 scale shear matrix.
+///
+void transformTransform(const Conversion& conversion, float position[3], float orientation[4], float scaleShear[3][3]);
+
+///
+/// \brief Converts an affine row vector matrix in place, e.g. a bone inverse world transform.
+/// \param matrix Matrix with the translation in the last row.
+///
+void transformMatrix(const Conversion& conversion, float matrix[4][4]);
+
+///
+/// \brief Converts an axis aligned box in place to the box around the converted box.
+/// \param min Minimum of the box
+/// \param max Maximum of the box
+///
+void transformBox(const Conversion& conversion, float min[3], float max[3]);
+
+} // namespace GCL::Utilities::BasisConversion
@@ -0,0 +1,132 @@
+#include "gcl/utilities/bonepartitioner.h"
+
+#include <algorithm>
+
+namespace GCL::Utilities::BonePartitioner {
+
+namespace {
+
+///
+/// \brief Marks a bone or triangle which is not touched by a partition yet.
+///
+constexpr unsigned INVALID_INDEX = ~0u;
+
+} // namespace
+
+vector<Partition> partition(
+    const unsigned* indices,
+    size_t indexCount,
+    size_t vertexCount,
+    const unsigned* triangleBoneOffsets,
+    const unsigned* triangleBones,
+    size_t paletteSize)
+{
+    const auto triangleCount = indexCount / 3;
+
+    // Triangles of each vertex to grow partitions over neighbouring triangles.
+    vector<unsigned> offsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++) {
+        offsets[indices[i] + 1]++;
+    }
+
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        offsets[vertex + 1] += offsets[vertex];
+    }
+
+    vector<unsigned> vertexTriangles(triangleCount * 3);
+    {
+        vector<unsigned> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; i++) {
+            vertexTriangles[fill[indices[i]]++] = static_cast<unsigned>(i / 3);
+        }
+    }
+
+    unsigned boneCount = 0;
+    for (size_t i = 0; i < triangleBoneOffsets[triangleCount]; i++) {
+        boneCount = max(boneCount, triangleBones[i] + 1);
+    }
+
+    // Bones in the palette and triangles tried by a partition are marked with the partition index.
+    vector<unsigned> bonePartitions(boneCount, INVALID_INDEX);
+    vector<unsigned> triedPartitions(triangleCount, INVALID_INDEX);
+    vector<bool> isAssigned(triangleCount, false);
+
+    vector<Partition> partitions;
+    vector<unsigned> queue;
+    size_t nextSeed = 0;
+
+    for (;;) {
+        while (nextSeed < triangleCount && isAssigned[nextSeed]) {
+            nextSeed++;
+        }
+
+        if (nextSeed == triangleCount) {
+            break;
+        }
+
+        const auto partitionIndex = static_cast<unsigned>(partitions.size());
+        partitions.emplace_back();
+        auto& current = partitions.back();
+
+        const auto tryAdd = [&](unsigned triangle) {
+            size_t newBoneCount = 0;
+            for (auto i = triangleBoneOffsets[triangle]; i < triangleBoneOffsets[triangle + 1]; i++) {
+                newBoneCount += bonePartitions[triangleBones[i]] != partitionIndex;
+            }
+
+            if (!current.triangles.empty() && current.bones.size() + newBoneCount > paletteSize) {
+                return false;
+            }
+
+            for (auto i = triangleBoneOffsets[triangle]; i < triangleBoneOffsets[triangle + 1]; i++) {
+                if (bonePartitions[triangleBones[i]] != partitionIndex) {
+                    bonePartitions[triangleBones[i]] = partitionIndex;
+                    current.bones.push_back(triangleBones[i]);
+                }
+            }
+
+            isAssigned[triangle] = true;
+            current.triangles.push_back(triangle);
+            return true;
+        };
+
+        queue.assign(1, static_cast<unsigned>(nextSeed));
+        triedPartitions[nextSeed] = partitionIndex;
+        tryAdd(static_cast<unsigned>(nextSeed));
+
+        // Grow over neighbouring triangles, they most likely share bones.
+        for (size_t head = 0; head < queue.size(); head++) {
+            const auto triangle = queue[head];
+
+            for (auto corner = 0; corner < 3; corner++) {
+                const auto vertex = indices[static_cast<size_t>(triangle) * 3 + static_cast<size_t>(corner)];
+
+                for (auto i = offsets[vertex]; i < offsets[vertex + 1]; i++) {
+                    const auto neighbour = vertexTriangles[i];
+                    if (isAssigned[neighbour] || triedPartitions[neighbour] == partitionIndex) {
+                        continue;
+                    }
+
+                    triedPartitions[neighbour] = partitionIndex;
+                    if (tryAdd(neighbour)) {
+                        queue.push_back(neighbour);
+                    }
+                }
+            }
+        }
+
+        // Pick up disconnected triangles which fit the palette, e.g. of other material groups.
+        for (auto triangle = nextSeed; triangle < triangleCount; triangle++) {
+            if (!isAssigned[triangle]) {
+                tryAdd(static_cast<unsigned>(triangle));
+            }
+        }
+
+        sort(current.triangles.begin(), current.triangles.end());
+        sort(current.bones.begin(), current.bones.end());
+    }
+
+    return partitions;
+}
+
+} // namespace GCL::Utilities::BonePartitioner
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace GCL::Utilities::BonePartitioner {
+
+using namespace std;
+
+///
+/// \brief Triangles of a mesh which are skinned by a bone palette.
+///
+struct Partition {
+    ///
+    /// \brief Triangle indices in ascending order.
+    ///
+    vector<unsigned> triangles;
+
+    ///
+    /// \brief Bones referenced by the triangles in ascending order.
+    ///
+    vector<unsigned> bones;
+};
+
+///
+/// \brief Partitions the triangles of a mesh so that each partition references at most palette size bones.
+///
+/// Partitions are grown greedily from the first unassigned triangle over triangles sharing
+/// vertices, followed by a sweep over the remaining triangles which still fit the palette.
+/// A triangle referencing more bones than the palette size gets a partition on its own.
+///
+/// \param indices Triangle list indices.
+/// \param indexCount Number of indices, a multiple of three.
+/// \param vertexCount Number of vertices.
+/// \param triangleBoneOffsets Offset of the bones of each triangle in triangleBones, one more than triangles.
+/// \param triangleBones Bones referenced by the triangles.
+/// \param paletteSize Maximum number of bones per partition.
+/// \return Partitions covering all triangles.
+///
+vector<Partition> partition(
+    const unsigned* indices,
+    size_t indexCount,
+    size_t vertexCount,
+    const unsigned* triangleBoneOffsets,
+    const unsigned* triangleBones,
+    size_t paletteSize);
+
+} // namespace GCL::Utilities::BonePartitioner
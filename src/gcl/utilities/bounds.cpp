@@ -0,0 +1,151 @@
+#include "gcl/utilities/bounds.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE__)
+#define GCL_BOUNDS_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace GCL::Utilities::Bounds {
+
+using namespace std;
+
+namespace {
+
+///
+/// \brief Returns the position of a point.
+///
+const float* getPosition(const float* positions, size_t stride, size_t index)
+{
+    return reinterpret_cast<const float*>(reinterpret_cast<const unsigned char*>(positions) + index * stride);
+}
+
+///
+/// \brief Returns the number of points of which four floats can be loaded without reading past the last point.
+///
+size_t getVectorCount(size_t count, size_t stride)
+{
+    return stride >= 4 * sizeof(float) ? count : (count > 0 ? count - 1 : 0);
+}
+
+} // namespace
+
+Box computeBox(const float* positions, size_t count, size_t stride)
+{
+    Box box;
+    size_t index = 0;
+
+#ifdef GCL_BOUNDS_SSE
+    const auto vectorCount = getVectorCount(count, stride);
+    if (vectorCount > 0) {
+        auto minimum = _mm_loadu_ps(getPosition(positions, stride, 0));
+        auto maximum = minimum;
+
+        for (index = 1; index < vectorCount; index++) {
+            const auto position = _mm_loadu_ps(getPosition(positions, stride, index));
+            minimum = _mm_min_ps(minimum, position);
+            maximum = _mm_max_ps(maximum, position);
+        }
+
+        // The fourth lane holds whatever follows the position and is ignored.
+        float lanes[4];
+        _mm_storeu_ps(lanes, minimum);
+        copy(lanes, lanes + 3, box.min);
+        _mm_storeu_ps(lanes, maximum);
+        copy(lanes, lanes + 3, box.max);
+    }
+#endif
+
+    for (; index < count; index++) {
+        const auto position = getPosition(positions, stride, index);
+        for (auto axis = 0; axis < 3; axis++) {
+            box.min[axis] = min(box.min[axis], position[axis]);
+            box.max[axis] = max(box.max[axis], position[axis]);
+        }
+    }
+
+    return box;
+}
+
+float computeRadius(const float* positions, size_t count, size_t stride, const float center[3])
+{
+    auto maxDistance = 0.0f;
+    size_t index = 0;
+
+#ifdef GCL_BOUNDS_SSE
+    const auto vectorCount = getVectorCount(count, stride);
+    if (vectorCount > 0) {
+        const auto centerVector = _mm_set_ps(0.0f, center[2], center[1], center[0]);
+        auto maxSquares = _mm_setzero_ps();
+
+        for (; index < vectorCount; index++) {
+            const auto delta = _mm_sub_ps(_mm_loadu_ps(getPosition(positions, stride, index)), centerVector);
+            const auto squares = _mm_mul_ps(delta, delta);
+
+            // Sum up the three squares in the first lane, the fourth lane is never added.
+            auto sum = _mm_add_ps(squares, _mm_movehl_ps(squares, squares));
+            sum = _mm_add_ss(sum, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(1, 1, 1, 1)));
+            maxSquares = _mm_max_ss(maxSquares, sum);
+        }
+
+        maxDistance = _mm_cvtss_f32(maxSquares);
+    }
+#endif
+
+    for (; index < count; index++) {
+        const auto position = getPosition(positions, stride, index);
+        const float delta[3] = { position[0] - center[0], position[1] - center[1], position[2] - center[2] };
+        maxDistance = max(maxDistance, delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2]);
+    }
+
+    return sqrtf(maxDistance);
+}
+
+void getCenter(const Box& box, float center[3])
+{
+    for (auto axis = 0; axis < 3; axis++) {
+        center[axis] = box.isEmpty() ? 0.0f : 0.5f * (box.min[axis] + box.max[axis]);
+    }
+}
+
+void merge(Box& box, const Box& other)
+{
+    for (auto axis = 0; axis < 3; axis++) {
+        box.min[axis] = min(box.min[axis], other.min[axis]);
+        box.max[axis] = max(box.max[axis], other.max[axis]);
+    }
+}
+
+Box transform(const Box& box, const PoseMatrix& matrix)
+{
+    Box result;
+    if (box.isEmpty()) {
+        return result;
+    }
+
+    float center[3];
+    float extents[3];
+    for (auto axis = 0; axis < 3; axis++) {
+        center[axis] = 0.5f * (box.min[axis] + box.max[axis]);
+        extents[axis] = 0.5f * (box.max[axis] - box.min[axis]);
+    }
+
+    for (auto column = 0; column < 3; column++) {
+        auto transformedCenter = matrix.rows[3][column];
+        auto transformedExtent = 0.0f;
+
+        for (auto row = 0; row < 3; row++) {
+            transformedCenter += center[row] * matrix.rows[row][column];
+            transformedExtent += extents[row] * fabsf(matrix.rows[row][column]);
+        }
+
+        result.min[column] = transformedCenter - transformedExtent;
+        result.max[column] = transformedCenter + transformedExtent;
+    }
+
+    return result;
+}
+
+} // namespace GCL::Utilities::Bounds
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "gcl/utilities/poseengine.h"
+
+#include <cfloat>
+#include <cstddef>
+
+namespace GCL::Utilities::Bounds {
+
+///
+/// \brief Axis aligned bounding box, empty until a point is added.
+///
+struct Box {
+    float min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    ///
+    /// \brief Returns whether the box contains no point.
+    ///
+    bool isEmpty() const
+    {
+        return min[0] > max[0] || min[1] > max[1] || min[2] > max[2];
+    }
+};
+
+///
+/// \brief Bounding sphere.
+///
+struct Sphere {
+    float center[3] = { 0.0f, 0.0f, 0.0f };
+    float radius = 0.0f;
+};
+
+///
+/// \brief Computes the bounding box of points, one point per SSE register.
+/// \param positions Position of the first point, three floats.
+/// \param count Number of points.
+/// \param stride Number of bytes between consecutive positions.
+/// \return Bounding box, empty if there are no points.
+///
+Box computeBox(const float* positions, size_t count, size_t stride);
+
+///
+/// \brief Computes the radius of the sphere around a center which contains all points.
+/// \param positions Position of the first point, three floats.
+/// \param count Number of points.
+/// \param stride Number of bytes between consecutive positions.
+/// \param center Center of the sphere, e.g. of the bounding box.
+/// \return Radius of the sphere
+///
+float computeRadius(const float* positions, size_t count, size_t stride, const float center[3]);
+
+///
+/// \brief Returns the center of a box.
+///
+void getCenter(const Box& box, float center[3]);
+
+///
+/// \brief Extends a box by another box.
+///
+void merge(Box& box, const Box& other);
+
+///
+/// \brief Returns the bounding box of a transformed box.
+///
+/// The box is transformed as center and extents, so no corner needs to be transformed.
+///
+/// \param box Box in the space of the transform, e.g. of a bone.
+/// \param matrix Row vector transform, e.g. a bone world transform.
+/// \return Bounding box of the transformed box.
+///
+Box transform(const Box& box, const PoseMatrix& matrix);
+
+} // namespace GCL::Utilities::Bounds
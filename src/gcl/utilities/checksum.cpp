@@ -0,0 +1,58 @@
+#include "gcl/utilities/checksum.h"
+
+#include <algorithm>
+#include <array>
+
+namespace GCL::Utilities {
+
+uint32_t adler32(const unsigned char* data, size_t size)
+{
+    // Largest number of bytes before the sums may overflow.
+    constexpr size_t MaxRunLength = 5552;
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+
+    while (size > 0) {
+        const auto runLength = min(size, MaxRunLength);
+
+        for (size_t i = 0; i < runLength; i++) {
+            a += data[i];
+            b += a;
+        }
+
+        a %= 65521;
+        b %= 65521;
+        data += runLength;
+        size -= runLength;
+    }
+
+    return (b << 16) | a;
+}
+
+uint32_t crc32(const unsigned char* data, size_t size, uint32_t crc)
+{
+    static const auto table = [] {
+        array<uint32_t, 256> values;
+
+        for (uint32_t i = 0; i < 256; i++) {
+            auto value = i;
+            for (auto bit = 0; bit < 8; bit++) {
+                value = value & 1 ? 0xedb88320u ^ (value >> 1) : value >> 1;
+            }
+            values[i] = value;
+        }
+
+        return values;
+    }();
+
+    crc = ~crc;
+
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+} // namespace GCL::Utilities
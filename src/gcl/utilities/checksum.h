@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief Computes the Adler-32 checksum of data, e.g. for zlib streams.
+/// \param data Data
+/// \param size Size of the data in bytes.
+/// \return Checksum
+///
+uint32_t adler32(const unsigned char* data, size_t size);
+
+///
+/// \brief Computes the CRC-32 (ISO 3309) of data, e.g. for png chunks or granny files.
+/// \param data Data
+/// \param size Size of the data in bytes.
+/// \param crc CRC of preceding data to continue.
+/// \return CRC
+///
+uint32_t crc32(const unsigned char* data, size_t size, uint32_t crc = 0);
+
+} // namespace GCL::Utilities
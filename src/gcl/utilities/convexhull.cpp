@@ -0,0 +1,320 @@
+#include "gcl/utilities/convexhull.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+namespace GCL::Utilities::ConvexHull {
+
+using namespace std;
+
+namespace {
+
+using Point = array<double, 3>;
+
+///
+/// \brief Marks a vertex which is not part of the hull.
+///
+constexpr unsigned INVALID_INDEX = ~0u;
+
+///
+/// \brief Triangle of the hull with the points outside of it.
+///
+struct Face {
+    unsigned vertices[3];
+    Point normal;
+    double offset = 0.0;
+    vector<unsigned> outside;
+    bool isAlive = true;
+};
+
+Point subtract(const Point& a, const Point& b)
+{
+    return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+}
+
+Point cross(const Point& a, const Point& b)
+{
+    return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+}
+
+double dot(const Point& a, const Point& b)
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+///
+/// \brief Creates a face, its normal follows the counter clockwise order of the vertices.
+///
+Face createFace(const vector<Point>& points, unsigned a, unsigned b, unsigned c)
+{
+    Face face;
+    face.vertices[0] = a;
+    face.vertices[1] = b;
+    face.vertices[2] = c;
+    face.normal = cross(subtract(points[b], points[a]), subtract(points[c], points[a]));
+
+    // Faces without area are never visible, their neighbours enclose the same points.
+    const auto length = sqrt(dot(face.normal, face.normal));
+    if (length > 0.0) {
+        face.normal = { face.normal[0] / length, face.normal[1] / length, face.normal[2] / length };
+        face.offset = dot(face.normal, points[a]);
+    } else {
+        face.normal = { 0.0, 0.0, 0.0 };
+    }
+
+    return face;
+}
+
+double getDistance(const Face& face, const Point& point)
+{
+    return dot(face.normal, point) - face.offset;
+}
+
+uint64_t edgeKey(unsigned a, unsigned b)
+{
+    return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+///
+/// \brief Adds points to the first face they are outside of, points inside all faces are dropped.
+///
+void assignPoints(const vector<Point>& points, const vector<unsigned>& candidates, vector<Face>& faces, size_t firstFace, double epsilon)
+{
+    for (const auto point : candidates) {
+        for (auto faceIndex = firstFace; faceIndex < faces.size(); faceIndex++) {
+            if (getDistance(faces[faceIndex], points[point]) > epsilon) {
+                faces[faceIndex].outside.push_back(point);
+                break;
+            }
+        }
+    }
+}
+
+} // namespace
+
+Hull build(const float* positions, size_t count, size_t stride, size_t maxVertices)
+{
+    if (count < 4) {
+        return Hull();
+    }
+
+    vector<Point> points(count);
+    Point minimum = { HUGE_VAL, HUGE_VAL, HUGE_VAL };
+    Point maximum = { -HUGE_VAL, -HUGE_VAL, -HUGE_VAL };
+    unsigned extremes[3][2] = {};
+
+    for (size_t i = 0; i < count; i++) {
+        const auto position = reinterpret_cast<const float*>(reinterpret_cast<const unsigned char*>(positions) + i * stride);
+
+        for (auto axis = 0; axis < 3; axis++) {
+            points[i][axis] = static_cast<double>(position[axis]);
+
+            if (points[i][axis] < minimum[axis]) {
+                minimum[axis] = points[i][axis];
+                extremes[axis][0] = static_cast<unsigned>(i);
+            }
+
+            if (points[i][axis] > maximum[axis]) {
+                maximum[axis] = points[i][axis];
+                extremes[axis][1] = static_cast<unsigned>(i);
+            }
+        }
+    }
+
+    // Distances below the tolerance count as on the hull, relative to the extent of the points.
+    auto axis = 0;
+    for (auto other = 1; other < 3; other++) {
+        if (maximum[other] - minimum[other] > maximum[axis] - minimum[axis]) {
+            axis = other;
+        }
+    }
+
+    const auto extent = maximum[axis] - minimum[axis];
+    const auto epsilon = extent * 1e-6;
+    if (extent <= 0.0) {
+        return Hull();
+    }
+
+    // Initial tetrahedron: the extremes of the longest axis, the farthest point from
+    // their line and the farthest point from the plane of those three.
+    const auto i0 = extremes[axis][0];
+    const auto i1 = extremes[axis][1];
+    const auto direction = subtract(points[i1], points[i0]);
+
+    auto i2 = INVALID_INDEX;
+    auto maxLineDistance = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        const auto offset = cross(direction, subtract(points[i], points[i0]));
+        const auto lineDistance = dot(offset, offset);
+        if (lineDistance > maxLineDistance) {
+            maxLineDistance = lineDistance;
+            i2 = static_cast<unsigned>(i);
+        }
+    }
+
+    if (i2 == INVALID_INDEX || sqrt(maxLineDistance / dot(direction, direction)) <= epsilon) {
+        return Hull();
+    }
+
+    const auto base = createFace(points, i0, i1, i2);
+    auto i3 = INVALID_INDEX;
+    auto maxPlaneDistance = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        const auto planeDistance = fabs(getDistance(base, points[i]));
+        if (planeDistance > maxPlaneDistance) {
+            maxPlaneDistance = planeDistance;
+            i3 = static_cast<unsigned>(i);
+        }
+    }
+
+    if (i3 == INVALID_INDEX || maxPlaneDistance <= epsilon) {
+        return Hull();
+    }
+
+    vector<Face> faces;
+    faces.push_back(createFace(points, i0, i1, i2));
+    faces.push_back(createFace(points, i0, i3, i1));
+    faces.push_back(createFace(points, i1, i3, i2));
+    faces.push_back(createFace(points, i2, i3, i0));
+
+    // Flip the tetrahedron if its faces point inwards.
+    if (getDistance(faces[0], points[i3]) > 0.0) {
+        for (auto& face : faces) {
+            face = createFace(points, face.vertices[0], face.vertices[2], face.vertices[1]);
+        }
+    }
+
+    unordered_map<uint64_t, unsigned> edgeFaces;
+    for (unsigned faceIndex = 0; faceIndex < faces.size(); faceIndex++) {
+        for (auto corner = 0; corner < 3; corner++) {
+            edgeFaces[edgeKey(faces[faceIndex].vertices[corner], faces[faceIndex].vertices[(corner + 1) % 3])] = faceIndex;
+        }
+    }
+
+    vector<unsigned> candidates;
+    for (size_t i = 0; i < count; i++) {
+        if (i != i0 && i != i1 && i != i2 && i != i3) {
+            candidates.push_back(static_cast<unsigned>(i));
+        }
+    }
+
+    assignPoints(points, candidates, faces, 0, epsilon);
+
+    size_t vertexCount = 4;
+    vector<unsigned> visibleFaces;
+    vector<pair<unsigned, unsigned>> horizon;
+
+    while (maxVertices == 0 || vertexCount < max<size_t>(maxVertices, 4)) {
+        // Add the point farthest outside of the hull.
+        auto eyeFace = INVALID_INDEX;
+        auto eye = INVALID_INDEX;
+        auto maxDistance = epsilon;
+
+        for (unsigned faceIndex = 0; faceIndex < faces.size(); faceIndex++) {
+            if (!faces[faceIndex].isAlive) {
+                continue;
+            }
+
+            for (const auto point : faces[faceIndex].outside) {
+                const auto distance = getDistance(faces[faceIndex], points[point]);
+                if (distance > maxDistance) {
+                    maxDistance = distance;
+                    eyeFace = faceIndex;
+                    eye = point;
+                }
+            }
+        }
+
+        if (eye == INVALID_INDEX) {
+            break;
+        }
+
+        // Faces visible from the point are connected, the edges to the faces behind form the horizon.
+        visibleFaces.assign(1, eyeFace);
+        faces[eyeFace].isAlive = false;
+        horizon.clear();
+
+        for (size_t head = 0; head < visibleFaces.size(); head++) {
+            const auto& face = faces[visibleFaces[head]];
+
+            for (auto corner = 0; corner < 3; corner++) {
+                const auto a = face.vertices[corner];
+                const auto b = face.vertices[(corner + 1) % 3];
+                const auto neighbour = edgeFaces.find(edgeKey(b, a));
+
+                if (neighbour == edgeFaces.end()) {
+                    continue;
+                }
+
+                auto& neighbourFace = faces[neighbour->second];
+                if (!neighbourFace.isAlive) {
+                    continue;
+                }
+
+                if (getDistance(neighbourFace, points[eye]) > epsilon) {
+                    neighbourFace.isAlive = false;
+                    visibleFaces.push_back(neighbour->second);
+                } else {
+                    horizon.emplace_back(a, b);
+                }
+            }
+        }
+
+        candidates.clear();
+        for (const auto faceIndex : visibleFaces) {
+            auto& face = faces[faceIndex];
+            for (auto corner = 0; corner < 3; corner++) {
+                edgeFaces.erase(edgeKey(face.vertices[corner], face.vertices[(corner + 1) % 3]));
+            }
+
+            for (const auto point : face.outside) {
+                if (point != eye) {
+                    candidates.push_back(point);
+                }
+            }
+
+            face.outside.clear();
+            face.outside.shrink_to_fit();
+        }
+
+        const auto firstFace = faces.size();
+        for (const auto& edge : horizon) {
+            const auto faceIndex = static_cast<unsigned>(faces.size());
+            faces.push_back(createFace(points, edge.first, edge.second, eye));
+
+            edgeFaces[edgeKey(edge.first, edge.second)] = faceIndex;
+            edgeFaces[edgeKey(edge.second, eye)] = faceIndex;
+            edgeFaces[edgeKey(eye, edge.first)] = faceIndex;
+        }
+
+        assignPoints(points, candidates, faces, firstFace, epsilon);
+        vertexCount++;
+    }
+
+    Hull hull;
+    vector<unsigned> remap(count, INVALID_INDEX);
+
+    for (const auto& face : faces) {
+        if (!face.isAlive) {
+            continue;
+        }
+
+        for (const auto vertex : face.vertices) {
+            if (remap[vertex] == INVALID_INDEX) {
+                remap[vertex] = static_cast<unsigned>(hull.positions.size() / 3);
+                for (auto component = 0; component < 3; component++) {
+                    hull.positions.push_back(static_cast<float>(points[vertex][component]));
+                }
+            }
+
+            hull.indices.push_back(remap[vertex]);
+        }
+    }
+
+    return hull;
+}
+
+} // namespace GCL::Utilities::ConvexHull
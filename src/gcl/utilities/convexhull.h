@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace GCL::Utilities::ConvexHull {
+
+using namespace std;
+
+///
+/// \brief Triangulated convex hull.
+///
+struct Hull {
+    ///
+    /// \brief Hull vertices, three floats per vertex.
+    ///
+    vector<float> positions;
+
+    ///
+    /// \brief Triangle list indices, counter clockwise seen from outside.
+    ///
+    vector<unsigned> indices;
+};
+
+///
+/// \brief Builds the convex hull of points with quickhull.
+///
+/// Starts with a tetrahedron of extreme points and repeatedly adds the point farthest
+/// outside of the hull. If the number of vertices is limited, the hull stops growing at
+/// the limit, which approximates the full hull with its most distant points.
+///
+/// \param positions Position of the first point, three floats.
+/// \param count Number of points.
+/// \param stride Number of bytes between consecutive positions.
+/// \param maxVertices Maximum number of hull vertices, at least four. Zero for no limit.
+/// \return Convex hull or an empty hull if the points are coplanar.
+///
+Hull build(const float* positions, size_t count, size_t stride, size_t maxVertices = 0);
+
+} // namespace GCL::Utilities::ConvexHull
@@ -8,6 +8,22 @@ namespace GCL::Utilities::Datetime {
 
 using namespace std::chrono;
 
+namespace {
+
+///
+/// \brief Converts a calendar time to the local time, thread safe on every platform.
+///
+void toLocalTime(time_t time, tm& timeInfo)
+{
+#ifdef _WIN32
+    localtime_s(&timeInfo, &time);
+#else
+    localtime_r(&time, &timeInfo);
+#endif
+}
+
+} // namespace
+
 unsigned nowMs()
 {
     system_clock::time_point now = system_clock::now();
@@ -20,7 +36,7 @@ string nowTime(const char* format)
 {
     tm nowTimeInfo;
     time_t nowTime = system_clock::to_time_t(system_clock::now());
-    localtime_s(&nowTimeInfo, &nowTime);
+    toLocalTime(nowTime, nowTimeInfo);
 
     ostringstream result;
     result << put_time(&nowTimeInfo, format);
@@ -30,10 +46,31 @@ string nowTime(const char* format)
 
 string nowTimeMs(const char* format)
 {
+    return timeMs(system_clock::now(), format);
+}
+
+string time(system_clock::time_point time, const char* format)
+{
+    tm timeInfo;
+    time_t timeSeconds = system_clock::to_time_t(time);
+    toLocalTime(timeSeconds, timeInfo);
+
+    ostringstream result;
+    result << put_time(&timeInfo, format);
+
+    return result.str();
+}
+
+string timeMs(system_clock::time_point time, const char* format)
+{
+    const auto timeMilliseconds = duration_cast<milliseconds>(time.time_since_epoch()) % 1000;
+
     ostringstream result;
-    result << nowTime(format)
+    result << Datetime::time(time, format)
            << "."
-           << nowMs();
+           << setw(3)
+           << setfill('0')
+           << timeMilliseconds.count();
 
     return result.str();
 }
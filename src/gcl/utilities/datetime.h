@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 
 namespace GCL::Utilities::Datetime {
@@ -25,4 +26,18 @@ string nowTime(const char* format = DEFAULT_FORMAT);
 ///
 string nowTimeMs(const char* format = DEFAULT_FORMAT);
 
+///
+/// \brief Returns a time without milliseconds.
+/// \param time Time point to format.
+/// \param Time format, see: https://en.cppreference.com/w/cpp/io/manip/put_time
+///
+string time(chrono::system_clock::time_point time, const char* format = DEFAULT_FORMAT);
+
+///
+/// \brief Returns a time with milliseconds.
+/// \param time Time point to format.
+/// \param Time format, see: https://en.cppreference.com/w/cpp/io/manip/put_time
+///
+string timeMs(chrono::system_clock::time_point time, const char* format = DEFAULT_FORMAT);
+
 } // namespace GCL::Utilities::Datetime
@@ -1,9 +1,18 @@
 #include "gcl/utilities/devilimageutility.h"
 
-#include <IL/ilu.h>
+#include "gcl/utilities/imagewriter.h"
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/stringutility.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include <IL/il.h>
 
 namespace GCL::Utilities {
 
+using namespace GCL::Utilities::Logging;
+
 void initializeDevilImageLibrary()
 {
     ilInit();
@@ -14,21 +23,81 @@ void shutdownDevilImageLibrary()
     ilShutDown();
 }
 
-void convertImage(string sourceFilePath, string targetFilePath, bool flipImage)
+mutex& devilImageLibraryMutex()
+{
+    static mutex devilMutex;
+    return devilMutex;
+}
+
+bool loadImage(string filePath, DecodedImage& image)
 {
+    lock_guard<mutex> lockGuard(devilImageLibraryMutex());
+
     ILuint imageId;
     ilGenImages(1, &imageId);
     ilBindImage(imageId);
-    ilLoadImage(sourceFilePath.c_str());
 
-    ilConvertImage(IL_RGBA, IL_UNSIGNED_BYTE);
+    auto isLoaded = ilLoadImage(filePath.c_str()) && ilConvertImage(IL_RGBA, IL_UNSIGNED_BYTE);
+
+    if (isLoaded) {
+        image.width = ilGetInteger(IL_IMAGE_WIDTH);
+        image.height = ilGetInteger(IL_IMAGE_HEIGHT);
+        image.pixels.resize(static_cast<size_t>(image.width) * static_cast<size_t>(image.height) * 4);
+
+        ilCopyPixels(0, 0, 0, image.width, image.height, 1, IL_RGBA, IL_UNSIGNED_BYTE, image.pixels.data());
 
-    if (flipImage) {
-        iluFlipImage();
+        // Devil image library keeps the origin of the file - store the top row first.
+        if (ilGetInteger(IL_IMAGE_ORIGIN) == IL_ORIGIN_LOWER_LEFT) {
+            const auto rowSize = static_cast<size_t>(image.width) * 4;
+            for (auto y = 0; y < image.height / 2; y++) {
+                swap_ranges(
+                    image.pixels.begin() + static_cast<ptrdiff_t>(y * rowSize),
+                    image.pixels.begin() + static_cast<ptrdiff_t>((y + 1) * rowSize),
+                    image.pixels.begin() + static_cast<ptrdiff_t>((image.height - 1 - y) * rowSize));
+            }
+        }
     }
 
-    ilSaveImage(targetFilePath.c_str());
-    ilDeleteImage(imageId);
+    ilDeleteImages(1, &imageId);
+
+    return isLoaded;
+}
+
+void convertImage(string sourceFilePath, string targetFilePath, bool flipImage)
+{
+    auto sourceExtension = filesystem::u8path(sourceFilePath).extension().u8string();
+    auto targetExtension = filesystem::u8path(targetFilePath).extension().u8string();
+    toLower(sourceExtension);
+    toLower(targetExtension);
+
+    // Pass the file through if no conversion is needed, e.g. dds files keep their compressed blocks.
+    if (!flipImage && sourceExtension == targetExtension) {
+        error_code errorCode;
+        filesystem::copy_file(filesystem::u8path(sourceFilePath), filesystem::u8path(targetFilePath), filesystem::copy_options::overwrite_existing, errorCode);
+
+        if (errorCode) {
+            warning("Failed to copy texture \"%s\": %s", sourceFilePath.c_str(), errorCode.message().c_str());
+        }
+
+        return;
+    }
+
+    DecodedImage decodedImage;
+
+    if (!loadImage(sourceFilePath, decodedImage)) {
+        warning("Failed to load texture \"%s\".", sourceFilePath.c_str());
+        return;
+    }
+
+    ImageView image;
+    image.pixels = decodedImage.pixels.data();
+    image.width = decodedImage.width;
+    image.height = decodedImage.height;
+    image.channels = 4;
+
+    if (!writeImage(targetFilePath, image, flipImage)) {
+        warning("Failed to write texture \"%s\".", targetFilePath.c_str());
+    }
 }
 
 } // namespace GCL::Utilities
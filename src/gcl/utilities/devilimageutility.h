@@ -1,6 +1,9 @@
 #pragma once
 
+#include "gcl/utilities/texturedecoder.h"
+
 #include <iostream>
+#include <mutex>
 
 namespace GCL::Utilities {
 
@@ -17,7 +20,28 @@ void initializeDevilImageLibrary();
 void shutdownDevilImageLibrary();
 
 ///
-/// \brief Converts a image using devil image library.
+/// \brief Returns the mutex which guards the global state of devil image library.
+///
+/// Devil image library works on a global bound image, so only one image may be
+/// processed at a time.
+///
+mutex& devilImageLibraryMutex();
+
+///
+/// \brief Loads an image file to 8 bit RGBA pixels using devil image library.
+/// \param filePath File path of the image.
+/// \param image Decoded image with the top row first.
+/// \return Returns whether the image could be loaded.
+///
+bool loadImage(string filePath, DecodedImage& image);
+
+///
+/// \brief Converts a image file to the format of the target file extension.
+///
+/// Devil image library is only used to load the source image. The image is written by
+/// the in-tree image writer outside of the devil lock, so conversions may run in parallel.
+/// Files with the same extension are copied if the image does not need to be flipped.
+///
 /// \param sourceFilePath
 /// \param targetFilePath
 /// \param flipImage
@@ -98,4 +98,30 @@ bool FbxSdkCommon::SaveScene(FbxManager* fbxManager, FbxScene* scene, const char
     return status;
 }
 
+FbxAMatrix FbxSdkCommon::toFbxMatrix(const VectorMath::Matrix4& matrix)
+{
+    FbxAMatrix fbxMatrix;
+    for (auto row = 0; row < 4; row++) {
+        fbxMatrix.SetRow(row, FbxVector4(
+                                  static_cast<double>(matrix.rows[row][0]),
+                                  static_cast<double>(matrix.rows[row][1]),
+                                  static_cast<double>(matrix.rows[row][2]),
+                                  static_cast<double>(matrix.rows[row][3])));
+    }
+
+    return fbxMatrix;
+}
+
+FbxDouble3 FbxSdkCommon::toFbxDouble3(const VectorMath::Vector3& vector)
+{
+    return FbxDouble3(static_cast<double>(vector[0]), static_cast<double>(vector[1]), static_cast<double>(vector[2]));
+}
+
+FbxTime FbxSdkCommon::toFbxTime(double seconds)
+{
+    FbxTime time;
+    time.SetSecondDouble(seconds);
+    return time;
+}
+
 } // namespace GCL::Utilities
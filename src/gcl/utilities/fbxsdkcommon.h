@@ -1,5 +1,7 @@
 #pragma once
 
+#include "gcl/utilities/vectormath.h"
+
 #include <fbxsdk.h>
 
 namespace GCL::Utilities {
@@ -32,6 +34,27 @@ public:
     /// \return Returns whether export was successful or not.
     ///
     static bool SaveScene(FbxManager* fbxManager, FbxScene* scene, const char* filename, bool embedMedia = false, bool ascii = false);
+
+    ///
+    /// \brief Converts a matrix of the import side to a fbx matrix.
+    /// \param matrix Row vector matrix
+    /// \return Fbx matrix
+    ///
+    static FbxAMatrix toFbxMatrix(const VectorMath::Matrix4& matrix);
+
+    ///
+    /// \brief Converts a vector of the import side to a fbx vector.
+    /// \param vector Vector
+    /// \return Fbx vector
+    ///
+    static FbxDouble3 toFbxDouble3(const VectorMath::Vector3& vector);
+
+    ///
+    /// \brief Converts a time in seconds to a fbx time.
+    /// \param seconds Time in seconds
+    /// \return Fbx time
+    ///
+    static FbxTime toFbxTime(double seconds);
 };
 
 } // namespace GCL::Utilities
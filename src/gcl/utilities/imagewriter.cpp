@@ -0,0 +1,649 @@
+#include "gcl/utilities/imagewriter.h"
+
+#include "gcl/utilities/checksum.h"
+#include "gcl/utilities/stringutility.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace GCL::Utilities {
+
+namespace {
+
+///
+/// \brief Writes bits least significant bit first as required by deflate.
+///
+class BitWriter {
+public:
+    explicit BitWriter(vector<unsigned char>& output)
+        : m_output(output)
+    {
+    }
+
+    void write(uint32_t bits, int count)
+    {
+        m_buffer |= static_cast<uint64_t>(bits) << m_count;
+        m_count += count;
+
+        while (m_count >= 8) {
+            m_output.push_back(static_cast<unsigned char>(m_buffer));
+            m_buffer >>= 8;
+            m_count -= 8;
+        }
+    }
+
+    void flush()
+    {
+        if (m_count > 0) {
+            m_output.push_back(static_cast<unsigned char>(m_buffer));
+        }
+
+        m_buffer = 0;
+        m_count = 0;
+    }
+
+private:
+    vector<unsigned char>& m_output;
+    uint64_t m_buffer = 0;
+    int m_count = 0;
+};
+
+///
+/// \brief Huffman code stored bit reversed, so it can be written least significant bit first.
+///
+struct HuffmanCode {
+    uint16_t code = 0;
+    uint8_t length = 0;
+};
+
+///
+/// \brief Lookup tables for the fixed huffman codes of deflate.
+///
+struct DeflateTables {
+    static constexpr int MaxDistance = 32768;
+
+    array<HuffmanCode, 288> literalCodes;
+    array<uint8_t, 259> lengthSymbols;
+    array<uint8_t, MaxDistance + 1> distanceSymbols;
+
+    static constexpr uint16_t lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static constexpr uint8_t lengthExtraBits[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static constexpr uint16_t distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static constexpr uint8_t distanceExtraBits[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    DeflateTables()
+    {
+        const auto reverseBits = [](uint32_t code, int length) {
+            uint32_t reversed = 0;
+            for (auto i = 0; i < length; i++) {
+                reversed = (reversed << 1) | ((code >> i) & 1);
+            }
+            return static_cast<uint16_t>(reversed);
+        };
+
+        for (uint32_t symbol = 0; symbol < literalCodes.size(); symbol++) {
+            uint32_t code;
+            int length;
+
+            if (symbol < 144) {
+                code = 0x30 + symbol;
+                length = 8;
+            } else if (symbol < 256) {
+                code = 0x190 + symbol - 144;
+                length = 9;
+            } else if (symbol < 280) {
+                code = symbol - 256;
+                length = 7;
+            } else {
+                code = 0xc0 + symbol - 280;
+                length = 8;
+            }
+
+            literalCodes[symbol].code = reverseBits(code, length);
+            literalCodes[symbol].length = static_cast<uint8_t>(length);
+        }
+
+        for (uint8_t symbol = 0; symbol < 29; symbol++) {
+            const auto end = symbol < 28 ? lengthBase[symbol + 1] : 259;
+            for (auto length = lengthBase[symbol]; length < end; length++) {
+                lengthSymbols[length] = symbol;
+            }
+        }
+
+        for (uint8_t symbol = 0; symbol < 30; symbol++) {
+            const auto end = symbol < 29 ? distanceBase[symbol + 1] : MaxDistance + 1;
+            for (auto distance = distanceBase[symbol]; distance < end; distance++) {
+                distanceSymbols[distance] = symbol;
+            }
+        }
+    }
+};
+
+const DeflateTables& deflateTables()
+{
+    static const DeflateTables tables;
+    return tables;
+}
+
+///
+/// \brief Compresses data to stored deflate blocks.
+///
+void deflateStore(const unsigned char* data, size_t size, vector<unsigned char>& output)
+{
+    constexpr size_t MaxBlockSize = 65535;
+
+    size_t offset = 0;
+
+    do {
+        const auto blockSize = min(MaxBlockSize, size - offset);
+        const auto isFinal = offset + blockSize == size;
+
+        output.push_back(isFinal ? 1 : 0);
+        output.push_back(static_cast<unsigned char>(blockSize));
+        output.push_back(static_cast<unsigned char>(blockSize >> 8));
+        output.push_back(static_cast<unsigned char>(~blockSize));
+        output.push_back(static_cast<unsigned char>(~blockSize >> 8));
+        output.insert(output.end(), data + offset, data + offset + blockSize);
+
+        offset += blockSize;
+    } while (offset < size);
+}
+
+///
+/// \brief Compresses data to a single deflate block with fixed huffman codes.
+///
+/// Matches are found with a single probe into a hash table of the last position of every
+/// three byte sequence. This trades compression ratio for speed.
+///
+void deflateFast(const unsigned char* data, size_t size, vector<unsigned char>& output)
+{
+    constexpr int HashBits = 15;
+    constexpr size_t MinMatchLength = 3;
+    constexpr size_t MaxMatchLength = 258;
+
+    const auto& tables = deflateTables();
+
+    const auto hash = [data](size_t position) {
+        const uint32_t sequence = data[position] | (data[position + 1] << 8) | (data[position + 2] << 16);
+        return (sequence * 2654435761u) >> (32 - HashBits);
+    };
+
+    const auto writeLiteral = [&tables](BitWriter& writer, unsigned symbol) {
+        const auto& code = tables.literalCodes[symbol];
+        writer.write(code.code, code.length);
+    };
+
+    BitWriter writer(output);
+
+    // Final block with fixed huffman codes.
+    writer.write(1, 1);
+    writer.write(1, 2);
+
+    vector<int64_t> head(size_t(1) << HashBits, -1);
+
+    size_t position = 0;
+
+    while (position + MinMatchLength <= size) {
+        const auto hashValue = hash(position);
+        const auto candidate = head[hashValue];
+        head[hashValue] = static_cast<int64_t>(position);
+
+        size_t matchLength = 0;
+
+        if (candidate >= 0 && position - static_cast<size_t>(candidate) <= DeflateTables::MaxDistance) {
+            const auto maxLength = min(MaxMatchLength, size - position);
+            const auto match = data + candidate;
+            const auto current = data + position;
+
+            while (matchLength < maxLength && match[matchLength] == current[matchLength]) {
+                matchLength++;
+            }
+        }
+
+        if (matchLength < MinMatchLength) {
+            writeLiteral(writer, data[position]);
+            position++;
+            continue;
+        }
+
+        const auto distance = position - static_cast<size_t>(candidate);
+
+        const auto lengthSymbol = tables.lengthSymbols[matchLength];
+        writeLiteral(writer, 257 + lengthSymbol);
+        writer.write(static_cast<uint32_t>(matchLength - DeflateTables::lengthBase[lengthSymbol]), DeflateTables::lengthExtraBits[lengthSymbol]);
+
+        // Distance codes are fixed 5 bit codes.
+        const auto distanceSymbol = tables.distanceSymbols[distance];
+        uint32_t distanceCode = 0;
+        for (auto i = 0; i < 5; i++) {
+            distanceCode = (distanceCode << 1) | ((distanceSymbol >> i) & 1);
+        }
+        writer.write(distanceCode, 5);
+        writer.write(static_cast<uint32_t>(distance - DeflateTables::distanceBase[distanceSymbol]), DeflateTables::distanceExtraBits[distanceSymbol]);
+
+        // Insert the skipped positions, so later matches can reference them.
+        const auto end = position + matchLength;
+        for (position++; position < end; position++) {
+            if (position + MinMatchLength <= size) {
+                head[hash(position)] = static_cast<int64_t>(position);
+            }
+        }
+    }
+
+    for (; position < size; position++) {
+        writeLiteral(writer, data[position]);
+    }
+
+    // End of block.
+    writeLiteral(writer, 256);
+    writer.flush();
+}
+
+void appendUInt16LittleEndian(vector<unsigned char>& output, uint32_t value)
+{
+    output.push_back(static_cast<unsigned char>(value));
+    output.push_back(static_cast<unsigned char>(value >> 8));
+}
+
+void appendUInt32LittleEndian(vector<unsigned char>& output, uint32_t value)
+{
+    appendUInt16LittleEndian(output, value);
+    appendUInt16LittleEndian(output, value >> 16);
+}
+
+void appendUInt32BigEndian(vector<unsigned char>& output, uint32_t value)
+{
+    output.push_back(static_cast<unsigned char>(value >> 24));
+    output.push_back(static_cast<unsigned char>(value >> 16));
+    output.push_back(static_cast<unsigned char>(value >> 8));
+    output.push_back(static_cast<unsigned char>(value));
+}
+
+void appendPngChunk(vector<unsigned char>& output, const char* type, const vector<unsigned char>& data)
+{
+    appendUInt32BigEndian(output, static_cast<uint32_t>(data.size()));
+
+    const auto typeOffset = output.size();
+    output.insert(output.end(), type, type + 4);
+    output.insert(output.end(), data.begin(), data.end());
+
+    appendUInt32BigEndian(output, crc32(output.data() + typeOffset, output.size() - typeOffset));
+}
+
+bool isValid(const ImageView& image)
+{
+    return image.pixels && image.width > 0 && image.height > 0 && (image.channels == 3 || image.channels == 4);
+}
+
+const unsigned char* getRow(const ImageView& image, int y, bool flipImage)
+{
+    const auto stride = image.stride ? image.stride : image.width * image.channels;
+    const auto row = flipImage ? image.height - 1 - y : y;
+
+    return image.pixels + static_cast<size_t>(row) * static_cast<size_t>(stride);
+}
+
+bool writeFile(const string& filePath, const vector<unsigned char>& data)
+{
+    ofstream file(filesystem::u8path(filePath), ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<streamsize>(data.size()));
+    return file.good();
+}
+
+///
+/// \brief Size of the dds header including the magic number in 32 bit words.
+///
+constexpr size_t DdsHeaderSize = 32;
+
+array<uint32_t, DdsHeaderSize> createDdsHeader(int width, int height, int mipLevelCount)
+{
+    // Flags and capabilities of the dds file format.
+    constexpr uint32_t DDSD_CAPS = 0x1;
+    constexpr uint32_t DDSD_HEIGHT = 0x2;
+    constexpr uint32_t DDSD_WIDTH = 0x4;
+    constexpr uint32_t DDSD_PIXELFORMAT = 0x1000;
+    constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+    constexpr uint32_t DDSCAPS_COMPLEX = 0x8;
+    constexpr uint32_t DDSCAPS_TEXTURE = 0x1000;
+    constexpr uint32_t DDSCAPS_MIPMAP = 0x400000;
+
+    array<uint32_t, DdsHeaderSize> header = {};
+
+    header[0] = 0x20534444; // "DDS "
+    header[1] = 124;
+    header[2] = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT;
+    header[3] = static_cast<uint32_t>(height);
+    header[4] = static_cast<uint32_t>(width);
+    header[7] = static_cast<uint32_t>(mipLevelCount);
+    header[19] = 32;
+    header[27] = DDSCAPS_TEXTURE;
+
+    if (mipLevelCount > 1) {
+        header[2] |= DDSD_MIPMAPCOUNT;
+        header[27] |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+    }
+
+    return header;
+}
+
+void appendDdsHeader(vector<unsigned char>& output, const array<uint32_t, DdsHeaderSize>& header)
+{
+    for (auto value : header) {
+        appendUInt32LittleEndian(output, value);
+    }
+}
+
+int getBlockSize(BlockFormat format)
+{
+    return format == BlockFormat::BC1 ? 8 : 16;
+}
+
+///
+/// \brief Reverses the first rows of a block stored as bit fields of equal size.
+///
+void reverseBlockRows(unsigned char* data, int byteCount, int bitsPerRow, int rowCount)
+{
+    uint64_t bits = 0;
+    for (auto i = 0; i < byteCount; i++) {
+        bits |= static_cast<uint64_t>(data[i]) << (i * 8);
+    }
+
+    const auto rowMask = (uint64_t(1) << bitsPerRow) - 1;
+
+    auto flipped = bits;
+    for (auto row = 0; row < rowCount; row++) {
+        const auto targetRow = rowCount - 1 - row;
+        flipped &= ~(rowMask << (targetRow * bitsPerRow));
+        flipped |= ((bits >> (row * bitsPerRow)) & rowMask) << (targetRow * bitsPerRow);
+    }
+
+    for (auto i = 0; i < byteCount; i++) {
+        data[i] = static_cast<unsigned char>(flipped >> (i * 8));
+    }
+}
+
+///
+/// \brief Flips the rows of a block compressed block vertically.
+///
+void flipBlock(BlockFormat format, unsigned char* block, int rowCount)
+{
+    switch (format) {
+    case BlockFormat::BC1:
+        reverseBlockRows(block + 4, 4, 8, rowCount);
+        break;
+    case BlockFormat::BC2:
+        reverseBlockRows(block, 8, 16, rowCount);
+        reverseBlockRows(block + 12, 4, 8, rowCount);
+        break;
+    case BlockFormat::BC3:
+        reverseBlockRows(block + 2, 6, 12, rowCount);
+        reverseBlockRows(block + 12, 4, 8, rowCount);
+        break;
+    }
+}
+
+} // namespace
+
+vector<unsigned char> encodePng(const ImageView& image, bool flipImage, PngCompression compression)
+{
+    vector<unsigned char> png;
+
+    if (!isValid(image)) {
+        return png;
+    }
+
+    // Filter the scanlines - the up filter is cheap and works well for textures.
+    const auto rowSize = static_cast<size_t>(image.width) * static_cast<size_t>(image.channels);
+    vector<unsigned char> scanlines((rowSize + 1) * static_cast<size_t>(image.height));
+
+    for (auto y = 0; y < image.height; y++) {
+        const auto row = getRow(image, y, flipImage);
+        const auto scanline = scanlines.data() + static_cast<size_t>(y) * (rowSize + 1);
+
+        if (compression == PngCompression::Store || y == 0) {
+            scanline[0] = 0;
+            memcpy(scanline + 1, row, rowSize);
+        } else {
+            const auto previousRow = getRow(image, y - 1, flipImage);
+            scanline[0] = 2;
+            for (size_t x = 0; x < rowSize; x++) {
+                scanline[x + 1] = static_cast<unsigned char>(row[x] - previousRow[x]);
+            }
+        }
+    }
+
+    // Zlib stream with the fastest compression level flag.
+    vector<unsigned char> imageData = { 0x78, 0x01 };
+    imageData.reserve(compression == PngCompression::Store ? scanlines.size() + scanlines.size() / 65535 * 5 + 16 : scanlines.size() / 2);
+
+    if (compression == PngCompression::Store) {
+        deflateStore(scanlines.data(), scanlines.size(), imageData);
+    } else {
+        deflateFast(scanlines.data(), scanlines.size(), imageData);
+    }
+
+    appendUInt32BigEndian(imageData, adler32(scanlines.data(), scanlines.size()));
+
+    vector<unsigned char> header;
+    appendUInt32BigEndian(header, static_cast<uint32_t>(image.width));
+    appendUInt32BigEndian(header, static_cast<uint32_t>(image.height));
+    header.push_back(8);
+    header.push_back(image.channels == 4 ? 6 : 2);
+    header.push_back(0);
+    header.push_back(0);
+    header.push_back(0);
+
+    png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    png.reserve(imageData.size() + 64);
+
+    appendPngChunk(png, "IHDR", header);
+    appendPngChunk(png, "IDAT", imageData);
+    appendPngChunk(png, "IEND", {});
+
+    return png;
+}
+
+bool writePng(const string& filePath, const ImageView& image, bool flipImage, PngCompression compression)
+{
+    if (!isValid(image)) {
+        return false;
+    }
+
+    return writeFile(filePath, encodePng(image, flipImage, compression));
+}
+
+bool writeTga(const string& filePath, const ImageView& image, bool flipImage)
+{
+    if (!isValid(image) || image.width > 0xffff || image.height > 0xffff) {
+        return false;
+    }
+
+    vector<unsigned char> tga;
+    tga.reserve(18 + static_cast<size_t>(image.width) * static_cast<size_t>(image.height) * static_cast<size_t>(image.channels));
+
+    // Uncompressed true color image. The origin is top left unless the image is flipped.
+    tga.insert(tga.end(), { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0 });
+    appendUInt16LittleEndian(tga, static_cast<uint32_t>(image.width));
+    appendUInt16LittleEndian(tga, static_cast<uint32_t>(image.height));
+    tga.push_back(static_cast<unsigned char>(image.channels * 8));
+    tga.push_back(static_cast<unsigned char>((image.channels == 4 ? 8 : 0) | (flipImage ? 0 : 0x20)));
+
+    for (auto y = 0; y < image.height; y++) {
+        const auto row = getRow(image, y, false);
+
+        for (auto x = 0; x < image.width; x++) {
+            const auto pixel = row + x * image.channels;
+            tga.push_back(pixel[2]);
+            tga.push_back(pixel[1]);
+            tga.push_back(pixel[0]);
+
+            if (image.channels == 4) {
+                tga.push_back(pixel[3]);
+            }
+        }
+    }
+
+    return writeFile(filePath, tga);
+}
+
+bool writeDds(const string& filePath, const ImageView& image, bool flipImage)
+{
+    return writeDds(filePath, vector<ImageView> { image }, flipImage);
+}
+
+bool writeDds(const string& filePath, const vector<ImageView>& mipLevels, bool flipImage)
+{
+    constexpr uint32_t DDSD_PITCH = 0x8;
+    constexpr uint32_t DDPF_ALPHAPIXELS = 0x1;
+    constexpr uint32_t DDPF_RGB = 0x40;
+
+    if (mipLevels.empty()) {
+        return false;
+    }
+
+    const auto& image = mipLevels.front();
+    size_t dataSize = 0;
+
+    for (size_t mipIndex = 0; mipIndex < mipLevels.size(); mipIndex++) {
+        const auto& mipLevel = mipLevels[mipIndex];
+        if (!isValid(mipLevel)
+            || mipLevel.channels != image.channels
+            || mipLevel.width != max(1, image.width >> mipIndex)
+            || mipLevel.height != max(1, image.height >> mipIndex)) {
+            return false;
+        }
+
+        dataSize += static_cast<size_t>(mipLevel.width) * static_cast<size_t>(mipLevel.channels) * static_cast<size_t>(mipLevel.height);
+    }
+
+    const auto rowSize = static_cast<size_t>(image.width) * static_cast<size_t>(image.channels);
+
+    auto header = createDdsHeader(image.width, image.height, static_cast<int>(mipLevels.size()));
+    header[2] |= DDSD_PITCH;
+    header[5] = static_cast<uint32_t>(rowSize);
+    header[20] = DDPF_RGB | (image.channels == 4 ? DDPF_ALPHAPIXELS : 0);
+    header[22] = static_cast<uint32_t>(image.channels * 8);
+    header[23] = 0x000000ff;
+    header[24] = 0x0000ff00;
+    header[25] = 0x00ff0000;
+    header[26] = image.channels == 4 ? 0xff000000 : 0;
+
+    vector<unsigned char> dds;
+    dds.reserve(DdsHeaderSize * 4 + dataSize);
+    appendDdsHeader(dds, header);
+
+    for (const auto& mipLevel : mipLevels) {
+        const auto mipRowSize = static_cast<size_t>(mipLevel.width) * static_cast<size_t>(mipLevel.channels);
+
+        for (auto y = 0; y < mipLevel.height; y++) {
+            const auto row = getRow(mipLevel, y, flipImage);
+            dds.insert(dds.end(), row, row + mipRowSize);
+        }
+    }
+
+    return writeFile(filePath, dds);
+}
+
+bool writeDds(const string& filePath, const BlockImageView& image, bool flipImage)
+{
+    constexpr uint32_t DDSD_LINEARSIZE = 0x80000;
+    constexpr uint32_t DDPF_FOURCC = 0x4;
+
+    if (image.width <= 0 || image.height <= 0 || image.mipLevels.empty() || (flipImage && !canFlipBlocks(image))) {
+        return false;
+    }
+
+    const auto mipLevelCount = static_cast<int>(image.mipLevels.size());
+    const auto blockSize = getBlockSize(image.format);
+
+    auto header = createDdsHeader(image.width, image.height, mipLevelCount);
+    header[2] |= DDSD_LINEARSIZE;
+    header[5] = static_cast<uint32_t>(getBlockImageSize(image.format, image.width, image.height));
+    header[20] = DDPF_FOURCC;
+
+    switch (image.format) {
+    case BlockFormat::BC1:
+        header[21] = 0x31545844; // "DXT1"
+        break;
+    case BlockFormat::BC2:
+        header[21] = 0x33545844; // "DXT3"
+        break;
+    case BlockFormat::BC3:
+        header[21] = 0x35545844; // "DXT5"
+        break;
+    }
+
+    vector<unsigned char> dds;
+    appendDdsHeader(dds, header);
+
+    for (auto mipIndex = 0; mipIndex < mipLevelCount; mipIndex++) {
+        const auto width = max(1, image.width >> mipIndex);
+        const auto height = max(1, image.height >> mipIndex);
+        const auto blocks = image.mipLevels[static_cast<size_t>(mipIndex)];
+
+        if (!flipImage) {
+            dds.insert(dds.end(), blocks, blocks + getBlockImageSize(image.format, width, height));
+            continue;
+        }
+
+        // Reverse the order of the block rows and the rows inside of each block.
+        const auto rowSize = static_cast<size_t>((width + 3) / 4) * static_cast<size_t>(blockSize);
+        const auto blockRowCount = (height + 3) / 4;
+        const auto rowCount = min(4, height);
+
+        for (auto blockRow = blockRowCount - 1; blockRow >= 0; blockRow--) {
+            const auto offset = dds.size();
+            const auto row = blocks + static_cast<size_t>(blockRow) * rowSize;
+            dds.insert(dds.end(), row, row + rowSize);
+
+            for (size_t blockOffset = 0; blockOffset < rowSize; blockOffset += static_cast<size_t>(blockSize)) {
+                flipBlock(image.format, dds.data() + offset + blockOffset, rowCount);
+            }
+        }
+    }
+
+    return writeFile(filePath, dds);
+}
+
+bool canFlipBlocks(const BlockImageView& image)
+{
+    for (size_t mipIndex = 0; mipIndex < image.mipLevels.size(); mipIndex++) {
+        const auto height = max(1, image.height >> mipIndex);
+        if (height > 4 && height % 4 != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+size_t getBlockImageSize(BlockFormat format, int width, int height)
+{
+    return static_cast<size_t>((width + 3) / 4) * static_cast<size_t>((height + 3) / 4) * static_cast<size_t>(getBlockSize(format));
+}
+
+bool writeImage(const string& filePath, const ImageView& image, bool flipImage)
+{
+    auto extension = filesystem::u8path(filePath).extension().u8string();
+    toLower(extension);
+
+    if (extension == ".tga") {
+        return writeTga(filePath, image, flipImage);
+    }
+
+    if (extension == ".dds") {
+        return writeDds(filePath, image, flipImage);
+    }
+
+    return writePng(filePath, image, flipImage);
+}
+
+} // namespace GCL::Utilities
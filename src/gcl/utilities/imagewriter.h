@@ -0,0 +1,174 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief Non-owning view of 8 bit pixels with 3 (RGB) or 4 (RGBA) channels.
+///
+struct ImageView {
+    ///
+    /// \brief Pixels of the image stored row by row from top to bottom.
+    ///
+    const unsigned char* pixels = nullptr;
+
+    ///
+    /// \brief Width of the image in pixels.
+    ///
+    int width = 0;
+
+    ///
+    /// \brief Height of the image in pixels.
+    ///
+    int height = 0;
+
+    ///
+    /// \brief Number of channels per pixel - 3 for RGB or 4 for RGBA.
+    ///
+    int channels = 4;
+
+    ///
+    /// \brief Bytes per row. Uses width * channels if zero.
+    ///
+    int stride = 0;
+};
+
+///
+/// \brief Block compression formats which can be written as dds file without re-encoding.
+///
+enum class BlockFormat {
+    BC1,
+    BC2,
+    BC3
+};
+
+///
+/// \brief Non-owning view of block compressed mip levels.
+///
+struct BlockImageView {
+    ///
+    /// \brief Block compression format of all mip levels.
+    ///
+    BlockFormat format = BlockFormat::BC1;
+
+    ///
+    /// \brief Width of the largest mip level in pixels.
+    ///
+    int width = 0;
+
+    ///
+    /// \brief Height of the largest mip level in pixels.
+    ///
+    int height = 0;
+
+    ///
+    /// \brief Blocks of each mip level beginning with the largest one.
+    ///
+    vector<const unsigned char*> mipLevels;
+};
+
+///
+/// \brief Deflate settings of the png encoder.
+///
+enum class PngCompression {
+    ///
+    /// \brief Stores the pixels without compression.
+    ///
+    Store,
+
+    ///
+    /// \brief Compresses with single probe matching and fixed huffman codes.
+    ///
+    Fast
+};
+
+///
+/// \brief Encodes an image to a png file in memory.
+/// \param image Image to encode.
+/// \param flipImage If image should be flipped vertically.
+/// \param compression Deflate setting of the encoder.
+/// \return Encoded png file.
+///
+vector<unsigned char> encodePng(const ImageView& image, bool flipImage = false, PngCompression compression = PngCompression::Fast);
+
+///
+/// \brief Writes an image to a png file.
+/// \param filePath File path of the png file.
+/// \param image Image to write.
+/// \param flipImage If image should be flipped vertically.
+/// \param compression Deflate setting of the encoder.
+/// \return Returns whether the file was written.
+///
+bool writePng(const string& filePath, const ImageView& image, bool flipImage = false, PngCompression compression = PngCompression::Fast);
+
+///
+/// \brief Writes an image to an uncompressed tga file.
+/// \param filePath File path of the tga file.
+/// \param image Image to write.
+/// \param flipImage If image should be flipped vertically.
+/// \return Returns whether the file was written.
+///
+bool writeTga(const string& filePath, const ImageView& image, bool flipImage = false);
+
+///
+/// \brief Writes an image to an uncompressed dds file.
+/// \param filePath File path of the dds file.
+/// \param image Image to write.
+/// \param flipImage If image should be flipped vertically.
+/// \return Returns whether the file was written.
+///
+bool writeDds(const string& filePath, const ImageView& image, bool flipImage = false);
+
+///
+/// \brief Writes uncompressed mip levels to a dds file.
+/// \param filePath File path of the dds file.
+/// \param mipLevels Mip levels beginning with the largest one. Each level is half as large as the
+/// previous one but at least one pixel, and all levels have the same number of channels.
+/// \param flipImage If image should be flipped vertically.
+/// \return Returns whether the file was written.
+///
+bool writeDds(const string& filePath, const vector<ImageView>& mipLevels, bool flipImage = false);
+
+///
+/// \brief Writes block compressed mip levels to a dds file without re-encoding them.
+///
+/// Flipping reorders the blocks and their rows, so it is only possible if the height of
+/// every mip level is either a multiple of 4 or smaller than 4.
+///
+/// \param filePath File path of the dds file.
+/// \param image Block compressed mip levels to write.
+/// \param flipImage If image should be flipped vertically.
+/// \return Returns whether the file was written.
+///
+bool writeDds(const string& filePath, const BlockImageView& image, bool flipImage = false);
+
+///
+/// \brief Returns whether block compressed mip levels can be flipped without re-encoding.
+/// \param image Block compressed mip levels.
+/// \return Returns whether the height of every mip level is a multiple of 4 or smaller than 4.
+///
+bool canFlipBlocks(const BlockImageView& image);
+
+///
+/// \brief Returns the size of a block compressed mip level in bytes.
+/// \param format Block compression format.
+/// \param width Width of the mip level in pixels.
+/// \param height Height of the mip level in pixels.
+/// \return Size of all blocks of the mip level.
+///
+size_t getBlockImageSize(BlockFormat format, int width, int height);
+
+///
+/// \brief Writes an image to a file using the format of the file extension (png, tga or dds).
+/// \param filePath File path of the image file.
+/// \param image Image to write.
+/// \param flipImage If image should be flipped vertically.
+/// \return Returns whether the file was written.
+///
+bool writeImage(const string& filePath, const ImageView& image, bool flipImage = false);
+
+} // namespace GCL::Utilities
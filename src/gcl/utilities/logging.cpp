@@ -2,44 +2,392 @@
 
 #include "gcl/utilities/datetime.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
-#include <filesystem>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <mutex>
+#include <string>
+#include <thread>
 
 namespace GCL::Utilities::Logging {
 
 using namespace std;
-using namespace std::filesystem;
+using namespace std::chrono;
 
 using namespace GCL::Utilities::Datetime;
 
+namespace {
+
+constexpr size_t MessageSize = 1024;
+constexpr size_t TagSize = 32;
+
+///
+/// \brief Number of records in the ring buffer - must be a power of two.
+///
+constexpr size_t QueueCapacity = 1024;
+
+///
+/// \brief Interval in which the background thread writes queued records.
+///
+constexpr auto FlushInterval = milliseconds(20);
+
+///
+/// \brief Log message with its context captured at the time of logging.
+///
+struct LogRecord {
+    const char* level = nullptr;
+    const char* file = nullptr;
+    int line = 0;
+    const char* function = nullptr;
+    system_clock::time_point time;
+    char tag[TagSize] = {};
+    char message[MessageSize] = {};
+};
+
+///
+/// \brief Tag of the current thread. Threads without tag are numbered on first use.
+///
+thread_local char threadTag[TagSize] = {};
+
+const char* getFileName(const char* file)
+{
+    const auto slash = strrchr(file, '/');
+    const auto backslash = strrchr(file, '\\');
+    const auto separator = slash > backslash ? slash : backslash;
+
+    return separator ? separator + 1 : file;
+}
+
+///
+/// \brief Multi producer, single consumer logger on a bounded lock-free ring buffer.
+///
+/// Producers claim a slot with a single compare and swap, format the message directly into
+/// it and publish it with its sequence number. A background thread writes the published
+/// records in batches. Producers only wait if the ring buffer is full.
+///
+class Logger {
+public:
+    Logger()
+        : m_logFile(DEFAULT_LOG_FILE)
+    {
+        for (size_t i = 0; i < QueueCapacity; i++) {
+            m_slots[i].sequence.store(i, memory_order_relaxed);
+        }
+
+        m_flusher = thread(&Logger::run, this);
+    }
+
+    ~Logger()
+    {
+        stop();
+    }
+
+    static Logger& instance()
+    {
+        static Logger logger;
+        return logger;
+    }
+
+    ///
+    /// \brief Returns whether the background thread was stopped - records are written directly then.
+    ///
+    static bool isStopped()
+    {
+        return s_isStopped;
+    }
+
+    ///
+    /// \brief Starts the background thread if it is not running.
+    ///
+    void start()
+    {
+        if (m_flusher.joinable()) {
+            return;
+        }
+
+        {
+            lock_guard<mutex> lockGuard(m_mutex);
+            m_stop = false;
+        }
+
+        m_flusher = thread(&Logger::run, this);
+        s_isStopped = false;
+    }
+
+    ///
+    /// \brief Writes all queued records and stops the background thread.
+    ///
+    void stop()
+    {
+        {
+            lock_guard<mutex> lockGuard(m_mutex);
+            m_stop = true;
+        }
+
+        m_wakeUp.notify_one();
+
+        if (m_flusher.joinable()) {
+            m_flusher.join();
+        }
+
+        s_isStopped = true;
+
+        // Write records which were queued while the background thread finished.
+        writeRecords();
+    }
+
+    template <typename FormatMessage>
+    void push(const char* level, const char* file, int line, const char* function, FormatMessage formatMessage)
+    {
+        auto position = m_enqueuePosition.load(memory_order_relaxed);
+        Slot* slot;
+
+        for (;;) {
+            slot = &m_slots[position & (QueueCapacity - 1)];
+            const auto sequence = slot->sequence.load(memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0) {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                // The ring buffer is full - let the background thread catch up.
+                m_wakeUp.notify_one();
+                this_thread::yield();
+                position = m_enqueuePosition.load(memory_order_relaxed);
+            } else {
+                position = m_enqueuePosition.load(memory_order_relaxed);
+            }
+        }
+
+        auto& record = slot->record;
+        record.level = level;
+        record.file = file;
+        record.line = line;
+        record.function = function;
+        record.time = system_clock::now();
+        memcpy(record.tag, getThreadTag(), TagSize);
+        formatMessage(record.message);
+
+        slot->sequence.store(position + 1, memory_order_release);
+
+        // Wake the background thread early if the ring buffer fills up.
+        if ((position & (QueueCapacity / 2 - 1)) == 0) {
+            m_wakeUp.notify_one();
+        }
+    }
+
+    void flush()
+    {
+        const auto position = m_enqueuePosition.load(memory_order_acquire);
+
+        unique_lock<mutex> lock(m_mutex);
+        m_flushRequested = true;
+        m_wakeUp.notify_one();
+        m_flushed.wait(lock, [this, position]() { return m_dequeuePosition.load(memory_order_acquire) >= position || m_stop; });
+    }
+
+private:
+    struct Slot {
+        atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    void run()
+    {
+        for (;;) {
+            const auto isStopping = [this]() {
+                lock_guard<mutex> lockGuard(m_mutex);
+                return m_stop;
+            }();
+
+            const auto recordCount = writeRecords();
+
+            if (recordCount) {
+                // Notify under the mutex, flush() checks the dequeue position while holding it.
+                lock_guard<mutex> lockGuard(m_mutex);
+                m_flushed.notify_all();
+                continue;
+            }
+
+            if (isStopping) {
+                return;
+            }
+
+            unique_lock<mutex> lock(m_mutex);
+            m_wakeUp.wait_for(lock, FlushInterval, [this]() { return m_stop || m_flushRequested || hasRecord(); });
+            m_flushRequested = false;
+        }
+    }
+
+    ///
+    /// \brief Writes a record to stdout and the log file.
+    ///
+    void writeRecord(const LogRecord& record)
+    {
+        // Formatting the local time is expensive, so it is done once per second.
+        const auto second = time_point_cast<seconds>(record.time);
+        if (second != m_formattedSecond) {
+            m_formattedSecond = second;
+            m_formattedTime = Datetime::time(record.time);
+        }
+
+        const auto millisecond = duration_cast<milliseconds>(record.time - second).count();
+
+        char line[MessageSize + 256];
+        const auto length = snprintf(
+            line,
+            sizeof(line),
+            "%s.%03d %s [%s] %s:%d %s %s\n",
+            m_formattedTime.c_str(),
+            static_cast<int>(millisecond),
+            record.level,
+            record.tag,
+            getFileName(record.file),
+            record.line,
+            record.function,
+            record.message);
+
+        fwrite(line, 1, min(static_cast<size_t>(max(length, 0)), sizeof(line) - 1), stdout);
+
+        if (m_logFile) {
+            m_logFile << record.message << '\n';
+        }
+    }
+
+    bool hasRecord()
+    {
+        const auto position = m_dequeuePosition.load(memory_order_relaxed);
+        const auto& slot = m_slots[position & (QueueCapacity - 1)];
+
+        return slot.sequence.load(memory_order_acquire) == position + 1;
+    }
+
+    ///
+    /// \brief Writes all published records and returns their number.
+    ///
+    size_t writeRecords()
+    {
+        size_t recordCount = 0;
+        auto position = m_dequeuePosition.load(memory_order_relaxed);
+
+        for (;;) {
+            auto& slot = m_slots[position & (QueueCapacity - 1)];
+            if (slot.sequence.load(memory_order_acquire) != position + 1) {
+                break;
+            }
+
+            writeRecord(slot.record);
+
+            slot.sequence.store(position + QueueCapacity, memory_order_release);
+            position++;
+            recordCount++;
+
+            m_dequeuePosition.store(position, memory_order_release);
+        }
+
+        if (recordCount) {
+            fflush(stdout);
+            m_logFile.flush();
+        }
+
+        return recordCount;
+    }
+
+private:
+    array<Slot, QueueCapacity> m_slots;
+    atomic<size_t> m_enqueuePosition = 0;
+    atomic<size_t> m_dequeuePosition = 0;
+
+    ofstream m_logFile;
+    thread m_flusher;
+
+    time_point<system_clock, seconds> m_formattedSecond;
+    string m_formattedTime;
+
+    mutex m_mutex;
+    condition_variable m_wakeUp;
+    condition_variable m_flushed;
+    bool m_flushRequested = false;
+    bool m_stop = false;
+
+    static inline atomic<bool> s_isStopped = false;
+};
+
+///
+/// \brief Guards the start and stop of the background thread.
+///
+mutex lifecycleMutex;
+
+///
+/// \brief Number of registered users, e.g. library instances.
+///
+unsigned userCount = 0;
+
+} // namespace
+
 void log(const char* level, const char* file, int line, const char* function, const char* message)
 {
-    static mutex logMutex;
-    lock_guard<mutex> lockGuard(logMutex);
-
-    ofstream(stdout)
-        << nowTimeMs()
-        << " "
-        << level
-        << " "
-        << path(file).filename().string()
-        << ":"
-        << line
-        << " "
-        << function
-        << " "
-        << message
-        << endl;
-
-    static ofstream logFile(DEFAULT_LOG_FILE);
-
-    if (logFile) {
-        logFile
-            << message
-            << endl;
+    if (Logger::isStopped()) {
+        fprintf(stdout, "%s %s %s:%d %s %s\n", nowTimeMs().c_str(), level, getFileName(file), line, function, message);
+        return;
     }
+
+    Logger::instance().push(level, file, line, function, [message](char* recordMessage) {
+        strncpy(recordMessage, message, MessageSize - 1);
+        recordMessage[MessageSize - 1] = '\0';
+    });
+}
+
+void flush()
+{
+    if (!Logger::isStopped()) {
+        Logger::instance().flush();
+    }
+}
+
+void start()
+{
+    lock_guard<mutex> lockGuard(lifecycleMutex);
+
+    userCount++;
+    Logger::instance().start();
+}
+
+void shutdown()
+{
+    lock_guard<mutex> lockGuard(lifecycleMutex);
+
+    // Keep logging in the background as long as another user is registered.
+    if (userCount > 0 && --userCount > 0) {
+        return;
+    }
+
+    if (!Logger::isStopped()) {
+        Logger::instance().stop();
+    }
+}
+
+const char* getThreadTag()
+{
+    if (!threadTag[0]) {
+        static atomic<unsigned> threadCount = 0;
+        snprintf(threadTag, TagSize, "thread-%u", threadCount++);
+    }
+
+    return threadTag;
+}
+
+void setThreadTag(const char* tag)
+{
+    strncpy(threadTag, tag, TagSize - 1);
+    threadTag[TagSize - 1] = '\0';
 }
 
 #ifdef __clang__
@@ -47,17 +395,39 @@ void log(const char* level, const char* file, int line, const char* function, co
 #pragma clang diagnostic ignored "-Wformat-nonliteral"
 #endif
 
+namespace {
+
+void logFormat(const char* level, const char* file, int line, const char* function, const char* format, va_list args)
+{
+    if (Logger::isStopped()) {
+        char message[MessageSize];
+        vsnprintf(message, MessageSize, format, args);
+        log(level, file, line, function, message);
+        return;
+    }
+
+    // Format the message directly into the record of the ring buffer. The arguments are
+    // copied, a va_list must not be copied by value and is consumed by vsnprintf.
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+
+    Logger::instance().push(level, file, line, function, [format, &argsCopy](char* recordMessage) {
+        vsnprintf(recordMessage, MessageSize, format, argsCopy);
+    });
+
+    va_end(argsCopy);
+}
+
+} // namespace
+
 void _debug(const char* file, int line, const char* function, const char* format, ...)
 {
     va_list args;
     va_start(args, format);
 
-    char message[1024];
-    vsnprintf(message, 1024, format, args);
+    logFormat("Debug", file, line, function, format, args);
 
     va_end(args);
-
-    log("Debug", file, line, function, message);
 }
 
 void _info(const char* file, int line, const char* function, const char* format, ...)
@@ -65,12 +435,9 @@ void _info(const char* file, int line, const char* function, const char* format,
     va_list args;
     va_start(args, format);
 
-    char message[1024];
-    vsnprintf(message, 1024, format, args);
+    logFormat("Info", file, line, function, format, args);
 
     va_end(args);
-
-    log("Info", file, line, function, message);
 }
 
 void _warning(const char* file, int line, const char* function, const char* format, ...)
@@ -78,12 +445,9 @@ void _warning(const char* file, int line, const char* function, const char* form
     va_list args;
     va_start(args, format);
 
-    char message[1024];
-    vsnprintf(message, 1024, format, args);
+    logFormat("Warning", file, line, function, format, args);
 
     va_end(args);
-
-    log("Warning", file, line, function, message);
 }
 
 void _fatal(const char* file, int line, const char* function, const char* format, ...)
@@ -91,16 +455,16 @@ void _fatal(const char* file, int line, const char* function, const char* format
     va_list args;
     va_start(args, format);
 
-    char message[1024];
-    vsnprintf(message, 1024, format, args);
+    logFormat("Fatal", file, line, function, format, args);
 
     va_end(args);
 
-    log("Fatal", file, line, function, message);
+    // Fatal messages usually precede an abort - make sure they are written.
+    flush();
 }
 
 #ifdef __clang__
-#pragma diagnostic pop
+#pragma clang diagnostic pop
 #endif
 
 } // namespace GCL::Utilities::Logging
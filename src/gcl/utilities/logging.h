@@ -4,8 +4,30 @@ namespace GCL::Utilities::Logging {
 
 #define DEFAULT_LOG_FILE "grannyconverter.log"
 
+#define GCL_LOG_LEVEL_DEBUG 0
+#define GCL_LOG_LEVEL_INFO 1
+#define GCL_LOG_LEVEL_WARNING 2
+#define GCL_LOG_LEVEL_FATAL 3
+
+///
+/// \brief Lowest level of the messages which are compiled in.
+///
+/// Debug and info messages below this level are removed by the preprocessor,
+/// their arguments are not evaluated. Defaults to info for release builds.
+///
+#ifndef GCL_LOG_LEVEL
+#ifdef NDEBUG
+#define GCL_LOG_LEVEL GCL_LOG_LEVEL_INFO
+#else
+#define GCL_LOG_LEVEL GCL_LOG_LEVEL_DEBUG
+#endif
+#endif
+
 ///
 /// \brief Logs a message to stdout and a log file.
+///
+/// The message is queued to a lock-free ring buffer and written by a background thread.
+///
 /// \param level
 /// \param file
 /// \param line
@@ -14,6 +36,38 @@ namespace GCL::Utilities::Logging {
 ///
 void log(const char* level, const char* file, int line, const char* function, const char* message);
 
+///
+/// \brief Waits until all queued messages are written.
+///
+void flush();
+
+///
+/// \brief Starts the background thread again if it was stopped and registers a user of the logger.
+///
+/// Each call has to be paired with a call of shutdown, e.g. by each library instance.
+///
+void start();
+
+///
+/// \brief Unregisters a user of the logger. The last user writes all queued messages and stops the background thread.
+///
+/// Messages logged while it is stopped are written directly to stdout. Call this before the
+/// library is unloaded, threads must not be joined during static destruction of a dll.
+///
+void shutdown();
+
+///
+/// \brief Sets the tag which is logged for all messages of the calling thread.
+/// \param tag Tag of the thread, e.g. "main" or "texture-0".
+///
+void setThreadTag(const char* tag);
+
+///
+/// \brief Returns the tag of the calling thread.
+/// \return Tag set by setThreadTag or a numbered tag like "thread-0".
+///
+const char* getThreadTag();
+
 ///
 /// \brief Logs a format message.
 /// \param file
@@ -42,7 +96,7 @@ void _info(const char* file, int line, const char* function, const char* format,
 void _warning(const char* file, int line, const char* function, const char* format, ...);
 
 ///
-/// \brief Logs a format message.
+/// \brief Logs a format message and waits until it is written.
 /// \param file
 /// \param line
 /// \param function
@@ -53,12 +107,20 @@ void _fatal(const char* file, int line, const char* function, const char* format
 ///
 /// \brief Logs a format message.
 ///
+#if GCL_LOG_LEVEL <= GCL_LOG_LEVEL_DEBUG
 #define debug(...) _debug(__FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+#else
+#define debug(...) ((void)0)
+#endif
 
 ///
 /// \brief Logs a format message.
 ///
+#if GCL_LOG_LEVEL <= GCL_LOG_LEVEL_INFO
 #define info(...) _info(__FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+#else
+#define info(...) ((void)0)
+#endif
 
 ///
 /// \brief Logs a format message.
@@ -0,0 +1,35 @@
+#include "gcl/utilities/materialtable.h"
+
+#include <algorithm>
+
+namespace GCL::Utilities::MaterialTable {
+
+vector<int> build(
+    const GrannyTriMaterialGroup* groups,
+    size_t groupCount,
+    const int* bindingSlots,
+    size_t bindingCount,
+    size_t triangleCount)
+{
+    vector<int> slots(triangleCount, -1);
+
+    // Fill the groups backwards, so the first group covering a triangle is written last.
+    for (size_t groupIndex = groupCount; groupIndex-- > 0;) {
+        const auto& group = groups[groupIndex];
+        if (group.TriCount <= 0 || group.TriFirst < 0 || static_cast<size_t>(group.TriFirst) >= triangleCount) {
+            continue;
+        }
+
+        const auto first = static_cast<size_t>(group.TriFirst);
+        const auto last = min(triangleCount, first + static_cast<size_t>(group.TriCount));
+        const auto slot = group.MaterialIndex >= 0 && static_cast<size_t>(group.MaterialIndex) < bindingCount
+            ? bindingSlots[group.MaterialIndex]
+            : -1;
+
+        fill(slots.begin() + first, slots.begin() + last, slot);
+    }
+
+    return slots;
+}
+
+} // namespace GCL::Utilities::MaterialTable
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace GCL::Utilities::MaterialTable {
+
+using namespace std;
+
+///
+/// \brief Builds the material slot of each triangle of a mesh from its material groups.
+///
+/// If material groups overlap, the first group covering a triangle wins. Triangles without
+/// a group and groups referencing a material binding out of range get slot -1.
+///
+/// \param groups Material groups of the mesh.
+/// \param groupCount Number of material groups.
+/// \param bindingSlots Material slot of each material binding of the mesh.
+/// \param bindingCount Number of material bindings.
+/// \param triangleCount Number of triangles of the mesh.
+/// \return Material slot of each triangle.
+///
+vector<int> build(
+    const GrannyTriMaterialGroup* groups,
+    size_t groupCount,
+    const int* bindingSlots,
+    size_t bindingCount,
+    size_t triangleCount);
+
+} // namespace GCL::Utilities::MaterialTable
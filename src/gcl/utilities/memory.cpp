@@ -0,0 +1,240 @@
+#include "gcl/utilities/memory.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace GCL::Utilities::Memory {
+
+namespace {
+
+atomic<size_t> currentBytes = 0;
+atomic<size_t> peakBytes = 0;
+
+} // namespace
+
+#ifdef GCL_TRACK_MEMORY
+
+namespace {
+
+///
+/// \brief Size of the header in front of each allocation storing its size.
+///
+/// Matches the alignment guaranteed by malloc, so the returned memory keeps it.
+///
+constexpr size_t HeaderSize = alignof(max_align_t);
+
+void addBytes(size_t size)
+{
+    const auto current = currentBytes.fetch_add(size, memory_order_relaxed) + size;
+
+    auto peak = peakBytes.load(memory_order_relaxed);
+    while (current > peak && !peakBytes.compare_exchange_weak(peak, current, memory_order_relaxed)) {
+    }
+}
+
+void removeBytes(size_t size)
+{
+    currentBytes.fetch_sub(size, memory_order_relaxed);
+}
+
+void* allocate(size_t size, size_t alignment)
+{
+    // The header is as large as the alignment, so the size is stored right before the returned memory.
+    const auto headerSize = alignment > HeaderSize ? alignment : HeaderSize;
+
+#ifdef _WIN32
+    auto memory = static_cast<unsigned char*>(_aligned_malloc(size + headerSize, headerSize));
+#else
+    auto memory = static_cast<unsigned char*>(aligned_alloc(headerSize, (size + headerSize + headerSize - 1) / headerSize * headerSize));
+#endif
+
+    if (!memory) {
+        return nullptr;
+    }
+
+    *reinterpret_cast<size_t*>(memory + headerSize - sizeof(size_t)) = size;
+    addBytes(size);
+
+    return memory + headerSize;
+}
+
+void deallocate(void* pointer, size_t alignment)
+{
+    if (!pointer) {
+        return;
+    }
+
+    const auto headerSize = alignment > HeaderSize ? alignment : HeaderSize;
+    const auto memory = static_cast<unsigned char*>(pointer) - headerSize;
+
+    removeBytes(*reinterpret_cast<size_t*>(memory + headerSize - sizeof(size_t)));
+
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+void* allocateOrThrow(size_t size, size_t alignment)
+{
+    for (;;) {
+        if (const auto memory = allocate(size, alignment)) {
+            return memory;
+        }
+
+        const auto handler = get_new_handler();
+        if (!handler) {
+            throw bad_alloc();
+        }
+
+        handler();
+    }
+}
+
+} // namespace
+
+bool isTracking()
+{
+    return true;
+}
+
+#else
+
+bool isTracking()
+{
+    return false;
+}
+
+#endif
+
+size_t getCurrentBytes()
+{
+    return currentBytes.load(memory_order_relaxed);
+}
+
+size_t getPeakBytes()
+{
+    return peakBytes.load(memory_order_relaxed);
+}
+
+void resetPeakBytes()
+{
+    peakBytes.store(currentBytes.load(memory_order_relaxed), memory_order_relaxed);
+}
+
+} // namespace GCL::Utilities::Memory
+
+#ifdef GCL_TRACK_MEMORY
+
+// Replacements of all replaceable global allocation functions, so over-aligned types like
+// the vector math types are counted too and never freed by the default allocator. The
+// object file is linked whenever the counters are queried, e.g. by the importer or
+// exporter statistics.
+
+using GCL::Utilities::Memory::allocate;
+using GCL::Utilities::Memory::allocateOrThrow;
+using GCL::Utilities::Memory::deallocate;
+
+void* operator new(std::size_t size)
+{
+    return allocateOrThrow(size, 0);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocateOrThrow(size, 0);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer, 0);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer, 0);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer, 0);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer, 0);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, 0);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, 0);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+#endif
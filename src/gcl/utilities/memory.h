@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+namespace GCL::Utilities::Memory {
+
+using namespace std;
+
+///
+/// \brief Returns whether heap allocations are counted.
+///
+/// Allocations are counted by replacing the global operator new and delete, which is
+/// only compiled in if the library is built with GCL_TRACK_MEMORY. Otherwise all
+/// counters stay zero.
+///
+bool isTracking();
+
+///
+/// \brief Returns the number of heap bytes currently allocated by the process.
+///
+size_t getCurrentBytes();
+
+///
+/// \brief Returns the maximum of heap bytes allocated at once since the start or the last reset.
+///
+size_t getPeakBytes();
+
+///
+/// \brief Resets the peak to the currently allocated bytes.
+///
+/// The counters are process wide - a reset affects all importers and exporters.
+///
+void resetPeakBytes();
+
+} // namespace GCL::Utilities::Memory
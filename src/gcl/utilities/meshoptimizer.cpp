@@ -0,0 +1,435 @@
+#include "gcl/utilities/meshoptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+namespace GCL::Utilities::MeshOptimizer {
+
+namespace {
+
+///
+/// \brief Marks a missing vertex or triangle index.
+///
+constexpr unsigned INVALID_INDEX = ~0u;
+
+///
+/// \brief Size of the LRU cache simulated by the vertex cache optimization.
+///
+constexpr int FORSYTH_CACHE_SIZE = 32;
+
+///
+/// \brief Hashes the integer coordinates of a grid cell.
+///
+uint64_t hashCell(int64_t x, int64_t y, int64_t z)
+{
+    auto hash = static_cast<uint64_t>(x) * 0x9e3779b97f4a7c15ull;
+    hash ^= static_cast<uint64_t>(y) * 0xc2b2ae3d27d4eb4full + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<uint64_t>(z) * 0x165667b19e3779f9ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+///
+/// \brief Returns whether all attributes of two vertices are equal within the tolerance.
+///
+bool isEqual(const float* a, const float* b, size_t stride, float tolerance)
+{
+    for (size_t i = 0; i < stride; i++) {
+        if (!(fabs(a[i] - b[i]) <= tolerance)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// \brief Returns the Forsyth score of a vertex.
+/// \param cachePosition Position in the simulated cache or -1 if it is not cached.
+/// \param remainingTriangles Number of triangles of the vertex which are not emitted yet.
+///
+float scoreVertex(int cachePosition, unsigned remainingTriangles)
+{
+    if (remainingTriangles == 0) {
+        return -1.0f;
+    }
+
+    auto score = 0.0f;
+
+    if (cachePosition >= 0) {
+        // The last triangle gets a fixed score, so it is not favoured over its neighbours.
+        if (cachePosition < 3) {
+            score = 0.75f;
+        } else {
+            const auto scaler = 1.0f / static_cast<float>(FORSYTH_CACHE_SIZE - 3);
+            score = powf(1.0f - static_cast<float>(cachePosition - 3) * scaler, 1.5f);
+        }
+    }
+
+    // Favour vertices with few remaining triangles to get rid of them early.
+    score += 2.0f / sqrtf(static_cast<float>(remainingTriangles));
+
+    return score;
+}
+
+} // namespace
+
+size_t weldVertices(
+    const float* attributes,
+    size_t vertexCount,
+    size_t stride,
+    float tolerance,
+    vector<unsigned>& remap,
+    const unsigned* positionRemap)
+{
+    remap.assign(vertexCount, INVALID_INDEX);
+
+    // Vertices sharing a position are known, only their unique vertices need to be compared.
+    if (positionRemap) {
+        vector<unsigned> uniqueVertices;
+        vector<unsigned> nextUnique;
+        vector<unsigned> positionHeads(vertexCount, INVALID_INDEX);
+
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            const auto vertexAttributes = attributes + vertex * stride;
+            auto& head = positionHeads[positionRemap[vertex]];
+            auto found = INVALID_INDEX;
+
+            for (auto unique = head; unique != INVALID_INDEX; unique = nextUnique[unique]) {
+                if (isEqual(attributes + uniqueVertices[unique] * stride, vertexAttributes, stride, tolerance)) {
+                    found = unique;
+                    break;
+                }
+            }
+
+            if (found == INVALID_INDEX) {
+                found = static_cast<unsigned>(uniqueVertices.size());
+                uniqueVertices.push_back(static_cast<unsigned>(vertex));
+                nextUnique.push_back(head);
+                head = found;
+            }
+
+            remap[vertex] = found;
+        }
+
+        return uniqueVertices.size();
+    }
+
+    // Cells at least as large as the tolerance, so welded vertices are in neighbouring cells.
+    const auto cellSize = static_cast<double>(max(tolerance, 1e-6f));
+
+    vector<unsigned> uniqueVertices;
+    vector<unsigned> nextInCell;
+    unordered_map<uint64_t, unsigned> cellHeads;
+    cellHeads.reserve(vertexCount);
+
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        const auto vertexAttributes = attributes + vertex * stride;
+
+        int64_t cell[3] = {};
+        auto isFinite = true;
+
+        for (auto axis = 0; axis < 3; axis++) {
+            const auto coordinate = static_cast<double>(vertexAttributes[axis]) / cellSize;
+            isFinite &= isfinite(coordinate) && fabs(coordinate) < 1e15;
+            cell[axis] = isFinite ? static_cast<int64_t>(floor(coordinate)) : 0;
+        }
+
+        auto found = INVALID_INDEX;
+
+        for (auto dx = -1; dx <= 1 && isFinite && found == INVALID_INDEX; dx++) {
+            for (auto dy = -1; dy <= 1 && found == INVALID_INDEX; dy++) {
+                for (auto dz = -1; dz <= 1 && found == INVALID_INDEX; dz++) {
+                    const auto head = cellHeads.find(hashCell(cell[0] + dx, cell[1] + dy, cell[2] + dz));
+                    if (head == cellHeads.end()) {
+                        continue;
+                    }
+
+                    for (auto unique = head->second; unique != INVALID_INDEX; unique = nextInCell[unique]) {
+                        if (isEqual(attributes + uniqueVertices[unique] * stride, vertexAttributes, stride, tolerance)) {
+                            found = unique;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (found == INVALID_INDEX) {
+            found = static_cast<unsigned>(uniqueVertices.size());
+            uniqueVertices.push_back(static_cast<unsigned>(vertex));
+
+            // Vertices with non finite positions are never welded, so they need no cell.
+            if (isFinite) {
+                auto& head = cellHeads.emplace(hashCell(cell[0], cell[1], cell[2]), INVALID_INDEX).first->second;
+                nextInCell.push_back(head);
+                head = found;
+            } else {
+                nextInCell.push_back(INVALID_INDEX);
+            }
+        }
+
+        remap[vertex] = found;
+    }
+
+    return uniqueVertices.size();
+}
+
+bool buildPositionRemap(const int* vertexToVertexMap, size_t mapCount, size_t vertexCount, vector<unsigned>& positionRemap)
+{
+    if (!vertexToVertexMap || mapCount != vertexCount) {
+        return false;
+    }
+
+    // Union find, the root of each set is its first vertex.
+    positionRemap.resize(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        positionRemap[vertex] = static_cast<unsigned>(vertex);
+    }
+
+    const auto findRoot = [&](unsigned vertex) {
+        while (positionRemap[vertex] != vertex) {
+            positionRemap[vertex] = positionRemap[positionRemap[vertex]];
+            vertex = positionRemap[vertex];
+        }
+
+        return vertex;
+    };
+
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        const auto linked = vertexToVertexMap[vertex];
+        if (linked < 0 || static_cast<size_t>(linked) >= vertexCount) {
+            positionRemap.clear();
+            return false;
+        }
+
+        const auto a = findRoot(static_cast<unsigned>(vertex));
+        const auto b = findRoot(static_cast<unsigned>(linked));
+        if (a != b) {
+            positionRemap[max(a, b)] = min(a, b);
+        }
+    }
+
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        positionRemap[vertex] = findRoot(static_cast<unsigned>(vertex));
+    }
+
+    return true;
+}
+
+vector<unsigned> remapPositionRemap(const vector<unsigned>& positionRemap, const vector<unsigned>& vertexRemap, size_t newVertexCount)
+{
+    vector<unsigned> newPositionRemap(newVertexCount, INVALID_INDEX);
+    vector<unsigned> representatives(positionRemap.size(), INVALID_INDEX);
+
+    // The first new vertex of a position represents it.
+    for (size_t vertex = 0; vertex < positionRemap.size(); vertex++) {
+        const auto newVertex = vertexRemap[vertex];
+        if (newVertex >= newVertexCount) {
+            continue;
+        }
+
+        auto& representative = representatives[positionRemap[vertex]];
+        if (representative == INVALID_INDEX) {
+            representative = newVertex;
+        }
+
+        newPositionRemap[newVertex] = representative;
+    }
+
+    for (size_t newVertex = 0; newVertex < newVertexCount; newVertex++) {
+        if (newPositionRemap[newVertex] == INVALID_INDEX) {
+            newPositionRemap[newVertex] = static_cast<unsigned>(newVertex);
+        }
+    }
+
+    return newPositionRemap;
+}
+
+void optimizeVertexCache(unsigned* indices, size_t indexCount, size_t vertexCount)
+{
+    const auto triangleCount = indexCount / 3;
+    if (triangleCount < 2) {
+        return;
+    }
+
+    // Triangles of each vertex, emitted triangles get swapped behind the remaining ones.
+    vector<unsigned> remainingTriangles(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++) {
+        remainingTriangles[indices[i]]++;
+    }
+
+    vector<unsigned> offsets(vertexCount + 1, 0);
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        offsets[vertex + 1] = offsets[vertex] + remainingTriangles[vertex];
+    }
+
+    vector<unsigned> vertexTriangles(triangleCount * 3);
+    {
+        vector<unsigned> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; i++) {
+            vertexTriangles[fill[indices[i]]++] = static_cast<unsigned>(i / 3);
+        }
+    }
+
+    vector<int> cachePositions(vertexCount, -1);
+    vector<float> vertexScores(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        vertexScores[vertex] = scoreVertex(-1, remainingTriangles[vertex]);
+    }
+
+    vector<float> triangleScores(triangleCount);
+    vector<bool> emitted(triangleCount, false);
+
+    auto bestTriangle = INVALID_INDEX;
+    auto bestScore = -1.0f;
+
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        const auto triangleIndices = indices + triangle * 3;
+        triangleScores[triangle] = vertexScores[triangleIndices[0]] + vertexScores[triangleIndices[1]] + vertexScores[triangleIndices[2]];
+
+        if (triangleScores[triangle] > bestScore) {
+            bestScore = triangleScores[triangle];
+            bestTriangle = static_cast<unsigned>(triangle);
+        }
+    }
+
+    vector<unsigned> result(triangleCount * 3);
+    vector<unsigned> cache;
+    vector<unsigned> newCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    newCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    size_t nextCandidate = 0;
+
+    for (size_t output = 0; output < triangleCount; output++) {
+        // Dead end - continue with the next triangle in input order.
+        if (bestTriangle == INVALID_INDEX) {
+            while (emitted[nextCandidate]) {
+                nextCandidate++;
+            }
+
+            bestTriangle = static_cast<unsigned>(nextCandidate);
+        }
+
+        const auto triangleIndices = indices + static_cast<size_t>(bestTriangle) * 3;
+        copy(triangleIndices, triangleIndices + 3, result.begin() + static_cast<ptrdiff_t>(output * 3));
+        emitted[bestTriangle] = true;
+
+        newCache.clear();
+
+        for (auto corner = 0; corner < 3; corner++) {
+            const auto vertex = triangleIndices[corner];
+
+            // Degenerate triangles reference a vertex more than once and are listed once per
+            // reference, so each corner removes one entry.
+            auto first = vertexTriangles.begin() + offsets[vertex];
+            auto last = first + remainingTriangles[vertex];
+            auto position = find(first, last, bestTriangle);
+            if (position != last) {
+                iter_swap(position, last - 1);
+                remainingTriangles[vertex]--;
+            }
+
+            if (find(newCache.begin(), newCache.end(), vertex) == newCache.end()) {
+                newCache.push_back(vertex);
+            }
+        }
+
+        for (const auto vertex : cache) {
+            if (find(newCache.begin(), newCache.end(), vertex) == newCache.end()) {
+                newCache.push_back(vertex);
+            }
+        }
+
+        for (size_t i = 0; i < newCache.size(); i++) {
+            const auto vertex = newCache[i];
+            cachePositions[vertex] = i < FORSYTH_CACHE_SIZE ? static_cast<int>(i) : -1;
+            vertexScores[vertex] = scoreVertex(cachePositions[vertex], remainingTriangles[vertex]);
+        }
+
+        // Rescore the remaining triangles of all touched vertices, including the evicted ones.
+        bestTriangle = INVALID_INDEX;
+        bestScore = -1.0f;
+
+        for (const auto vertex : newCache) {
+            for (auto i = offsets[vertex]; i < offsets[vertex] + remainingTriangles[vertex]; i++) {
+                const auto triangle = vertexTriangles[i];
+                if (emitted[triangle]) {
+                    continue;
+                }
+
+                const auto neighbourIndices = indices + static_cast<size_t>(triangle) * 3;
+
+                triangleScores[triangle] = vertexScores[neighbourIndices[0]] + vertexScores[neighbourIndices[1]] + vertexScores[neighbourIndices[2]];
+
+                if (triangleScores[triangle] > bestScore) {
+                    bestScore = triangleScores[triangle];
+                    bestTriangle = triangle;
+                }
+            }
+        }
+
+        cache.assign(newCache.begin(), newCache.begin() + static_cast<ptrdiff_t>(min(newCache.size(), static_cast<size_t>(FORSYTH_CACHE_SIZE))));
+    }
+
+    copy(result.begin(), result.end(), indices);
+}
+
+size_t optimizeVertexFetch(unsigned* indices, size_t indexCount, size_t vertexCount, vector<unsigned>& remap)
+{
+    remap.assign(vertexCount, INVALID_INDEX);
+
+    unsigned nextVertex = 0;
+
+    for (size_t i = 0; i < indexCount; i++) {
+        auto& newIndex = remap[indices[i]];
+        if (newIndex == INVALID_INDEX) {
+            newIndex = nextVertex++;
+        }
+
+        indices[i] = newIndex;
+    }
+
+    const size_t referencedCount = nextVertex;
+
+    for (auto& newIndex : remap) {
+        if (newIndex == INVALID_INDEX) {
+            newIndex = nextVertex++;
+        }
+    }
+
+    return referencedCount;
+}
+
+size_t computeCacheMisses(const unsigned* indices, size_t indexCount, size_t vertexCount, unsigned cacheSize)
+{
+    // A vertex is cached if less than cache size vertices were transformed since its own transform.
+    vector<size_t> timestamps(vertexCount, 0);
+    size_t time = static_cast<size_t>(cacheSize) + 1;
+    size_t misses = 0;
+
+    for (size_t i = 0; i < indexCount; i++) {
+        const auto vertex = indices[i];
+
+        if (time - timestamps[vertex] > cacheSize) {
+            timestamps[vertex] = time++;
+            misses++;
+        }
+    }
+
+    return misses;
+}
+
+double computeAcmr(const unsigned* indices, size_t indexCount, size_t vertexCount, unsigned cacheSize)
+{
+    const auto triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return 0.0;
+    }
+
+    return static_cast<double>(computeCacheMisses(indices, indexCount, vertexCount, cacheSize)) / static_cast<double>(triangleCount);
+}
+
+} // namespace GCL::Utilities::MeshOptimizer
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace GCL::Utilities::MeshOptimizer {
+
+using namespace std;
+
+///
+/// \brief Default size of the simulated post-transform vertex cache.
+///
+constexpr unsigned DEFAULT_CACHE_SIZE = 16;
+
+///
+/// \brief Welds vertices whose attributes are equal within a tolerance.
+///
+/// Vertices are hashed by their position quantized to the tolerance, candidates of
+/// the neighbouring cells are compared attribute by attribute. The first vertex of a
+/// welded group is kept, so the order of the unique vertices is stable.
+///
+/// If a position remap is given, e.g. from the vertex to vertex map of a granny topology,
+/// only vertices sharing a position by the remap are compared and nothing is hashed.
+///
+/// \param attributes Vertex attributes, stride floats per vertex, the first three are the position.
+/// \param vertexCount Number of vertices.
+/// \param stride Number of floats per vertex, at least three.
+/// \param tolerance Maximum absolute difference of each attribute of welded vertices.
+/// \param remap Receives the index of the unique vertex of each vertex.
+/// \param positionRemap Representative vertex of the position of each vertex or nullptr.
+/// \return Number of unique vertices.
+///
+size_t weldVertices(
+    const float* attributes,
+    size_t vertexCount,
+    size_t stride,
+    float tolerance,
+    vector<unsigned>& remap,
+    const unsigned* positionRemap = nullptr);
+
+///
+/// \brief Builds a position remap from a vertex to vertex map, e.g. of a granny topology.
+///
+/// Vertices linked by the map, directly or transitively, share their position. Each vertex
+/// is remapped to the first vertex of its position, which is remapped to itself.
+///
+/// \param vertexToVertexMap Linked vertex of each vertex.
+/// \param mapCount Number of entries of the map.
+/// \param vertexCount Number of vertices.
+/// \param positionRemap Receives the representative vertex of the position of each vertex.
+/// \return False if the map does not match the vertices.
+///
+bool buildPositionRemap(const int* vertexToVertexMap, size_t mapCount, size_t vertexCount, vector<unsigned>& positionRemap);
+
+///
+/// \brief Applies a vertex remap to a position remap, e.g. after vertices got welded or reordered.
+/// \param positionRemap Representative vertex of the position of each old vertex.
+/// \param vertexRemap New index of each old vertex or ~0u for removed vertices.
+/// \param newVertexCount Number of new vertices.
+/// \return Representative vertex of the position of each new vertex.
+///
+vector<unsigned> remapPositionRemap(const vector<unsigned>& positionRemap, const vector<unsigned>& vertexRemap, size_t newVertexCount);
+
+///
+/// \brief Reorders triangles in place for post-transform vertex cache efficiency.
+///
+/// Greedy linear-speed optimization by Tom Forsyth, which favours triangles with vertices
+/// in a simulated LRU cache and vertices with few remaining triangles. Every triangle is
+/// kept with its winding, degenerate ones included.
+///
+/// \param indices Triangle list indices.
+/// \param indexCount Number of indices, a multiple of three.
+/// \param vertexCount Number of vertices referenced by the indices.
+///
+void optimizeVertexCache(unsigned* indices, size_t indexCount, size_t vertexCount);
+
+///
+/// \brief Computes a vertex order for fetch locality, i.e. in order of first use by the triangles.
+///
+/// Indices are remapped in place. Vertices which are not referenced keep their relative
+/// order and are moved behind the referenced ones.
+///
+/// \param indices Triangle list indices.
+/// \param indexCount Number of indices.
+/// \param vertexCount Number of vertices.
+/// \param remap Receives the new index of each vertex.
+/// \return Number of referenced vertices.
+///
+size_t optimizeVertexFetch(unsigned* indices, size_t indexCount, size_t vertexCount, vector<unsigned>& remap);
+
+///
+/// \brief Computes the average cache miss ratio, i.e. transformed vertices per triangle.
+///
+/// Simulates a FIFO post-transform vertex cache. 0.5 is the optimum for regular grids,
+/// 3.0 means no reuse at all.
+///
+/// \param indices Triangle list indices.
+/// \param indexCount Number of indices.
+/// \param vertexCount Number of vertices referenced by the indices.
+/// \param cacheSize Size of the simulated cache.
+/// \return Average cache miss ratio or zero if there are no triangles.
+///
+double computeAcmr(const unsigned* indices, size_t indexCount, size_t vertexCount, unsigned cacheSize = DEFAULT_CACHE_SIZE);
+
+///
+/// \brief Computes the number of vertex cache misses, see computeAcmr.
+/// \param indices Triangle list indices.
+/// \param indexCount Number of indices.
+/// \param vertexCount Number of vertices referenced by the indices.
+/// \param cacheSize Size of the simulated cache.
+/// \return Number of transformed vertices.
+///
+size_t computeCacheMisses(const unsigned* indices, size_t indexCount, size_t vertexCount, unsigned cacheSize = DEFAULT_CACHE_SIZE);
+
+} // namespace GCL::Utilities::MeshOptimizer
@@ -0,0 +1,417 @@
+#include "gcl/utilities/meshsimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace GCL::Utilities::MeshSimplifier {
+
+using namespace std;
+
+namespace {
+
+///
+/// \brief Symmetric 4x4 error quadric of squared distances to planes, weighted by triangle area.
+///
+struct Quadric {
+    double a00 = 0.0, a11 = 0.0, a22 = 0.0, a01 = 0.0, a02 = 0.0, a12 = 0.0;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+    double c = 0.0;
+    double weight = 0.0;
+
+    void addPlane(const double normal[3], double distance, double planeWeight)
+    {
+        a00 += planeWeight * normal[0] * normal[0];
+        a11 += planeWeight * normal[1] * normal[1];
+        a22 += planeWeight * normal[2] * normal[2];
+        a01 += planeWeight * normal[0] * normal[1];
+        a02 += planeWeight * normal[0] * normal[2];
+        a12 += planeWeight * normal[1] * normal[2];
+        b0 += planeWeight * normal[0] * distance;
+        b1 += planeWeight * normal[1] * distance;
+        b2 += planeWeight * normal[2] * distance;
+        c += planeWeight * distance * distance;
+        weight += planeWeight;
+    }
+
+    void add(const Quadric& other)
+    {
+        a00 += other.a00;
+        a11 += other.a11;
+        a22 += other.a22;
+        a01 += other.a01;
+        a02 += other.a02;
+        a12 += other.a12;
+        b0 += other.b0;
+        b1 += other.b1;
+        b2 += other.b2;
+        c += other.c;
+        weight += other.weight;
+    }
+
+    ///
+    /// \brief Returns the squared distance of a point to the planes, averaged by their weight.
+    ///
+    double error(const float point[3]) const
+    {
+        const double x = point[0];
+        const double y = point[1];
+        const double z = point[2];
+
+        const auto result = a00 * x * x + a11 * y * y + a22 * z * z
+            + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+            + 2.0 * (b0 * x + b1 * y + b2 * z)
+            + c;
+
+        return weight > 0.0 ? fabs(result) / weight : 0.0;
+    }
+};
+
+///
+/// \brief Candidate collapse of a vertex onto another vertex.
+///
+struct Collapse {
+    unsigned from;
+    unsigned to;
+    double error;
+};
+
+///
+/// \brief Returns the not normalized normal of a triangle.
+///
+void computeNormal(const float* p0, const float* p1, const float* p2, double normal[3])
+{
+    const double e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    const double e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+
+    normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+///
+/// \brief Bit pattern of a position, to find vertices sharing it.
+///
+struct PositionKey {
+    uint32_t bits[3];
+
+    bool operator==(const PositionKey& other) const
+    {
+        return bits[0] == other.bits[0] && bits[1] == other.bits[1] && bits[2] == other.bits[2];
+    }
+};
+
+struct PositionKeyHash {
+    size_t operator()(const PositionKey& key) const
+    {
+        auto hash = static_cast<uint64_t>(key.bits[0]) * 0x9e3779b97f4a7c15ull;
+        hash ^= (static_cast<uint64_t>(key.bits[1]) * 0xc2b2ae3d27d4eb4full) + (hash << 6) + (hash >> 2);
+        hash ^= (static_cast<uint64_t>(key.bits[2]) * 0x165667b19e3779f9ull) + (hash << 6) + (hash >> 2);
+        return static_cast<size_t>(hash);
+    }
+};
+
+uint64_t edgeKey(unsigned a, unsigned b)
+{
+    return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+} // namespace
+
+size_t simplify(
+    unsigned* destination,
+    const unsigned* indices,
+    size_t indexCount,
+    const float* positions,
+    size_t vertexCount,
+    size_t positionStride,
+    const unsigned* vertexClasses,
+    const unsigned char* vertexLocks,
+    const unsigned* positionRemap,
+    size_t targetIndexCount,
+    float targetError,
+    float* resultError)
+{
+    indexCount -= indexCount % 3;
+
+    vector<unsigned> result(indices, indices + indexCount);
+    auto maxError = 0.0;
+
+    // Positions scaled to the unit cube, so the target error is relative to the extent.
+    vector<float> points(vertexCount * 3);
+    {
+        float minimum[3] = { INFINITY, INFINITY, INFINITY };
+        float maximum[3] = { -INFINITY, -INFINITY, -INFINITY };
+
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            for (auto axis = 0; axis < 3; axis++) {
+                minimum[axis] = min(minimum[axis], positions[vertex * positionStride + axis]);
+                maximum[axis] = max(maximum[axis], positions[vertex * positionStride + axis]);
+            }
+        }
+
+        const auto extent = max({ maximum[0] - minimum[0], maximum[1] - minimum[1], maximum[2] - minimum[2] });
+        const auto scale = extent > 0.0f ? 1.0f / extent : 0.0f;
+
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            for (auto axis = 0; axis < 3; axis++) {
+                points[vertex * 3 + axis] = (positions[vertex * positionStride + axis] - minimum[axis]) * scale;
+            }
+        }
+    }
+
+    // Vertices sharing a position are seams, borders are edges without opposite edge.
+    vector<unsigned> positionVertices(vertexCount);
+    vector<unsigned char> locked(vertexCount, 0);
+    {
+        if (positionRemap) {
+            for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+                positionVertices[vertex] = positionRemap[vertex];
+
+                if (positionRemap[vertex] != vertex) {
+                    locked[vertex] = 1;
+                    locked[positionRemap[vertex]] = 1;
+                }
+            }
+        } else {
+            unordered_map<PositionKey, unsigned, PositionKeyHash> firstVertices;
+            firstVertices.reserve(vertexCount);
+
+            for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+                PositionKey key;
+                memcpy(key.bits, &points[vertex * 3], sizeof(key.bits));
+
+                const auto inserted = firstVertices.emplace(key, static_cast<unsigned>(vertex));
+
+                positionVertices[vertex] = inserted.first->second;
+
+                if (!inserted.second) {
+                    locked[vertex] = 1;
+                    locked[inserted.first->second] = 1;
+                }
+            }
+        }
+
+        if (vertexLocks) {
+            for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+                locked[vertex] |= vertexLocks[vertex] ? 1 : 0;
+            }
+        }
+
+        unordered_set<uint64_t> edges;
+        edges.reserve(indexCount);
+
+        for (size_t i = 0; i < indexCount; i += 3) {
+            for (auto corner = 0; corner < 3; corner++) {
+                edges.insert(edgeKey(positionVertices[result[i + corner]], positionVertices[result[i + (corner + 1) % 3]]));
+            }
+        }
+
+        for (size_t i = 0; i < indexCount; i += 3) {
+            for (auto corner = 0; corner < 3; corner++) {
+                const auto a = result[i + corner];
+                const auto b = result[i + (corner + 1) % 3];
+
+                if (!edges.count(edgeKey(positionVertices[b], positionVertices[a]))) {
+                    locked[a] = 1;
+                    locked[b] = 1;
+                }
+            }
+        }
+    }
+
+    vector<Quadric> quadrics(vertexCount);
+    for (size_t i = 0; i < indexCount; i += 3) {
+        const auto p0 = &points[result[i] * 3];
+        const auto p1 = &points[result[i + 1] * 3];
+        const auto p2 = &points[result[i + 2] * 3];
+
+        double normal[3];
+        computeNormal(p0, p1, p2, normal);
+
+        const auto length = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (length <= 0.0) {
+            continue;
+        }
+
+        normal[0] /= length;
+        normal[1] /= length;
+        normal[2] /= length;
+
+        const auto distance = -(normal[0] * p0[0] + normal[1] * p0[1] + normal[2] * p0[2]);
+        const auto area = length * 0.5;
+
+        for (auto corner = 0; corner < 3; corner++) {
+            quadrics[result[i + corner]].addPlane(normal, distance, area);
+        }
+    }
+
+    const auto maxCollapseError = static_cast<double>(targetError) * static_cast<double>(targetError);
+
+    vector<unsigned> remap(vertexCount);
+    vector<unsigned char> touched(vertexCount);
+    vector<unsigned> offsets(vertexCount + 1);
+    vector<unsigned> vertexTriangles;
+    vector<Collapse> collapses;
+
+    while (result.size() > targetIndexCount) {
+        const auto triangleCount = result.size() / 3;
+
+        // Triangles of each vertex for the flip test.
+        fill(offsets.begin(), offsets.end(), 0);
+        for (const auto index : result) {
+            offsets[index + 1]++;
+        }
+
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            offsets[vertex + 1] += offsets[vertex];
+        }
+
+        vertexTriangles.resize(result.size());
+        {
+            vector<unsigned> fillOffsets(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < result.size(); i++) {
+                vertexTriangles[fillOffsets[result[i]]++] = static_cast<unsigned>(i / 3);
+            }
+        }
+
+        collapses.clear();
+
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (auto corner = 0; corner < 3; corner++) {
+                const auto a = result[i + corner];
+                const auto b = result[i + (corner + 1) % 3];
+
+                if (vertexClasses && vertexClasses[a] != vertexClasses[b]) {
+                    continue;
+                }
+
+                for (const auto& [from, to] : { make_pair(a, b), make_pair(b, a) }) {
+                    if (locked[from] || from == to) {
+                        continue;
+                    }
+
+                    auto quadric = quadrics[from];
+                    quadric.add(quadrics[to]);
+
+                    const auto error = quadric.error(&points[to * 3]);
+                    if (error <= maxCollapseError) {
+                        collapses.push_back({ from, to, error });
+                    }
+                }
+            }
+        }
+
+        if (collapses.empty()) {
+            break;
+        }
+
+        sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.error < b.error;
+        });
+
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            remap[vertex] = static_cast<unsigned>(vertex);
+        }
+
+        fill(touched.begin(), touched.end(), 0);
+
+        // Each collapse removes about two triangles.
+        const auto triangleGoal = (result.size() - targetIndexCount) / 3;
+        size_t removedTriangles = 0;
+        size_t appliedCollapses = 0;
+
+        for (const auto& collapse : collapses) {
+            if (removedTriangles >= triangleGoal) {
+                break;
+            }
+
+            if (touched[collapse.from] || touched[collapse.to]) {
+                continue;
+            }
+
+            // Reject collapses which flip or squash the triangles around the moved vertex.
+            auto flips = false;
+            size_t sharedTriangles = 0;
+
+            for (auto j = offsets[collapse.from]; j < offsets[collapse.from + 1] && !flips; j++) {
+                const auto triangle = &result[static_cast<size_t>(vertexTriangles[j]) * 3];
+
+                if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to) {
+                    sharedTriangles++;
+                    continue;
+                }
+
+                const float* before[3];
+                const float* after[3];
+
+                for (auto corner = 0; corner < 3; corner++) {
+                    before[corner] = &points[triangle[corner] * 3];
+                    after[corner] = triangle[corner] == collapse.from ? &points[collapse.to * 3] : before[corner];
+                }
+
+                double normalBefore[3];
+                double normalAfter[3];
+                computeNormal(before[0], before[1], before[2], normalBefore);
+                computeNormal(after[0], after[1], after[2], normalAfter);
+
+                const auto dot = normalBefore[0] * normalAfter[0] + normalBefore[1] * normalAfter[1] + normalBefore[2] * normalAfter[2];
+                const auto lengths = sqrt(normalBefore[0] * normalBefore[0] + normalBefore[1] * normalBefore[1] + normalBefore[2] * normalBefore[2])
+                    * sqrt(normalAfter[0] * normalAfter[0] + normalAfter[1] * normalAfter[1] + normalAfter[2] * normalAfter[2]);
+
+                flips = dot <= 0.25 * lengths;
+            }
+
+            if (flips) {
+                continue;
+            }
+
+            // Moving a vertex changes all triangles around it, so they wait for the next pass.
+            for (auto j = offsets[collapse.from]; j < offsets[collapse.from + 1]; j++) {
+                const auto triangle = &result[static_cast<size_t>(vertexTriangles[j]) * 3];
+                touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = 1;
+            }
+
+            remap[collapse.from] = collapse.to;
+            quadrics[collapse.to].add(quadrics[collapse.from]);
+
+            removedTriangles += sharedTriangles;
+            appliedCollapses++;
+            maxError = max(maxError, collapse.error);
+        }
+
+        if (!appliedCollapses) {
+            break;
+        }
+
+        // Remap the indices and remove the collapsed triangles.
+        size_t writeIndex = 0;
+        for (size_t i = 0; i < triangleCount * 3; i += 3) {
+            const auto i0 = remap[result[i]];
+            const auto i1 = remap[result[i + 1]];
+            const auto i2 = remap[result[i + 2]];
+
+            if (i0 != i1 && i1 != i2 && i2 != i0) {
+                result[writeIndex++] = i0;
+                result[writeIndex++] = i1;
+                result[writeIndex++] = i2;
+            }
+        }
+
+        result.resize(writeIndex);
+    }
+
+    if (resultError) {
+        *resultError = static_cast<float>(sqrt(maxError));
+    }
+
+    memcpy(destination, result.data(), result.size() * sizeof(unsigned));
+
+    return result.size();
+}
+
+} // namespace GCL::Utilities::MeshSimplifier
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+namespace GCL::Utilities::MeshSimplifier {
+
+///
+/// \brief Simplifies a triangle list by collapsing edges with the least quadric error.
+///
+/// Vertices are collapsed onto existing vertices, so their attributes stay valid and
+/// no vertices are created. Vertices which can not move without changing the appearance
+/// or the skinning of the mesh are locked:
+///  - vertices on open borders, e.g. the boundary of a material group,
+///  - vertices sharing their position with other vertices, e.g. uv or normal seams,
+///  - vertices locked by the caller.
+/// Vertices are only collapsed onto vertices of the same class, e.g. of the same dominant
+/// bone, so skin weights do not bleed over joints.
+///
+/// \param destination Receives the simplified indices, may be the same as indices.
+/// \param indices Triangle list indices.
+/// \param indexCount Number of indices, a multiple of three.
+/// \param positions Vertex positions, positionStride floats per vertex.
+/// \param vertexCount Number of vertices.
+/// \param positionStride Number of floats between the positions of consecutive vertices.
+/// \param vertexClasses Class of each vertex or nullptr if all vertices are of the same class.
+/// \param vertexLocks Non-zero for vertices which must not move or nullptr.
+/// \param positionRemap Representative vertex of the position of each vertex, e.g. from the
+/// vertex to vertex map of a granny topology, or nullptr to find shared positions by hashing.
+/// \param targetIndexCount Number of indices to simplify to.
+/// \param targetError Maximum error relative to the extent of the mesh, e.g. 0.01 for 1%.
+/// \param resultError Receives the relative error of the simplified mesh, optional.
+/// \return Number of simplified indices.
+///
+size_t simplify(
+    unsigned* destination,
+    const unsigned* indices,
+    size_t indexCount,
+    const float* positions,
+    size_t vertexCount,
+    size_t positionStride,
+    const unsigned* vertexClasses,
+    const unsigned char* vertexLocks,
+    const unsigned* positionRemap,
+    size_t targetIndexCount,
+    float targetError,
+    float* resultError = nullptr);
+
+} // namespace GCL::Utilities::MeshSimplifier
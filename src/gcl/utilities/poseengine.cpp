@@ -0,0 +1,199 @@
+#include "gcl/utilities/poseengine.h"
+
+#include <cmath>
+
+namespace GCL::Utilities {
+
+PoseEngine::PoseEngine(const GrannyBone* bones, size_t boneCount, const GrannyTransform* placement)
+    : m_parents(boneCount, -1)
+    , m_restTransforms(boneCount)
+    , m_localTransforms(boneCount)
+    , m_worldTransforms(boneCount)
+{
+    if (placement) {
+        buildMatrix(*placement, m_placement);
+    } else {
+        m_placement = VectorMath::identity();
+    }
+
+    const auto count = static_cast<int>(boneCount);
+    auto isSorted = true;
+
+    for (auto boneIndex = 0; boneIndex < count; boneIndex++) {
+        const auto parentIndex = bones[boneIndex].ParentIndex;
+        if (parentIndex >= 0 && parentIndex < count && parentIndex != boneIndex) {
+            m_parents[static_cast<size_t>(boneIndex)] = parentIndex;
+            isSorted &= parentIndex < boneIndex;
+        }
+
+        m_restTransforms[static_cast<size_t>(boneIndex)] = bones[boneIndex].LocalTransform;
+    }
+
+    // Granny skeletons usually store parents before their children.
+    if (isSorted) {
+        m_order.resize(boneCount);
+        for (size_t boneIndex = 0; boneIndex < boneCount; boneIndex++) {
+            m_order[boneIndex] = static_cast<unsigned>(boneIndex);
+        }
+
+        return;
+    }
+
+    // Otherwise walk the hierarchy breadth first from the root bones.
+    vector<vector<unsigned>> children(boneCount);
+    for (size_t boneIndex = 0; boneIndex < boneCount; boneIndex++) {
+        if (m_parents[boneIndex] >= 0) {
+            children[static_cast<size_t>(m_parents[boneIndex])].push_back(static_cast<unsigned>(boneIndex));
+        }
+    }
+
+    vector<bool> visited(boneCount, false);
+    m_order.reserve(boneCount);
+
+    const auto walk = [&](size_t root) {
+        visited[root] = true;
+
+        auto next = m_order.size();
+        m_order.push_back(static_cast<unsigned>(root));
+
+        while (next < m_order.size()) {
+            for (const auto child : children[m_order[next++]]) {
+                if (!visited[child]) {
+                    visited[child] = true;
+                    m_order.push_back(child);
+                }
+            }
+        }
+    };
+
+    for (size_t boneIndex = 0; boneIndex < boneCount; boneIndex++) {
+        if (m_parents[boneIndex] < 0) {
+            walk(boneIndex);
+        }
+    }
+
+    // Bones in a parent cycle are never reached from a root, they become roots instead.
+    for (size_t boneIndex = 0; boneIndex < boneCount; boneIndex++) {
+        if (!visited[boneIndex]) {
+            m_parents[boneIndex] = -1;
+            walk(boneIndex);
+        }
+    }
+}
+
+void PoseEngine::computeRestPose()
+{
+    computePose(m_restTransforms.data());
+}
+
+void PoseEngine::computePose(const GrannyTransform* localTransforms)
+{
+    PoseMatrix local;
+
+    for (size_t boneIndex = 0; boneIndex < m_parents.size(); boneIndex++) {
+        if (m_parents[boneIndex] < 0) {
+            buildMatrix(localTransforms[boneIndex], local);
+            multiply(local, m_placement, m_localTransforms[boneIndex]);
+        } else {
+            buildMatrix(localTransforms[boneIndex], m_localTransforms[boneIndex]);
+        }
+    }
+
+    composeWorldTransforms();
+}
+
+size_t PoseEngine::getBoneCount() const
+{
+    return m_parents.size();
+}
+
+const vector<unsigned>& PoseEngine::getOrder() const
+{
+    return m_order;
+}
+
+const PoseMatrix& PoseEngine::getLocalTransform(size_t boneIndex) const
+{
+    return m_localTransforms[boneIndex];
+}
+
+const PoseMatrix& PoseEngine::getWorldTransform(size_t boneIndex) const
+{
+    return m_worldTransforms[boneIndex];
+}
+
+void PoseEngine::buildMatrix(const GrannyTransform& transform, PoseMatrix& matrix)
+{
+    float rotation[3][3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+
+    if (transform.Flags & GrannyTransformFlags::GrannyHasOrientation) {
+        auto x = transform.Orientation[0];
+        auto y = transform.Orientation[1];
+        auto z = transform.Orientation[2];
+        auto w = transform.Orientation[3];
+
+        const auto length = sqrtf(x * x + y * y + z * z + w * w);
+        if (length > 0.0f) {
+            x /= length;
+            y /= length;
+            z /= length;
+            w /= length;
+
+            rotation[0][0] = 1.0f - 2.0f * (y * y + z * z);
+            rotation[0][1] = 2.0f * (x * y - w * z);
+            rotation[0][2] = 2.0f * (x * z + w * y);
+            rotation[1][0] = 2.0f * (x * y + w * z);
+            rotation[1][1] = 1.0f - 2.0f * (x * x + z * z);
+            rotation[1][2] = 2.0f * (y * z - w * x);
+            rotation[2][0] = 2.0f * (x * z - w * y);
+            rotation[2][1] = 2.0f * (y * z + w * x);
+            rotation[2][2] = 1.0f - 2.0f * (x * x + y * y);
+        }
+    }
+
+    // The rows of the matrix are the columns of rotation times scale/shear.
+    for (auto row = 0; row < 3; row++) {
+        for (auto column = 0; column < 3; column++) {
+            if (transform.Flags & GrannyTransformFlags::GrannyHasScaleShear) {
+                matrix.rows[row][column] = rotation[column][0] * transform.ScaleShear[0][row]
+                    + rotation[column][1] * transform.ScaleShear[1][row]
+                    + rotation[column][2] * transform.ScaleShear[2][row];
+            } else {
+                matrix.rows[row][column] = rotation[column][row];
+            }
+        }
+
+        matrix.rows[row][3] = 0.0f;
+    }
+
+    if (transform.Flags & GrannyTransformFlags::GrannyHasPosition) {
+        matrix.rows[3][0] = transform.Position[0];
+        matrix.rows[3][1] = transform.Position[1];
+        matrix.rows[3][2] = transform.Position[2];
+    } else {
+        matrix.rows[3][0] = 0.0f;
+        matrix.rows[3][1] = 0.0f;
+        matrix.rows[3][2] = 0.0f;
+    }
+
+    matrix.rows[3][3] = 1.0f;
+}
+
+void PoseEngine::multiply(const PoseMatrix& first, const PoseMatrix& second, PoseMatrix& result)
+{
+    VectorMath::multiply(first, second, result);
+}
+
+void PoseEngine::composeWorldTransforms()
+{
+    for (const auto boneIndex : m_order) {
+        const auto parentIndex = m_parents[boneIndex];
+        if (parentIndex < 0) {
+            m_worldTransforms[boneIndex] = m_localTransforms[boneIndex];
+        } else {
+            multiply(m_localTransforms[boneIndex], m_worldTransforms[static_cast<size_t>(parentIndex)], m_worldTransforms[boneIndex]);
+        }
+    }
+}
+
+} // namespace GCL::Utilities
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/vectormath.h"
+
+#include <vector>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief 4x4 matrix with the translation in the last row, the memory layout of FbxAMatrix.
+///
+using PoseMatrix = VectorMath::Matrix4;
+
+///
+/// \brief Computes the world transforms of all bones of a skeleton in one pass.
+///
+/// The bones are evaluated in topological order, so the world transform of a parent is
+/// always known before its children are composed with it. Matrices are composed with
+/// SSE when available. The initial placement of the model is the parent of all root bones.
+///
+class PoseEngine {
+public:
+    ///
+    /// \brief Constructor
+    /// \param bones Flat granny bone array, e.g. the bones of a granny skeleton.
+    /// \param boneCount Number of bones.
+    /// \param placement Transform of the root bones, e.g. the initial placement of the model or nullptr.
+    ///
+    PoseEngine(const GrannyBone* bones, size_t boneCount, const GrannyTransform* placement = nullptr);
+
+    ///
+    /// \brief Computes the world transforms of the rest pose given by the local transforms of the bones.
+    ///
+    void computeRestPose();
+
+    ///
+    /// \brief Computes the world transforms of a pose, e.g. of a sampled animation frame.
+    /// \param localTransforms Local transform of each bone in bone order.
+    ///
+    void computePose(const GrannyTransform* localTransforms);
+
+    ///
+    /// \brief Returns the number of bones.
+    /// \return Bone count
+    ///
+    size_t getBoneCount() const;
+
+    ///
+    /// \brief Returns the bone indices in evaluation order, parents before their children.
+    /// \return Bone indices
+    ///
+    const vector<unsigned>& getOrder() const;
+
+    ///
+    /// \brief Returns the transform of a bone relative to its parent, including the placement for root bones.
+    /// \param boneIndex Index of the bone.
+    /// \return Parent relative transform
+    ///
+    const PoseMatrix& getLocalTransform(size_t boneIndex) const;
+
+    ///
+    /// \brief Returns the world transform of a bone.
+    /// \param boneIndex Index of the bone.
+    /// \return World transform
+    ///
+    const PoseMatrix& getWorldTransform(size_t boneIndex) const;
+
+    ///
+    /// \brief Builds the matrix of a granny transform, scale/shear first, then orientation and position.
+    /// \param transform Granny transform
+    /// \param matrix Receives the matrix.
+    ///
+    static void buildMatrix(const GrannyTransform& transform, PoseMatrix& matrix);
+
+    ///
+    /// \brief Multiplies two matrices, the result applies first first and then second.
+    /// \param first Matrix which is applied first, e.g. a local transform.
+    /// \param second Matrix which is applied second, e.g. the world transform of the parent.
+    /// \param result Receives the product, may not alias the factors.
+    ///
+    static void multiply(const PoseMatrix& first, const PoseMatrix& second, PoseMatrix& result);
+
+protected:
+    ///
+    /// \brief Composes the local transforms to world transforms in evaluation order.
+    ///
+    void composeWorldTransforms();
+
+    ///
+    /// \brief Parent index of each bone, -1 for root bones.
+    ///
+    vector<int> m_parents;
+
+    ///
+    /// \brief Bone indices in evaluation order.
+    ///
+    vector<unsigned> m_order;
+
+    ///
+    /// \brief Local transforms of the rest pose.
+    ///
+    vector<GrannyTransform> m_restTransforms;
+
+    ///
+    /// \brief Transform of the root bones.
+    ///
+    PoseMatrix m_placement;
+
+    ///
+    /// \brief Parent relative transforms of the current pose.
+    ///
+    vector<PoseMatrix> m_localTransforms;
+
+    ///
+    /// \brief World transforms of the current pose.
+    ///
+    vector<PoseMatrix> m_worldTransforms;
+};
+
+} // namespace GCL::Utilities
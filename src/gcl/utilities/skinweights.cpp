@@ -0,0 +1,253 @@
+#include "gcl/utilities/skinweights.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define GCL_SKIN_WEIGHTS_SSE
+#include <emmintrin.h>
+#endif
+
+namespace GCL::Utilities::SkinWeights {
+
+using namespace std;
+
+namespace {
+
+///
+/// \brief Number of vertices processed at once, one per SSE lane.
+///
+constexpr size_t BLOCK_SIZE = 4;
+
+///
+/// \brief Influences of a block of vertices, stored by influence slot and then by vertex.
+///
+struct Block {
+    int weights[MAX_INFLUENCES][BLOCK_SIZE];
+    int ranks[MAX_INFLUENCES][BLOCK_SIZE];
+    int kept[MAX_INFLUENCES][BLOCK_SIZE];
+    float normalized[MAX_INFLUENCES][BLOCK_SIZE];
+};
+
+///
+/// \brief Ranks, prunes and normalizes the influences of a block of vertices.
+///
+/// Influences are ranked by weight and equal weights by slot, so each rank is unique.
+///
+void processBlock(Block& block, int maxInfluences, float threshold)
+{
+#ifdef GCL_SKIN_WEIGHTS_SSE
+    __m128i weights[MAX_INFLUENCES];
+    __m128i keys[MAX_INFLUENCES];
+    __m128i kept[MAX_INFLUENCES];
+
+    for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+        weights[slot] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.weights[slot]));
+        keys[slot] = _mm_add_epi32(_mm_slli_epi32(weights[slot], 2), _mm_set1_epi32(static_cast<int>(MAX_INFLUENCES - 1 - slot)));
+    }
+
+    const auto zero = _mm_setzero_si128();
+    auto sum = _mm_setzero_ps();
+
+    for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+        // Count the greater keys, comparisons are -1 for true.
+        auto rank = zero;
+        for (unsigned other = 0; other < MAX_INFLUENCES; other++) {
+            if (other != slot) {
+                rank = _mm_sub_epi32(rank, _mm_cmpgt_epi32(keys[other], keys[slot]));
+            }
+        }
+
+        const auto weight = _mm_cvtepi32_ps(weights[slot]);
+        const auto isLargest = _mm_cmpeq_epi32(rank, zero);
+        const auto isAboveThreshold = _mm_castps_si128(_mm_cmpge_ps(weight, _mm_set1_ps(threshold)));
+
+        kept[slot] = _mm_and_si128(_mm_cmpgt_epi32(weights[slot], zero), _mm_cmplt_epi32(rank, _mm_set1_epi32(maxInfluences)));
+        kept[slot] = _mm_and_si128(kept[slot], _mm_or_si128(isLargest, isAboveThreshold));
+        sum = _mm_add_ps(sum, _mm_and_ps(_mm_castsi128_ps(kept[slot]), weight));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(block.ranks[slot]), rank);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(block.kept[slot]), kept[slot]);
+    }
+
+    // Vertices without weights get a scale of zero.
+    const auto hasWeights = _mm_cmpgt_ps(sum, _mm_setzero_ps());
+    const auto scale = _mm_and_ps(hasWeights, _mm_div_ps(_mm_set1_ps(255.0f), _mm_max_ps(sum, _mm_set1_ps(1.0f))));
+
+    for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+        const auto weight = _mm_and_ps(_mm_castsi128_ps(kept[slot]), _mm_cvtepi32_ps(weights[slot]));
+        _mm_storeu_ps(block.normalized[slot], _mm_mul_ps(weight, scale));
+    }
+#else
+    for (size_t vertex = 0; vertex < BLOCK_SIZE; vertex++) {
+        auto sum = 0.0f;
+
+        for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+            const auto key = block.weights[slot][vertex] * 4 + static_cast<int>(MAX_INFLUENCES - 1 - slot);
+            auto rank = 0;
+
+            for (unsigned other = 0; other < MAX_INFLUENCES; other++) {
+                rank += other != slot && block.weights[other][vertex] * 4 + static_cast<int>(MAX_INFLUENCES - 1 - other) > key;
+            }
+
+            const auto weight = static_cast<float>(block.weights[slot][vertex]);
+            const auto isKept = block.weights[slot][vertex] > 0 && rank < maxInfluences && (rank == 0 || weight >= threshold);
+
+            block.ranks[slot][vertex] = rank;
+            block.kept[slot][vertex] = isKept ? -1 : 0;
+            sum += isKept ? weight : 0.0f;
+        }
+
+        const auto scale = sum > 0.0f ? 255.0f / sum : 0.0f;
+
+        for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+            block.normalized[slot][vertex] = block.kept[slot][vertex] ? static_cast<float>(block.weights[slot][vertex]) * scale : 0.0f;
+        }
+    }
+#endif
+}
+
+///
+/// \brief Quantizes the normalized influences of a vertex and writes them sorted by rank.
+/// \return Number of dropped influences.
+///
+size_t writeVertex(const Block& block, size_t vertex, unsigned char* weights, unsigned char* boneIndices)
+{
+    int quantized[MAX_INFLUENCES] = {};
+    int slotsByRank[MAX_INFLUENCES];
+    auto total = 0;
+    size_t droppedCount = 0;
+
+    fill(slotsByRank, slotsByRank + MAX_INFLUENCES, -1);
+
+    for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+        if (block.kept[slot][vertex]) {
+            quantized[slot] = static_cast<int>(lroundf(block.normalized[slot][vertex]));
+            total += quantized[slot];
+            slotsByRank[block.ranks[slot][vertex]] = static_cast<int>(slot);
+        } else {
+            droppedCount += block.weights[slot][vertex] > 0;
+        }
+    }
+
+    // Vertices without weights are not skinned, keep them as they are.
+    const auto largest = slotsByRank[0];
+    if (largest < 0) {
+        return 0;
+    }
+
+    // The rounding error is fixed so the weights sum up to exactly 255 and stay sorted. A surplus
+    // goes to the largest weight, a deficit is taken from the smallest weights upwards.
+    auto residual = 255 - total;
+    if (residual >= 0) {
+        quantized[largest] += residual;
+    } else {
+        for (auto rank = static_cast<int>(MAX_INFLUENCES) - 1; rank >= 0 && residual < 0; rank--) {
+            if (const auto slot = slotsByRank[rank]; slot >= 0) {
+                const auto taken = min(quantized[slot], -residual);
+                quantized[slot] -= taken;
+                residual += taken;
+            }
+        }
+    }
+
+    unsigned char sortedWeights[MAX_INFLUENCES] = {};
+    unsigned char sortedBoneIndices[MAX_INFLUENCES] = {};
+
+    // Influences which got quantized to zero are dropped, they are the smallest ones.
+    for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+        if (block.kept[slot][vertex] && quantized[slot] > 0) {
+            const auto rank = block.ranks[slot][vertex];
+            sortedWeights[rank] = static_cast<unsigned char>(quantized[slot]);
+            sortedBoneIndices[rank] = boneIndices[slot];
+        } else if (block.kept[slot][vertex]) {
+            droppedCount++;
+        }
+    }
+
+    copy(sortedWeights, sortedWeights + MAX_INFLUENCES, weights);
+    copy(sortedBoneIndices, sortedBoneIndices + MAX_INFLUENCES, boneIndices);
+
+    return droppedCount;
+}
+
+} // namespace
+
+size_t normalize(
+    unsigned char* weights,
+    unsigned char* boneIndices,
+    size_t vertexCount,
+    size_t stride,
+    unsigned maxInfluences,
+    float minWeight)
+{
+    const auto influenceCount = static_cast<int>(clamp(maxInfluences, 1u, MAX_INFLUENCES));
+    const auto threshold = max(minWeight, 0.0f) * 255.0f;
+
+    Block block;
+    size_t droppedCount = 0;
+
+    for (size_t first = 0; first < vertexCount; first += BLOCK_SIZE) {
+        const auto count = min(BLOCK_SIZE, vertexCount - first);
+
+        // Lanes past the last vertex have no weights.
+        for (size_t vertex = 0; vertex < BLOCK_SIZE; vertex++) {
+            for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+                block.weights[slot][vertex] = vertex < count ? weights[(first + vertex) * stride + slot] : 0;
+            }
+        }
+
+        processBlock(block, influenceCount, threshold);
+
+        for (size_t vertex = 0; vertex < count; vertex++) {
+            droppedCount += writeVertex(block, vertex, weights + (first + vertex) * stride, boneIndices + (first + vertex) * stride);
+        }
+    }
+
+    return droppedCount;
+}
+
+vector<BoneInfluences> collectInfluences(
+    const unsigned char* weights,
+    const unsigned char* boneIndices,
+    size_t vertexCount,
+    size_t stride,
+    size_t boneCount)
+{
+    vector<BoneInfluences> influences(boneCount);
+
+    // Count first, so each list is allocated once.
+    vector<size_t> counts(boneCount, 0);
+    for (size_t vertexIndex = 0; vertexIndex < vertexCount; vertexIndex++) {
+        const auto vertexWeights = weights + vertexIndex * stride;
+        const auto vertexBoneIndices = boneIndices + vertexIndex * stride;
+
+        for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+            if (vertexWeights[slot] != 0 && vertexBoneIndices[slot] < boneCount) {
+                counts[vertexBoneIndices[slot]]++;
+            }
+        }
+    }
+
+    for (size_t boneIndex = 0; boneIndex < boneCount; boneIndex++) {
+        influences[boneIndex].vertices.reserve(counts[boneIndex]);
+        influences[boneIndex].weights.reserve(counts[boneIndex]);
+    }
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexCount; vertexIndex++) {
+        const auto vertexWeights = weights + vertexIndex * stride;
+        const auto vertexBoneIndices = boneIndices + vertexIndex * stride;
+
+        for (unsigned slot = 0; slot < MAX_INFLUENCES; slot++) {
+            if (vertexWeights[slot] != 0 && vertexBoneIndices[slot] < boneCount) {
+                auto& boneInfluences = influences[vertexBoneIndices[slot]];
+                boneInfluences.vertices.push_back(static_cast<int>(vertexIndex));
+                boneInfluences.weights.push_back(vertexWeights[slot] / 255.0);
+            }
+        }
+    }
+
+    return influences;
+}
+
+} // namespace GCL::Utilities::SkinWeights
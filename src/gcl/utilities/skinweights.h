@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace GCL::Utilities::SkinWeights {
+
+using namespace std;
+
+///
+/// \brief Number of influences of the vertex layouts, e.g. of GrannyPWNT34322Vertex.
+///
+constexpr unsigned MAX_INFLUENCES = 4;
+
+///
+/// \brief Limits, prunes, renormalizes and quantizes the 8-bit skin weights of vertices.
+///
+/// For each vertex only the maxInfluences largest weights are kept and of those the weights
+/// below minWeight are dropped, except the largest one. The kept weights are sorted by size,
+/// scaled to sum up to exactly 255 and dropped influences get weight and bone index zero.
+/// Influences whose weight gets quantized to zero are dropped as well.
+/// Vertices without any weight are not changed. Four vertices are ranked at once with SSE.
+///
+/// \param weights Four 8-bit weights of the first vertex.
+/// \param boneIndices Four 8-bit bone indices of the first vertex.
+/// \param vertexCount Number of vertices.
+/// \param stride Number of bytes between the weights and the bone indices of consecutive vertices.
+/// \param maxInfluences Maximum number of influences per vertex, at least one.
+/// \param minWeight Minimum weight of an influence, e.g. 0.01 for 1%.
+/// \return Number of dropped influences.
+///
+size_t normalize(
+    unsigned char* weights,
+    unsigned char* boneIndices,
+    size_t vertexCount,
+    size_t stride,
+    unsigned maxInfluences,
+    float minWeight);
+
+///
+/// \brief Vertices influenced by a bone, in ascending order, and their weights.
+///
+struct BoneInfluences {
+    vector<int> vertices;
+    vector<double> weights;
+};
+
+///
+/// \brief Collects the influences of vertices per bone, e.g. for the clusters of a skin.
+///
+/// Influences with weight zero and bone indices of boneCount or above are skipped.
+/// Weights are scaled from 0-255 to 0-1.
+///
+/// \param weights Four 8-bit weights of the first vertex.
+/// \param boneIndices Four 8-bit bone indices of the first vertex.
+/// \param vertexCount Number of vertices.
+/// \param stride Number of bytes between the weights and the bone indices of consecutive vertices.
+/// \param boneCount Number of bones the bone indices refer to.
+/// \return Influences of each bone.
+///
+vector<BoneInfluences> collectInfluences(
+    const unsigned char* weights,
+    const unsigned char* boneIndices,
+    size_t vertexCount,
+    size_t stride,
+    size_t boneCount);
+
+} // namespace GCL::Utilities::SkinWeights
@@ -0,0 +1,92 @@
+#include "gcl/utilities/statistics.h"
+
+#include "gcl/utilities/memory.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace GCL::Utilities {
+
+using namespace std::chrono;
+
+void ConversionStatistics::addStageTime(const string& name, double seconds)
+{
+    auto stage = find_if(stages.begin(), stages.end(), [&name](const StageStatistics& stage) {
+        return stage.name == name;
+    });
+
+    if (stage == stages.end()) {
+        stages.push_back({ name });
+        stage = stages.end() - 1;
+    }
+
+    stage->seconds += seconds;
+    stage->count++;
+}
+
+double ConversionStatistics::getStageSeconds(const string& name) const
+{
+    for (const auto& stage : stages) {
+        if (stage.name == name) {
+            return stage.seconds;
+        }
+    }
+
+    return 0.0;
+}
+
+void ConversionStatistics::updateMemory()
+{
+    currentMemoryBytes = Memory::getCurrentBytes();
+    peakMemoryBytes = max(peakMemoryBytes, Memory::getPeakBytes());
+}
+
+string ConversionStatistics::toString() const
+{
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer),
+        "read %llu bytes, %llu vertices, %llu triangles, %llu bones, %llu keys (%llu emitted), %llu textures, memory %.1f MiB (peak %.1f MiB)",
+        static_cast<unsigned long long>(bytesRead),
+        static_cast<unsigned long long>(vertexCount),
+        static_cast<unsigned long long>(triangleCount),
+        static_cast<unsigned long long>(boneCount),
+        static_cast<unsigned long long>(keyCount),
+        static_cast<unsigned long long>(emittedKeyCount),
+        static_cast<unsigned long long>(textureCount),
+        static_cast<double>(currentMemoryBytes) / (1024.0 * 1024.0),
+        static_cast<double>(peakMemoryBytes) / (1024.0 * 1024.0));
+
+    string text = buffer;
+
+    if (acmrBefore > 0.0) {
+        snprintf(buffer, sizeof(buffer), ", welded %llu vertices, ACMR %.3f -> %.3f",
+            static_cast<unsigned long long>(weldedVertexCount), acmrBefore, acmrAfter);
+        text += buffer;
+    }
+
+    if (prunedInfluenceCount > 0) {
+        snprintf(buffer, sizeof(buffer), ", pruned %llu bone influences", static_cast<unsigned long long>(prunedInfluenceCount));
+        text += buffer;
+    }
+
+    for (const auto& stage : stages) {
+        snprintf(buffer, sizeof(buffer), ", %s %.3f s", stage.name.c_str(), stage.seconds);
+        text += buffer;
+    }
+
+    return text;
+}
+
+ScopedStageTimer::ScopedStageTimer(ConversionStatistics& statistics, const char* name)
+    : m_statistics(statistics)
+    , m_name(name)
+    , m_start(steady_clock::now())
+{
+}
+
+ScopedStageTimer::~ScopedStageTimer()
+{
+    m_statistics.addStageTime(m_name, duration<double>(steady_clock::now() - m_start).count());
+}
+
+} // namespace GCL::Utilities
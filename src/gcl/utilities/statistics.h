@@ -0,0 +1,173 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief Accumulated wall time of a stage of the import or export.
+///
+struct StageStatistics {
+    ///
+    /// \brief Name of the stage, e.g. "importModels".
+    ///
+    string name;
+
+    ///
+    /// \brief Wall time of all runs of the stage in seconds.
+    ///
+    double seconds = 0.0;
+
+    ///
+    /// \brief Number of runs of the stage.
+    ///
+    size_t count = 0;
+};
+
+///
+/// \brief Statistics of an import or export, e.g. to size worker pools or spot pathological assets.
+///
+/// Counters accumulate over all files imported or exported by the same importer or exporter.
+///
+struct ConversionStatistics {
+    ///
+    /// \brief Wall time of the stages in order of their first run.
+    ///
+    vector<StageStatistics> stages;
+
+    ///
+    /// \brief Bytes of the read granny files.
+    ///
+    uint64_t bytesRead = 0;
+
+    ///
+    /// \brief Number of processed vertices of all meshes.
+    ///
+    uint64_t vertexCount = 0;
+
+    ///
+    /// \brief Number of processed triangles of all meshes.
+    ///
+    uint64_t triangleCount = 0;
+
+    ///
+    /// \brief Number of processed bones of all skeletons.
+    ///
+    uint64_t boneCount = 0;
+
+    ///
+    /// \brief Number of processed animation keys.
+    ///
+    uint64_t keyCount = 0;
+
+    ///
+    /// \brief Number of animation keys written to the fbx scene after resampling and reduction.
+    ///
+    uint64_t emittedKeyCount = 0;
+
+    ///
+    /// \brief Number of encoded textures.
+    ///
+    uint64_t textureCount = 0;
+
+    ///
+    /// \brief Number of vertices removed by welding of the mesh optimization.
+    ///
+    uint64_t weldedVertexCount = 0;
+
+    ///
+    /// \brief Number of bone influences removed by the skin weight normalization.
+    ///
+    uint64_t prunedInfluenceCount = 0;
+
+    ///
+    /// \brief Average vertex cache miss ratio of the optimized meshes before the optimization.
+    ///
+    double acmrBefore = 0.0;
+
+    ///
+    /// \brief Average vertex cache miss ratio of the optimized meshes after the optimization.
+    ///
+    double acmrAfter = 0.0;
+
+    ///
+    /// \brief Heap bytes allocated by the process at the end of the last import or export.
+    ///
+    /// Zero unless the library is built with GCL_TRACK_MEMORY, see Memory::isTracking.
+    ///
+    size_t currentMemoryBytes = 0;
+
+    ///
+    /// \brief Maximum of heap bytes allocated by the process at once.
+    ///
+    size_t peakMemoryBytes = 0;
+
+    ///
+    /// \brief Adds wall time to a stage.
+    /// \param name Name of the stage.
+    /// \param seconds Wall time in seconds.
+    ///
+    void addStageTime(const string& name, double seconds);
+
+    ///
+    /// \brief Returns the accumulated wall time of a stage.
+    /// \param name Name of the stage.
+    /// \return Wall time in seconds or zero if the stage did not run.
+    ///
+    double getStageSeconds(const string& name) const;
+
+    ///
+    /// \brief Updates the memory counters with the allocated heap bytes of the process.
+    ///
+    void updateMemory();
+
+    ///
+    /// \brief Returns the statistics as single line text, e.g. to log them.
+    ///
+    string toString() const;
+};
+
+///
+/// \brief Adds the time between its construction and destruction to a stage of statistics.
+///
+class ScopedStageTimer {
+public:
+    ///
+    /// \brief Constructor - starts the timer.
+    /// \param statistics Statistics to add the wall time to.
+    /// \param name Name of the stage.
+    ///
+    ScopedStageTimer(ConversionStatistics& statistics, const char* name);
+
+    ///
+    /// \brief Destructor - adds the elapsed time to the stage.
+    ///
+    ~ScopedStageTimer();
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+protected:
+    ///
+    /// \brief Statistics to add the wall time to.
+    ///
+    ConversionStatistics& m_statistics;
+
+    ///
+    /// \brief Name of the stage.
+    ///
+    const char* m_name = nullptr;
+
+    ///
+    /// \brief Start of the timer.
+    ///
+    chrono::steady_clock::time_point m_start;
+};
+
+} // namespace GCL::Utilities
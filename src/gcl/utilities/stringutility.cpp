@@ -1,5 +1,6 @@
 #include "gcl/utilities/stringutility.h"
 
+#include <cstdio>
 #include <locale>
 
 namespace GCL::Utilities {
@@ -34,4 +35,38 @@ void toLowerFirst(string& input)
     input[0] = tolower(input[0], locale);
 }
 
+string escapeJson(const string& value)
+{
+    string result;
+    result.reserve(value.size());
+
+    for (const auto character : value) {
+        switch (character) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(character) < 0x20) {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+                result += escaped;
+            } else {
+                result += character;
+            }
+            break;
+        }
+    }
+
+    return result;
+}
+
 } // namespace GCL::Utilities
@@ -34,4 +34,11 @@ void toUpperFirst(string& input);
 ///
 void toLowerFirst(string& input);
 
+///
+/// \brief Escapes a string to be written as json string value.
+/// \param value String
+/// \return A string with quotes, backslashes and control characters escaped.
+///
+string escapeJson(const string& value);
+
 } // namespace GCL::Utilities
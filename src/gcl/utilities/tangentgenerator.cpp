@@ -0,0 +1,188 @@
+#include "gcl/utilities/tangentgenerator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace GCL::Utilities::TangentGenerator {
+
+using namespace std;
+
+namespace {
+
+///
+/// \brief Lengths below are treated as zero, like in MikkTSpace.
+///
+constexpr float EPSILON = 1e-20f;
+
+struct Vector3 {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+Vector3 load(const float* values)
+{
+    return { values[0], values[1], values[2] };
+}
+
+Vector3 operator+(const Vector3& a, const Vector3& b)
+{
+    return { a.x + b.x, a.y + b.y, a.z + b.z };
+}
+
+Vector3 operator-(const Vector3& a, const Vector3& b)
+{
+    return { a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+Vector3 operator*(float scale, const Vector3& vector)
+{
+    return { scale * vector.x, scale * vector.y, scale * vector.z };
+}
+
+float dot(const Vector3& a, const Vector3& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+///
+/// \brief Returns the normalized vector or the zero vector if it has no length.
+///
+Vector3 normalize(const Vector3& vector)
+{
+    const auto length = sqrtf(dot(vector, vector));
+    return length > EPSILON ? (1.0f / length) * vector : Vector3();
+}
+
+///
+/// \brief Projects a vector onto the plane of a normal and normalizes it.
+///
+Vector3 project(const Vector3& normal, const Vector3& vector)
+{
+    return normalize(vector - dot(normal, vector) * normal);
+}
+
+///
+/// \brief Returns a normalized vector perpendicular to a normal.
+///
+Vector3 perpendicular(const Vector3& normal)
+{
+    const auto axis = fabsf(normal.x) < 0.9f ? Vector3 { 1.0f, 0.0f, 0.0f } : Vector3 { 0.0f, 1.0f, 0.0f };
+    const auto tangent = project(normal, axis);
+    return dot(tangent, tangent) > 0.0f ? tangent : axis;
+}
+
+///
+/// \brief Angle weighted tangents of the triangles of a vertex, per uv orientation.
+///
+struct Accumulator {
+    Vector3 tangents[2];
+    float weights[2] = { 0.0f, 0.0f };
+};
+
+} // namespace
+
+void generate(
+    const float* positions,
+    const float* normals,
+    const float* uvs,
+    size_t vertexCount,
+    size_t stride,
+    const unsigned* indices,
+    size_t indexCount,
+    vector<float>& tangents)
+{
+    const auto attribute = [stride](const float* first, size_t vertex) {
+        return reinterpret_cast<const float*>(reinterpret_cast<const unsigned char*>(first) + vertex * stride);
+    };
+
+    const auto triangleCount = indexCount / 3;
+
+    vector<Accumulator> accumulators(vertexCount);
+
+    // Uv orientation of each triangle, 0 if preserving, 1 if mirrored, -1 without uv area.
+    vector<signed char> triangleSides(triangleCount, -1);
+
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        const auto i = triangle * 3;
+        const unsigned corners[3] = { indices[i], indices[i + 1], indices[i + 2] };
+        if (corners[0] >= vertexCount || corners[1] >= vertexCount || corners[2] >= vertexCount) {
+            continue;
+        }
+
+        const Vector3 points[3] = { load(attribute(positions, corners[0])), load(attribute(positions, corners[1])), load(attribute(positions, corners[2])) };
+        const auto uv0 = attribute(uvs, corners[0]);
+        const auto uv1 = attribute(uvs, corners[1]);
+        const auto uv2 = attribute(uvs, corners[2]);
+
+        const auto d1 = points[1] - points[0];
+        const auto d2 = points[2] - points[0];
+        const auto t21x = uv1[0] - uv0[0];
+        const auto t21y = uv1[1] - uv0[1];
+        const auto t31x = uv2[0] - uv0[0];
+        const auto t31y = uv2[1] - uv0[1];
+
+        // Triangles without uv area have no tangent, their corners take it from their neighbours.
+        const auto signedArea = t21x * t31y - t21y * t31x;
+        if (fabsf(signedArea) <= EPSILON) {
+            continue;
+        }
+
+        const auto isOrientationPreserving = signedArea > 0.0f;
+        auto triangleTangent = normalize(t31y * d1 - t21y * d2);
+        if (!isOrientationPreserving) {
+            triangleTangent = -1.0f * triangleTangent;
+        }
+
+        const auto side = isOrientationPreserving ? 0 : 1;
+        triangleSides[triangle] = static_cast<signed char>(side);
+
+        for (auto corner = 0; corner < 3; corner++) {
+            const auto vertex = corners[corner];
+            const auto normal = load(attribute(normals, vertex));
+
+            const auto tangent = project(normal, triangleTangent);
+            const auto edge1 = project(normal, points[(corner + 1) % 3] - points[corner]);
+            const auto edge2 = project(normal, points[(corner + 2) % 3] - points[corner]);
+            const auto angle = acosf(clamp(dot(edge1, edge2), -1.0f, 1.0f));
+
+            auto& accumulator = accumulators[vertex];
+            accumulator.tangents[side] = accumulator.tangents[side] + angle * tangent;
+            accumulator.weights[side] += angle;
+        }
+    }
+
+    tangents.resize(triangleCount * 3 * 4);
+
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        for (size_t corner = 0; corner < 3; corner++) {
+            const auto vertex = indices[triangle * 3 + corner];
+            const auto cornerTangent = &tangents[(triangle * 3 + corner) * 4];
+
+            if (vertex >= vertexCount) {
+                fill(cornerTangent, cornerTangent + 4, 0.0f);
+                cornerTangent[0] = 1.0f;
+                cornerTangent[3] = 1.0f;
+                continue;
+            }
+
+            const auto& accumulator = accumulators[vertex];
+            auto side = static_cast<int>(triangleSides[triangle]);
+            if (side < 0) {
+                side = accumulator.weights[1] > accumulator.weights[0] ? 1 : 0;
+            }
+
+            auto tangent = normalize(accumulator.tangents[side]);
+            if (dot(tangent, tangent) == 0.0f) {
+                tangent = perpendicular(normalize(load(attribute(normals, vertex))));
+            }
+
+            cornerTangent[0] = tangent.x;
+            cornerTangent[1] = tangent.y;
+            cornerTangent[2] = tangent.z;
+            cornerTangent[3] = side == 0 ? 1.0f : -1.0f;
+        }
+    }
+}
+
+} // namespace GCL::Utilities::TangentGenerator
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace GCL::Utilities::TangentGenerator {
+
+using namespace std;
+
+///
+/// \brief Generates per triangle corner tangents compatible to MikkTSpace.
+///
+/// Like MikkTSpace, the tangent of each triangle is projected onto the tangent plane of the
+/// vertex normal and weighted by the corner angle. Vertices are identified by their index,
+/// so vertices at uv seams or hard edges are expected to be split already. Like MikkTSpace,
+/// a vertex shared by triangles with and without mirrored uvs is split by the uv orientation,
+/// each corner gets the tangent and bitangent sign of the triangles of its own orientation.
+/// Corners of triangles without uv area take the orientation with more weight at their vertex,
+/// or an arbitrary tangent perpendicular to their normal if there is none.
+///
+/// \param positions Position of the first vertex, three floats.
+/// \param normals Normal of the first vertex, three floats.
+/// \param uvs Texture coordinates of the first vertex, two floats.
+/// \param vertexCount Number of vertices.
+/// \param stride Number of bytes between the attributes of consecutive vertices.
+/// \param indices Triangle list indices.
+/// \param indexCount Number of indices, a multiple of three.
+/// \param tangents Receives four floats per triangle corner in index order, the tangent and the bitangent sign.
+///
+void generate(
+    const float* positions,
+    const float* normals,
+    const float* uvs,
+    size_t vertexCount,
+    size_t stride,
+    const unsigned* indices,
+    size_t indexCount,
+    vector<float>& tangents);
+
+} // namespace GCL::Utilities::TangentGenerator
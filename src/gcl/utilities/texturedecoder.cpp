@@ -0,0 +1,410 @@
+#include "gcl/utilities/texturedecoder.h"
+
+#include "gcl/utilities/logging.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GCL_TEXTURE_DECODER_SSE2
+#endif
+
+namespace GCL::Utilities {
+
+using namespace GCL::Utilities::Logging;
+
+namespace {
+
+///
+/// \brief Extraction of a pixel component from a pixel of a granny pixel layout.
+///
+struct PixelComponent {
+    int shift = 0;
+    int bits = 0;
+    unsigned mask = 0;
+};
+
+///
+/// \brief Prepares the extraction of the four pixel components (R, G, B, A) of a pixel layout.
+///
+/// Components wider than 8 bits are reduced to their 8 most significant bits.
+///
+void preparePixelComponents(const GrannyPixelLayout& layout, PixelComponent components[4])
+{
+    for (unsigned i = 0; i < 4; i++) {
+        auto& component = components[i];
+        component.shift = layout.ShiftForComponent[i];
+        component.bits = layout.BitsForComponent[i];
+
+        if (component.bits > 8) {
+            component.shift += component.bits - 8;
+            component.bits = 8;
+        }
+
+        component.mask = component.bits > 0 ? (1u << component.bits) - 1 : 0;
+    }
+}
+
+///
+/// \brief Expands a component of n bits to 8 bits by bit replication.
+///
+unsigned expandComponent(unsigned value, int bits)
+{
+    auto expanded = value << (8 - bits);
+
+    for (auto shift = bits; shift < 8; shift *= 2) {
+        expanded |= expanded >> shift;
+    }
+
+    return expanded & 0xff;
+}
+
+///
+/// \brief Converts a single pixel to a RGBA value (R in the lowest byte).
+///
+unsigned convertPixel(unsigned pixel, const PixelComponent components[4])
+{
+    unsigned rgba = 0;
+
+    for (unsigned i = 0; i < 4; i++) {
+        const auto& component = components[i];
+
+        // Missing color components are black, a missing alpha component is opaque.
+        unsigned value = i == 3 ? 0xff : 0;
+        if (component.bits) {
+            value = expandComponent((pixel >> component.shift) & component.mask, component.bits);
+        }
+
+        rgba |= value << (i * 8);
+    }
+
+    return rgba;
+}
+
+///
+/// \brief Reads a little endian pixel of 1 to 4 bytes.
+///
+unsigned readPixel(const unsigned char* source, int bytesPerPixel)
+{
+    unsigned pixel = 0;
+
+    for (auto i = 0; i < bytesPerPixel; i++) {
+        pixel |= static_cast<unsigned>(source[i]) << (i * 8);
+    }
+
+    return pixel;
+}
+
+#ifdef GCL_TEXTURE_DECODER_SSE2
+
+///
+/// \brief Converts four pixels stored in 32 bit lanes to RGBA values.
+///
+__m128i convertPixels4(__m128i pixels, const PixelComponent components[4])
+{
+    auto rgba = _mm_setzero_si128();
+
+    for (unsigned i = 0; i < 4; i++) {
+        const auto& component = components[i];
+
+        __m128i value;
+        if (component.bits) {
+            value = _mm_srl_epi32(pixels, _mm_cvtsi32_si128(component.shift));
+            value = _mm_and_si128(value, _mm_set1_epi32(static_cast<int>(component.mask)));
+            value = _mm_sll_epi32(value, _mm_cvtsi32_si128(8 - component.bits));
+
+            for (auto shift = component.bits; shift < 8; shift *= 2) {
+                value = _mm_or_si128(value, _mm_srl_epi32(value, _mm_cvtsi32_si128(shift)));
+            }
+
+            value = _mm_and_si128(value, _mm_set1_epi32(0xff));
+        } else {
+            value = _mm_set1_epi32(i == 3 ? 0xff : 0);
+        }
+
+        rgba = _mm_or_si128(rgba, _mm_sll_epi32(value, _mm_cvtsi32_si128(static_cast<int>(i * 8))));
+    }
+
+    return rgba;
+}
+
+#endif
+
+///
+/// \brief Expands a 565 color to 8 bit RGB components.
+///
+void expandColor565(unsigned color, unsigned char rgb[3])
+{
+    rgb[0] = static_cast<unsigned char>(expandComponent((color >> 11) & 0x1f, 5));
+    rgb[1] = static_cast<unsigned char>(expandComponent((color >> 5) & 0x3f, 6));
+    rgb[2] = static_cast<unsigned char>(expandComponent(color & 0x1f, 5));
+}
+
+///
+/// \brief Decodes the color part of a S3TC block to 16 RGBA pixels.
+///
+void decodeColorBlock(const unsigned char* block, bool allowTransparent, unsigned char pixels[16][4])
+{
+    const unsigned color0 = block[0] | (block[1] << 8);
+    const unsigned color1 = block[2] | (block[3] << 8);
+    const unsigned indices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<unsigned>(block[7]) << 24);
+
+    unsigned char palette[4][4];
+    expandColor565(color0, palette[0]);
+    expandColor565(color1, palette[1]);
+    palette[0][3] = palette[1][3] = 0xff;
+
+    if (color0 > color1 || !allowTransparent) {
+        for (unsigned i = 0; i < 3; i++) {
+            palette[2][i] = static_cast<unsigned char>((2 * palette[0][i] + palette[1][i] + 1) / 3);
+            palette[3][i] = static_cast<unsigned char>((palette[0][i] + 2 * palette[1][i] + 1) / 3);
+        }
+        palette[2][3] = palette[3][3] = 0xff;
+    } else {
+        for (unsigned i = 0; i < 3; i++) {
+            palette[2][i] = static_cast<unsigned char>((palette[0][i] + palette[1][i]) / 2);
+            palette[3][i] = 0;
+        }
+        palette[2][3] = 0xff;
+        palette[3][3] = 0;
+    }
+
+    for (unsigned i = 0; i < 16; i++) {
+        memcpy(pixels[i], palette[(indices >> (i * 2)) & 0x3], 4);
+    }
+}
+
+///
+/// \brief Decodes the explicit alpha part of a DXT3 block.
+///
+void decodeExplicitAlphaBlock(const unsigned char* block, unsigned char pixels[16][4])
+{
+    for (unsigned i = 0; i < 16; i++) {
+        const unsigned alpha = (block[i / 2] >> ((i % 2) * 4)) & 0xf;
+        pixels[i][3] = static_cast<unsigned char>(alpha * 17);
+    }
+}
+
+///
+/// \brief Decodes the interpolated alpha part of a DXT5 block.
+///
+void decodeInterpolatedAlphaBlock(const unsigned char* block, unsigned char pixels[16][4])
+{
+    const unsigned alpha0 = block[0];
+    const unsigned alpha1 = block[1];
+
+    unsigned palette[8] = { alpha0, alpha1 };
+
+    if (alpha0 > alpha1) {
+        for (unsigned i = 1; i < 7; i++) {
+            palette[i + 1] = ((7 - i) * alpha0 + i * alpha1 + 3) / 7;
+        }
+    } else {
+        for (unsigned i = 1; i < 5; i++) {
+            palette[i + 1] = ((5 - i) * alpha0 + i * alpha1 + 2) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 0xff;
+    }
+
+    unsigned long long indices = 0;
+    for (unsigned i = 0; i < 6; i++) {
+        indices |= static_cast<unsigned long long>(block[2 + i]) << (i * 8);
+    }
+
+    for (unsigned i = 0; i < 16; i++) {
+        pixels[i][3] = static_cast<unsigned char>(palette[(indices >> (i * 3)) & 0x7]);
+    }
+}
+
+///
+/// \brief Returns the size of the pixel bytes required for a mip level.
+///
+size_t requiredMipLevelSize(const GrannyTexture* grannyTexture, int width, int height, int stride)
+{
+    if (grannyTexture->Encoding == GrannyS3TCTextureEncoding) {
+        const auto blockSize = grannyTexture->SubFormat < GrannyS3TCBGRA8888MappedAlpha ? 8 : 16;
+        return static_cast<size_t>((width + 3) / 4) * static_cast<size_t>((height + 3) / 4) * static_cast<size_t>(blockSize);
+    }
+
+    return static_cast<size_t>(stride) * static_cast<size_t>(height - 1)
+        + static_cast<size_t>(width) * static_cast<size_t>(grannyTexture->Layout.BytesPerPixel);
+}
+
+} // namespace
+
+bool textureHasAlpha(const GrannyTexture* grannyTexture)
+{
+    switch (grannyTexture->Encoding) {
+    case GrannyRawTextureEncoding:
+        return grannyTexture->Layout.BitsForComponent[3] > 0;
+    case GrannyS3TCTextureEncoding:
+        return grannyTexture->SubFormat != GrannyS3TCBGR565;
+    default:
+        return GrannyTextureHasAlpha(grannyTexture);
+    }
+}
+
+bool decodeTextureImage(const GrannyTexture* grannyTexture, int imageIndex, int mipIndex, DecodedImage& image)
+{
+    if (imageIndex < 0 || imageIndex >= grannyTexture->ImageCount) {
+        return false;
+    }
+
+    const auto& grannyImage = grannyTexture->Images[imageIndex];
+    if (mipIndex < 0 || mipIndex >= grannyImage.MIPLevelCount) {
+        return false;
+    }
+
+    image.width = max(1, grannyTexture->Width >> mipIndex);
+    image.height = max(1, grannyTexture->Height >> mipIndex);
+    image.pixels.resize(static_cast<size_t>(image.width) * static_cast<size_t>(image.height) * 4);
+
+    const auto& mipLevel = grannyImage.MIPLevels[mipIndex];
+    const auto source = static_cast<const unsigned char*>(mipLevel.PixelBytes);
+
+    const auto stride = mipLevel.Stride > 0 ? mipLevel.Stride : image.width * grannyTexture->Layout.BytesPerPixel;
+    const auto isEncodedInTree = grannyTexture->Encoding == GrannyRawTextureEncoding
+        || grannyTexture->Encoding == GrannyS3TCTextureEncoding;
+
+    if (isEncodedInTree
+        && (!source || static_cast<size_t>(mipLevel.PixelByteCount) < requiredMipLevelSize(grannyTexture, image.width, image.height, stride))) {
+        warning("Skip decoding texture \"%s\" because mip level %d is truncated.", grannyTexture->FromFileName, mipIndex);
+        return false;
+    }
+
+    switch (grannyTexture->Encoding) {
+    case GrannyRawTextureEncoding:
+        if (grannyTexture->Layout.BytesPerPixel < 1 || grannyTexture->Layout.BytesPerPixel > 4) {
+            return false;
+        }
+        convertPixels(source, stride, grannyTexture->Layout, image.width, image.height, image.pixels.data());
+        return true;
+    case GrannyS3TCTextureEncoding:
+        decodeS3TC(source, static_cast<GrannyS3TCTextureFormat>(grannyTexture->SubFormat), image.width, image.height, image.pixels.data());
+        return true;
+    default:
+        // Bink and user encodings are proprietary - let the granny library decode them.
+        GrannyCopyTextureImage(
+            grannyTexture,
+            imageIndex,
+            mipIndex,
+            GrannyRGBA8888PixelFormat,
+            image.width,
+            image.height,
+            image.width * 4,
+            image.pixels.data());
+        return true;
+    }
+}
+
+vector<DecodedImage> decodeTextureMipLevels(const GrannyTexture* grannyTexture, int imageIndex)
+{
+    vector<DecodedImage> mipLevels;
+
+    if (imageIndex < 0 || imageIndex >= grannyTexture->ImageCount) {
+        return mipLevels;
+    }
+
+    const auto mipLevelCount = grannyTexture->Images[imageIndex].MIPLevelCount;
+    mipLevels.resize(static_cast<size_t>(max(0, mipLevelCount)));
+
+    for (auto mipIndex = 0; mipIndex < mipLevelCount; mipIndex++) {
+        if (!decodeTextureImage(grannyTexture, imageIndex, mipIndex, mipLevels[static_cast<size_t>(mipIndex)])) {
+            mipLevels.resize(static_cast<size_t>(mipIndex));
+            break;
+        }
+    }
+
+    return mipLevels;
+}
+
+void convertPixels(
+    const unsigned char* source,
+    int sourceStride,
+    const GrannyPixelLayout& layout,
+    int width,
+    int height,
+    unsigned char* destination)
+{
+    PixelComponent components[4];
+    preparePixelComponents(layout, components);
+
+    const auto bytesPerPixel = layout.BytesPerPixel;
+
+    for (auto y = 0; y < height; y++) {
+        const auto sourceRow = source + static_cast<size_t>(y) * static_cast<size_t>(sourceStride);
+        const auto destinationRow = destination + static_cast<size_t>(y) * static_cast<size_t>(width) * 4;
+
+        auto x = 0;
+
+#ifdef GCL_TEXTURE_DECODER_SSE2
+        // Convert four pixels at once for 32 bit and 16 bit pixel layouts.
+        if (bytesPerPixel == 4) {
+            for (; x + 4 <= width; x += 4) {
+                const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sourceRow + x * 4));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destinationRow + x * 4), convertPixels4(pixels, components));
+            }
+        } else if (bytesPerPixel == 2) {
+            for (; x + 4 <= width; x += 4) {
+                auto pixels = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(sourceRow + x * 2));
+                pixels = _mm_unpacklo_epi16(pixels, _mm_setzero_si128());
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destinationRow + x * 4), convertPixels4(pixels, components));
+            }
+        }
+#endif
+
+        for (; x < width; x++) {
+            const auto rgba = convertPixel(readPixel(sourceRow + x * bytesPerPixel, bytesPerPixel), components);
+            destinationRow[x * 4] = static_cast<unsigned char>(rgba);
+            destinationRow[x * 4 + 1] = static_cast<unsigned char>(rgba >> 8);
+            destinationRow[x * 4 + 2] = static_cast<unsigned char>(rgba >> 16);
+            destinationRow[x * 4 + 3] = static_cast<unsigned char>(rgba >> 24);
+        }
+    }
+}
+
+void decodeS3TC(
+    const unsigned char* source,
+    GrannyS3TCTextureFormat format,
+    int width,
+    int height,
+    unsigned char* destination)
+{
+    const auto blockSize = format < GrannyS3TCBGRA8888MappedAlpha ? 8 : 16;
+    const auto blocksPerRow = (width + 3) / 4;
+    const auto blocksPerColumn = (height + 3) / 4;
+
+    unsigned char pixels[16][4];
+
+    for (auto blockY = 0; blockY < blocksPerColumn; blockY++) {
+        for (auto blockX = 0; blockX < blocksPerRow; blockX++) {
+            const auto block = source + (static_cast<size_t>(blockY) * static_cast<size_t>(blocksPerRow) + static_cast<size_t>(blockX)) * static_cast<size_t>(blockSize);
+
+            switch (format) {
+            case GrannyS3TCBGRA8888MappedAlpha:
+                decodeColorBlock(block + 8, false, pixels);
+                decodeExplicitAlphaBlock(block, pixels);
+                break;
+            case GrannyS3TCBGRA8888InterpolatedAlpha:
+                decodeColorBlock(block + 8, false, pixels);
+                decodeInterpolatedAlphaBlock(block, pixels);
+                break;
+            default:
+                decodeColorBlock(block, true, pixels);
+                break;
+            }
+
+            // Copy the block pixels and clip blocks at the right and bottom border.
+            for (auto y = 0; y < 4 && blockY * 4 + y < height; y++) {
+                for (auto x = 0; x < 4 && blockX * 4 + x < width; x++) {
+                    const auto offset = (static_cast<size_t>(blockY * 4 + y) * static_cast<size_t>(width) + static_cast<size_t>(blockX * 4 + x)) * 4;
+                    memcpy(destination + offset, pixels[y * 4 + x], 4);
+                }
+            }
+        }
+    }
+}
+
+} // namespace GCL::Utilities
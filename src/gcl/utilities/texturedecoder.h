@@ -0,0 +1,92 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+
+#include <vector>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief Stores a decoded image with 8 bit RGBA pixels.
+///
+struct DecodedImage {
+    ///
+    /// \brief Width of the image in pixels.
+    ///
+    int width = 0;
+
+    ///
+    /// \brief Height of the image in pixels.
+    ///
+    int height = 0;
+
+    ///
+    /// \brief Pixels of the image stored row by row as R, G, B, A bytes.
+    ///
+    vector<unsigned char> pixels;
+};
+
+///
+/// \brief Returns if a granny texture has an alpha channel.
+/// \param grannyTexture Granny texture
+/// \return Returns whether the texture encoding stores alpha or not.
+///
+bool textureHasAlpha(const GrannyTexture* grannyTexture);
+
+///
+/// \brief Decodes a mip level of a granny texture image to 8 bit RGBA pixels.
+///
+/// Raw and S3TC encoded textures are decoded in-tree. Bink encoded textures are
+/// decoded by the granny library.
+///
+/// \param grannyTexture Granny texture
+/// \param imageIndex Index of the image, e.g. the face of a cube map.
+/// \param mipIndex Index of the mip level.
+/// \param image Decoded image
+/// \return Returns whether the mip level could be decoded.
+///
+bool decodeTextureImage(const GrannyTexture* grannyTexture, int imageIndex, int mipIndex, DecodedImage& image);
+
+///
+/// \brief Decodes all mip levels of a granny texture image to 8 bit RGBA pixels.
+/// \param grannyTexture Granny texture
+/// \param imageIndex Index of the image, e.g. the face of a cube map.
+/// \return Decoded mip levels beginning with the largest one.
+///
+vector<DecodedImage> decodeTextureMipLevels(const GrannyTexture* grannyTexture, int imageIndex = 0);
+
+///
+/// \brief Converts pixels of any granny pixel layout to 8 bit RGBA pixels.
+/// \param source Source pixels
+/// \param sourceStride Bytes per row of the source pixels.
+/// \param layout Pixel layout of the source pixels.
+/// \param width Width in pixels.
+/// \param height Height in pixels.
+/// \param destination Destination pixels with a stride of 4 * width bytes.
+///
+void convertPixels(
+    const unsigned char* source,
+    int sourceStride,
+    const GrannyPixelLayout& layout,
+    int width,
+    int height,
+    unsigned char* destination);
+
+///
+/// \brief Decodes S3TC (DXT1, DXT3, DXT5) blocks to 8 bit RGBA pixels.
+/// \param source Source blocks
+/// \param format S3TC sub format of the source blocks.
+/// \param width Width in pixels.
+/// \param height Height in pixels.
+/// \param destination Destination pixels with a stride of 4 * width bytes.
+///
+void decodeS3TC(
+    const unsigned char* source,
+    GrannyS3TCTextureFormat format,
+    int width,
+    int height,
+    unsigned char* destination);
+
+} // namespace GCL::Utilities
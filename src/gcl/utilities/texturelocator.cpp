@@ -0,0 +1,199 @@
+#include "gcl/utilities/texturelocator.h"
+
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/stringutility.h"
+
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+
+namespace GCL::Utilities {
+
+using namespace GCL::Utilities::Logging;
+
+string TextureLocator::find(const string& fileName, const string& searchRoot, SearchDepth depth)
+{
+    lock_guard<mutex> lockGuard(m_mutex);
+
+    const auto key = IndexKey(filesystem::path(searchRoot).lexically_normal().u8string(), depth);
+
+    auto index = m_indexes.find(key);
+    if (index == m_indexes.end()) {
+        index = m_indexes.emplace(key, buildIndex(key.first, depth)).first;
+        m_scannedRoots.insert(key);
+    }
+
+    const auto normalizedFileName = normalizeFileName(fileName);
+    auto entry = index->second.find(normalizedFileName);
+
+    // A persisted index may miss files added since, or list files which were removed.
+    error_code errorCode;
+    if (entry == index->second.end() || !filesystem::is_regular_file(filesystem::u8path(entry->second), errorCode)) {
+        if (!rescan(key, index->second)) {
+            return "";
+        }
+
+        entry = index->second.find(normalizedFileName);
+        if (entry == index->second.end()) {
+            return "";
+        }
+    }
+
+    return entry->second;
+}
+
+void TextureLocator::clear()
+{
+    lock_guard<mutex> lockGuard(m_mutex);
+    m_indexes.clear();
+    m_scannedRoots.clear();
+}
+
+bool TextureLocator::loadIndex(const string& indexFilePath)
+{
+    ifstream indexFile(indexFilePath);
+    if (!indexFile) {
+        return false;
+    }
+
+    // Each search root starts with "R <depth> <root>" followed by its "F <name> <path>" entries.
+    map<IndexKey, Index> indexes;
+    Index* index = nullptr;
+    string line;
+    while (getline(indexFile, line)) {
+        if (line.size() < 4 || line[1] != '\t') {
+            continue;
+        }
+
+        const auto separator = line.find('\t', 2);
+        if (separator == string::npos) {
+            continue;
+        }
+
+        const auto first = line.substr(2, separator - 2);
+        const auto second = line.substr(separator + 1);
+
+        if (line[0] == 'R') {
+            int depth = 0;
+            const auto result = from_chars(first.data(), first.data() + first.size(), depth);
+            if (result.ec != errc() || result.ptr != first.data() + first.size()
+                || depth < static_cast<int>(SearchDepth::Directory) || depth > static_cast<int>(SearchDepth::Recursive)) {
+                warning("Discard corrupt texture index \"%s\".", indexFilePath.c_str());
+                return false;
+            }
+
+            index = &indexes[IndexKey(second, static_cast<SearchDepth>(depth))];
+        } else if (line[0] == 'F' && index) {
+            index->emplace(first, second);
+        }
+    }
+
+    lock_guard<mutex> lockGuard(m_mutex);
+
+    // Roots indexed in this run are newer than the persisted ones.
+    for (auto& persistedIndex : indexes) {
+        m_indexes.emplace(persistedIndex.first, move(persistedIndex.second));
+    }
+
+    info("Loaded texture index \"%s\" with %u search roots.", indexFilePath.c_str(), static_cast<unsigned>(indexes.size()));
+
+    return true;
+}
+
+bool TextureLocator::saveIndex(const string& indexFilePath)
+{
+    ofstream indexFile(indexFilePath, ios::trunc);
+    if (!indexFile) {
+        warning("Could not save texture index \"%s\".", indexFilePath.c_str());
+        return false;
+    }
+
+    lock_guard<mutex> lockGuard(m_mutex);
+
+    for (const auto& index : m_indexes) {
+        indexFile << "R\t" << static_cast<int>(index.first.second) << "\t" << index.first.first << "\n";
+
+        for (const auto& entry : index.second) {
+            indexFile << "F\t" << entry.first << "\t" << entry.second << "\n";
+        }
+    }
+
+    return static_cast<bool>(indexFile);
+}
+
+TextureLocator::Index TextureLocator::buildIndex(const string& searchRoot, SearchDepth depth)
+{
+    Index index;
+    error_code errorCode;
+
+    const auto rootPath = filesystem::u8path(searchRoot);
+    if (!filesystem::is_directory(rootPath, errorCode)) {
+        return index;
+    }
+
+    debug("Build texture index of search root \"%s\".", searchRoot.c_str());
+
+    const auto options = filesystem::directory_options::skip_permission_denied;
+
+    // The first found file wins, like a directory walk stopping at the first match.
+    const auto addFile = [&index](const filesystem::directory_entry& entry) {
+        error_code errorCode;
+        if (entry.is_regular_file(errorCode)) {
+            index.emplace(normalizeFileName(entry.path().filename().u8string()), entry.path().u8string());
+        }
+    };
+
+    if (depth == SearchDepth::Recursive) {
+        for (auto entry = filesystem::recursive_directory_iterator(rootPath, options, errorCode);
+             entry != filesystem::recursive_directory_iterator();
+             entry.increment(errorCode)) {
+            if (errorCode) {
+                break;
+            }
+            addFile(*entry);
+        }
+
+        return index;
+    }
+
+    for (auto entry = filesystem::directory_iterator(rootPath, options, errorCode);
+         entry != filesystem::directory_iterator();
+         entry.increment(errorCode)) {
+        if (errorCode) {
+            break;
+        }
+
+        addFile(*entry);
+
+        if (depth == SearchDepth::Subdirectories && entry->is_directory(errorCode)) {
+            error_code subErrorCode;
+            for (auto subEntry = filesystem::directory_iterator(entry->path(), options, subErrorCode);
+                 !subErrorCode && subEntry != filesystem::directory_iterator();
+                 subEntry.increment(subErrorCode)) {
+                addFile(*subEntry);
+            }
+        }
+    }
+
+    return index;
+}
+
+bool TextureLocator::rescan(const IndexKey& key, Index& index)
+{
+    if (!m_scannedRoots.insert(key).second) {
+        return false;
+    }
+
+    debug("Rebuild outdated texture index of search root \"%s\".", key.first.c_str());
+    index = buildIndex(key.first, key.second);
+
+    return true;
+}
+
+string TextureLocator::normalizeFileName(string fileName)
+{
+    toLower(fileName);
+    return fileName;
+}
+
+} // namespace GCL::Utilities
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief Locates texture files by their file name in indexed search roots.
+///
+/// Each search root is walked only once and stored as a file name to file path index.
+/// The index is shared by all materials and imports using the same locator and can be
+/// persisted between runs with saveIndex and loadIndex. A search root is walked again at
+/// most once per run if a texture is missing from its index or an indexed file vanished.
+///
+class TextureLocator {
+public:
+    ///
+    /// \brief Shared pointer alias
+    ///
+    using SharedPtr = shared_ptr<TextureLocator>;
+
+    ///
+    /// \brief Depth of a search root.
+    ///
+    enum class SearchDepth {
+        // Files directly in the search root.
+        Directory,
+        // Files in the search root and its direct subdirectories.
+        Subdirectories,
+        // Files in the search root and all its subdirectories.
+        Recursive
+    };
+
+    ///
+    /// \brief Looks up a texture file in a search root.
+    /// \param fileName File name of the texture without path.
+    /// \param searchRoot Directory to look up the texture in.
+    /// \param depth Depth of the search root.
+    /// \return Path of the texture file or an empty string if it was not found.
+    ///
+    string find(const string& fileName, const string& searchRoot, SearchDepth depth);
+
+    ///
+    /// \brief Drops all indexed search roots.
+    ///
+    void clear();
+
+    ///
+    /// \brief Loads a persisted index. Already indexed search roots are kept.
+    /// \param indexFilePath File path of the persisted index.
+    /// \return Returns whether the index was loaded.
+    ///
+    bool loadIndex(const string& indexFilePath);
+
+    ///
+    /// \brief Persists the index of all indexed search roots.
+    /// \param indexFilePath File path of the persisted index.
+    /// \return Returns whether the index was saved.
+    ///
+    bool saveIndex(const string& indexFilePath);
+
+protected:
+    ///
+    /// \brief File name to file path index of a search root.
+    ///
+    using Index = unordered_map<string, string>;
+
+    ///
+    /// \brief Key of an indexed search root.
+    ///
+    using IndexKey = pair<string, SearchDepth>;
+
+    ///
+    /// \brief Builds the index of a search root by walking its directory tree once.
+    /// \param searchRoot Search root
+    /// \param depth Depth of the search root.
+    /// \return Index of the search root.
+    ///
+    static Index buildIndex(const string& searchRoot, SearchDepth depth);
+
+    ///
+    /// \brief Walks a search root again unless it was already walked in this run.
+    /// \param key Key of the search root.
+    /// \param index Index of the search root which gets replaced.
+    /// \return Returns whether the index was rebuilt.
+    ///
+    bool rescan(const IndexKey& key, Index& index);
+
+    ///
+    /// \brief Normalizes a file name to be used as index key.
+    /// \param fileName File name
+    /// \return Lower case file name.
+    ///
+    static string normalizeFileName(string fileName);
+
+protected:
+    ///
+    /// \brief Indexes stored by search root and depth.
+    ///
+    map<IndexKey, Index> m_indexes;
+
+    ///
+    /// \brief Search roots walked in this run, their indexes are up to date.
+    ///
+    set<IndexKey> m_scannedRoots;
+
+    ///
+    /// \brief Guards the indexes if a locator is shared between threads.
+    ///
+    mutex m_mutex;
+};
+
+} // namespace GCL::Utilities
@@ -0,0 +1,119 @@
+#include "gcl/utilities/texturepipeline.h"
+
+#include "gcl/utilities/devilimageutility.h"
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/stringutility.h"
+#include "gcl/utilities/textureutility.h"
+#include "gcl/utilities/tracing.h"
+
+#include <filesystem>
+
+namespace GCL::Utilities {
+
+using namespace GCL::Utilities::Logging;
+
+TexturePipeline::TexturePipeline(unsigned threadCount)
+    : m_threadPool(threadCount, "texture")
+{
+}
+
+TexturePipeline::~TexturePipeline()
+{
+    wait();
+}
+
+string TexturePipeline::convertImage(const string& sourceFilePath, const string& targetDirectory, const string& targetFileName, bool flipImage)
+{
+    auto sourceKey = filesystem::u8path(sourceFilePath).lexically_normal().u8string();
+    toLower(sourceKey);
+
+    return enqueue("file:" + sourceKey, targetDirectory, targetFileName, [sourceFilePath, flipImage](const string& targetFilePath) {
+        GCL::Utilities::convertImage(sourceFilePath, targetFilePath, flipImage);
+    });
+}
+
+string TexturePipeline::exportTexture(shared_ptr<GrannyTexture> grannyTexture, const string& targetDirectory, const string& targetFileName, bool flipImage)
+{
+    const auto sourceKey = "texture:" + to_string(hashTexture(grannyTexture.get()));
+
+    return enqueue(sourceKey, targetDirectory, targetFileName, [grannyTexture, flipImage](const string& targetFilePath) {
+        GCL::Utilities::exportTexture(grannyTexture.get(), targetFilePath, flipImage);
+    });
+}
+
+void TexturePipeline::wait()
+{
+    vector<future<void>> jobs;
+
+    {
+        lock_guard<mutex> lockGuard(m_mutex);
+        jobs.swap(m_jobs);
+    }
+
+    for (auto& job : jobs) {
+        job.wait();
+    }
+}
+
+unsigned TexturePipeline::getJobCount()
+{
+    lock_guard<mutex> lockGuard(m_mutex);
+    return static_cast<unsigned>(m_targetsBySource.size());
+}
+
+unsigned TexturePipeline::getWrittenTextureCount() const
+{
+    return m_writtenTextureCount;
+}
+
+string TexturePipeline::enqueue(const string& sourceKey, const string& targetDirectory, const string& targetFileName, function<void(const string&)> job)
+{
+    lock_guard<mutex> lockGuard(m_mutex);
+
+    auto targetKey = targetDirectory + targetFileName;
+    toLower(targetKey);
+
+    // Reuse the texture of an already queued job with the same source and target directory.
+    const auto sourceDirectoryKey = targetKey.substr(0, targetDirectory.size()) + "|" + sourceKey;
+    const auto target = m_targetsBySource.find(sourceDirectoryKey);
+    if (target != m_targetsBySource.end()) {
+        return target->second;
+    }
+
+    // Never write the same file twice - number the file name if another source already claimed it.
+    auto uniqueFileName = targetFileName;
+    if (m_sourcesByTarget.count(targetKey)) {
+        const auto extensionOffset = targetFileName.find_last_of('.');
+        const auto stem = targetFileName.substr(0, extensionOffset);
+        const auto extension = extensionOffset != string::npos ? targetFileName.substr(extensionOffset) : "";
+
+        for (auto number = 2; m_sourcesByTarget.count(targetKey); number++) {
+            uniqueFileName = stem + "_" + to_string(number) + extension;
+            targetKey = targetDirectory + uniqueFileName;
+            toLower(targetKey);
+        }
+
+        warning("Texture file name \"%s\" is used by different textures, write \"%s\" instead.", targetFileName.c_str(), uniqueFileName.c_str());
+    }
+
+    const auto targetFilePath = targetDirectory + uniqueFileName;
+
+    m_targetsBySource[sourceDirectoryKey] = uniqueFileName;
+    m_sourcesByTarget[targetKey] = sourceDirectoryKey;
+
+    // Failures are logged here, so waiting for the jobs never throws, e.g. in a destructor.
+    m_jobs.push_back(m_threadPool.enqueue([this, job, targetFilePath]() {
+        Tracing::ScopedSpan span("convertTexture", targetFilePath.c_str());
+
+        try {
+            job(targetFilePath);
+            m_writtenTextureCount++;
+        } catch (const exception& exception) {
+            warning("Failed to write texture \"%s\": %s", targetFilePath.c_str(), exception.what());
+        }
+    }));
+
+    return uniqueFileName;
+}
+
+} // namespace GCL::Utilities
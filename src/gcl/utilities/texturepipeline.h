@@ -0,0 +1,122 @@
+#pragma once
+
+#include "gcl/importer/grannyformat.h"
+#include "gcl/utilities/threadpool.h"
+
+#include <atomic>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief Converts textures asynchronously and exactly once per source.
+///
+/// Texture jobs are collected during the material export and processed by a thread pool
+/// while the export of meshes and animations continues. Jobs are deduplicated by source
+/// file path or, for textures embedded in granny files, by content hash. The file name of
+/// a texture is known when the job is queued, so the material export does not wait.
+/// Different sources with the same target file name get numbered file names.
+///
+class TexturePipeline {
+public:
+    ///
+    /// \brief Constructor
+    /// \param threadCount Number of worker threads. Uses the number of hardware threads if zero.
+    ///
+    explicit TexturePipeline(unsigned threadCount = 0);
+
+    ///
+    /// \brief Destructor - waits for all queued texture jobs.
+    ///
+    ~TexturePipeline();
+
+    ///
+    /// \brief Queues the conversion of a texture file.
+    /// \param sourceFilePath File path of the source texture.
+    /// \param targetDirectory Directory of the converted texture including trailing separator.
+    /// \param targetFileName File name of the converted texture.
+    /// \param flipImage If image should be flipped.
+    /// \return File name of the converted texture. Differs from targetFileName if the source was already queued
+    /// or another source claimed the file name.
+    ///
+    string convertImage(const string& sourceFilePath, const string& targetDirectory, const string& targetFileName, bool flipImage = false);
+
+    ///
+    /// \brief Queues the export of a texture embedded in a granny file.
+    /// \param grannyTexture Granny texture which shares the ownership of its granny file, so it outlives the job.
+    /// \param targetDirectory Directory of the exported texture including trailing separator.
+    /// \param targetFileName File name of the exported texture.
+    /// \param flipImage If image should be flipped.
+    /// \return File name of the exported texture. Differs from targetFileName if the texture was already queued
+    /// or another source claimed the file name.
+    ///
+    string exportTexture(shared_ptr<GrannyTexture> grannyTexture, const string& targetDirectory, const string& targetFileName, bool flipImage = false);
+
+    ///
+    /// \brief Waits until all queued texture jobs are done. Failed jobs are logged and never rethrown.
+    ///
+    void wait();
+
+    ///
+    /// \brief Returns the number of queued, deduplicated texture jobs.
+    /// \return Number of texture jobs
+    ///
+    unsigned getJobCount();
+
+    ///
+    /// \brief Returns the number of finished texture jobs, i.e. textures written.
+    /// \return Number of written textures
+    ///
+    unsigned getWrittenTextureCount() const;
+
+protected:
+    ///
+    /// \brief Queues a texture job unless a job for the same source already exists.
+    /// \param sourceKey Key identifying the texture source.
+    /// \param targetDirectory Directory of the texture including trailing separator.
+    /// \param targetFileName File name of the texture.
+    /// \param job Job to convert the texture to the given target file path.
+    /// \return File name of the texture.
+    ///
+    string enqueue(const string& sourceKey, const string& targetDirectory, const string& targetFileName, function<void(const string&)> job);
+
+protected:
+    ///
+    /// \brief Target file names stored by source key.
+    ///
+    map<string, string> m_targetsBySource;
+
+    ///
+    /// \brief Source keys stored by target file path to prevent concurrent writes of the same file.
+    ///
+    map<string, string> m_sourcesByTarget;
+
+    ///
+    /// \brief Results of the queued texture jobs.
+    ///
+    vector<future<void>> m_jobs;
+
+    ///
+    /// \brief Guards the job bookkeeping.
+    ///
+    mutex m_mutex;
+
+    ///
+    /// \brief Number of finished texture jobs.
+    ///
+    atomic<unsigned> m_writtenTextureCount = 0;
+
+    ///
+    /// \brief Worker threads for the texture jobs.
+    ///
+    ThreadPool m_threadPool;
+};
+
+} // namespace GCL::Utilities
@@ -1,11 +1,17 @@
 #include "gcl/utilities/textureutility.h"
+#include "gcl/utilities/imagewriter.h"
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/stringutility.h"
+#include "gcl/utilities/texturedecoder.h"
 
+#include <algorithm>
+#include <filesystem>
 #include <vector>
 
-#include <IL/ilu.h>
-
 namespace GCL::Utilities {
 
+using namespace GCL::Utilities::Logging;
+
 GrannyTexture* getMaterialTexture(GrannyMaterial* grannyMaterial)
 {
     GrannyTexture* texture = nullptr;
@@ -35,54 +41,139 @@ GrannyTexture* getMaterialTexture(GrannyMaterial* grannyMaterial)
     return texture;
 }
 
+size_t hashTexture(const GrannyTexture* grannyTexture)
+{
+    // FNV-1a over the texture properties and the pixel bytes of the first mip level of all images.
+    uint64_t hash = 14695981039346656037ull;
+
+    const auto hashBytes = [&hash](const void* data, size_t size) {
+        const auto bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+
+    hashBytes(&grannyTexture->TextureType, sizeof(grannyTexture->TextureType));
+    hashBytes(&grannyTexture->Width, sizeof(grannyTexture->Width));
+    hashBytes(&grannyTexture->Height, sizeof(grannyTexture->Height));
+    hashBytes(&grannyTexture->Encoding, sizeof(grannyTexture->Encoding));
+    hashBytes(&grannyTexture->SubFormat, sizeof(grannyTexture->SubFormat));
+    hashBytes(&grannyTexture->Layout, sizeof(GrannyPixelLayout));
+
+    for (auto imageIndex = 0; imageIndex < grannyTexture->ImageCount; imageIndex++) {
+        const auto& image = grannyTexture->Images[imageIndex];
+
+        if (image.MIPLevelCount > 0) {
+            const auto& mipLevel = image.MIPLevels[0];
+            hashBytes(mipLevel.PixelBytes, static_cast<size_t>(mipLevel.PixelByteCount));
+        }
+    }
+
+    return static_cast<size_t>(hash);
+}
+
+bool exportCompressedTexture(GrannyTexture* grannyTexture, string textureFilePath, bool flipImage)
+{
+    if (grannyTexture->Encoding != GrannyS3TCTextureEncoding || grannyTexture->TextureType != GrannyColorMapTextureType || grannyTexture->ImageCount < 1) {
+        return false;
+    }
+
+    BlockImageView image;
+    image.width = grannyTexture->Width;
+    image.height = grannyTexture->Height;
+
+    switch (grannyTexture->SubFormat) {
+    case GrannyS3TCBGRA8888MappedAlpha:
+        image.format = BlockFormat::BC2;
+        break;
+    case GrannyS3TCBGRA8888InterpolatedAlpha:
+        image.format = BlockFormat::BC3;
+        break;
+    default:
+        image.format = BlockFormat::BC1;
+        break;
+    }
+
+    const auto& grannyImage = grannyTexture->Images[0];
+
+    for (auto mipIndex = 0; mipIndex < grannyImage.MIPLevelCount; mipIndex++) {
+        const auto& mipLevel = grannyImage.MIPLevels[mipIndex];
+        const auto width = max(1, image.width >> mipIndex);
+        const auto height = max(1, image.height >> mipIndex);
+
+        if (!mipLevel.PixelBytes || static_cast<size_t>(mipLevel.PixelByteCount) < getBlockImageSize(image.format, width, height)) {
+            break;
+        }
+
+        image.mipLevels.push_back(static_cast<const unsigned char*>(mipLevel.PixelBytes));
+    }
+
+    if (image.mipLevels.empty() || (flipImage && !canFlipBlocks(image))) {
+        return false;
+    }
+
+    return writeDds(textureFilePath, image, flipImage);
+}
+
 void exportTexture(GrannyTexture* grannyTexture, string textureFilePath, bool flipImage)
 {
-    int bytesPerPixel;
-    GrannyPixelLayout const* grannyPixelLayout;
-    ILenum ilFormat;
-
-    if (GrannyTextureHasAlpha(grannyTexture)) {
-        bytesPerPixel = 4;
-        grannyPixelLayout = GrannyRGBA8888PixelFormat;
-        ilFormat = IL_RGBA;
+    // Keep the blocks of compressed textures as they are if a dds file is requested.
+    auto extension = filesystem::u8path(textureFilePath).extension().u8string();
+    toLower(extension);
+
+    if (extension == ".dds" && exportCompressedTexture(grannyTexture, textureFilePath, flipImage)) {
+        return;
+    }
+
+    // Dds files keep every mip level, the other formats store only the largest one.
+    vector<DecodedImage> decodedImages;
+
+    if (extension == ".dds") {
+        decodedImages = decodeTextureMipLevels(grannyTexture);
     } else {
-        bytesPerPixel = 3;
-        grannyPixelLayout = GrannyRGB888PixelFormat;
-        ilFormat = IL_RGB;
+        DecodedImage decodedImage;
+        if (decodeTextureImage(grannyTexture, 0, 0, decodedImage)) {
+            decodedImages.push_back(move(decodedImage));
+        }
+    }
+
+    if (decodedImages.empty()) {
+        warning("Skip exporting texture \"%s\" because it could not be decoded.", grannyTexture->FromFileName);
+        return;
     }
 
-    vector<unsigned char> pixels;
-    pixels.resize(grannyTexture->Width * grannyTexture->Height * bytesPerPixel);
-
-    GrannyCopyTextureImage(
-        grannyTexture,
-        0,
-        0,
-        grannyPixelLayout,
-        grannyTexture->Width,
-        grannyTexture->Height,
-        grannyTexture->Width * bytesPerPixel,
-        pixels.data());
-
-    ILuint imageId;
-    ilGenImages(1, &imageId);
-    ilBindImage(imageId);
-
-    ilTexImage(
-        grannyTexture->Width,
-        grannyTexture->Height,
-        1,
-        bytesPerPixel,
-        ilFormat,
-        IL_UNSIGNED_BYTE,
-        pixels.data());
-
-    if (flipImage) {
-        iluFlipImage();
+    const auto hasAlpha = textureHasAlpha(grannyTexture);
+    vector<ImageView> images;
+
+    for (auto& decodedImage : decodedImages) {
+        ImageView image;
+        image.pixels = decodedImage.pixels.data();
+        image.width = decodedImage.width;
+        image.height = decodedImage.height;
+        image.channels = 4;
+
+        if (!hasAlpha) {
+            image.channels = 3;
+
+            // Pack the decoded RGBA pixels to RGB in place.
+            const auto pixelCount = static_cast<size_t>(decodedImage.width) * static_cast<size_t>(decodedImage.height);
+            for (size_t i = 0; i < pixelCount; i++) {
+                decodedImage.pixels[i * 3] = decodedImage.pixels[i * 4];
+                decodedImage.pixels[i * 3 + 1] = decodedImage.pixels[i * 4 + 1];
+                decodedImage.pixels[i * 3 + 2] = decodedImage.pixels[i * 4 + 2];
+            }
+        }
+
+        images.push_back(image);
     }
 
-    ilSave(IL_PNG, textureFilePath.c_str());
-    ilDeleteImages(1, &imageId);
+    const auto isWritten = extension == ".dds"
+        ? writeDds(textureFilePath, images, flipImage)
+        : writeImage(textureFilePath, images.front(), flipImage);
+
+    if (!isWritten) {
+        warning("Failed to write texture \"%s\".", textureFilePath.c_str());
+    }
 }
 
 } // namespace GCL::Utilities
@@ -11,8 +11,29 @@ namespace GCL::Utilities {
 ///
 GrannyTexture* getMaterialTexture(GrannyMaterial* grannyMaterial);
 
+///
+/// \brief Returns a hash of the content of a granny texture.
+/// \param grannyTexture Granny texture
+/// \return Hash of dimensions, encoding and pixel bytes of the texture.
+///
+size_t hashTexture(const GrannyTexture* grannyTexture);
+
+///
+/// \brief Exports a S3TC compressed texture from granny2 to a dds file without re-encoding its blocks.
+/// \param grannyTexture Granny texture
+/// \param textureFilePath Export file path for the granny texture.
+/// \param flipImage If image should be flipped.
+/// \return Returns whether the texture was exported or needs to be decoded.
+///
+bool exportCompressedTexture(GrannyTexture* grannyTexture, string textureFilePath, bool flipImage = false);
+
 ///
 /// \brief Exports a embedded texture from granny2 to a file.
+///
+/// The file format is chosen by the file extension (png, tga or dds).
+/// S3TC compressed textures are written as they are to dds files. Other textures
+/// are decoded, dds files keep all of their mip levels.
+///
 /// \param grannyTexture Granny texture
 /// \param textureFilePath Export file path for the granny texture.
 /// \param flipImage If image should be flipped.
@@ -0,0 +1,79 @@
+#include "gcl/utilities/threadpool.h"
+
+#include "gcl/utilities/logging.h"
+
+#include <algorithm>
+
+namespace GCL::Utilities {
+
+ThreadPool::ThreadPool(unsigned threadCount, string name)
+{
+    if (!threadCount) {
+        threadCount = max(1u, thread::hardware_concurrency());
+    }
+
+    m_threads.reserve(threadCount);
+
+    for (unsigned i = 0; i < threadCount; i++) {
+        m_threads.emplace_back(&ThreadPool::work, this, name + "-" + to_string(i));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lockGuard(m_mutex);
+        m_stop = true;
+    }
+
+    m_taskAvailable.notify_all();
+
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::wait()
+{
+    unique_lock<mutex> lock(m_mutex);
+    m_tasksDone.wait(lock, [this]() { return m_tasks.empty() && !m_activeTaskCount; });
+}
+
+unsigned ThreadPool::getThreadCount() const
+{
+    return static_cast<unsigned>(m_threads.size());
+}
+
+void ThreadPool::work(string threadTag)
+{
+    Logging::setThreadTag(threadTag.c_str());
+
+    for (;;) {
+        function<void()> task;
+
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_taskAvailable.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+
+            // Finish all queued tasks before stopping.
+            if (m_tasks.empty()) {
+                return;
+            }
+
+            task = move(m_tasks.front());
+            m_tasks.pop();
+            m_activeTaskCount++;
+        }
+
+        task();
+
+        {
+            lock_guard<mutex> lockGuard(m_mutex);
+            m_activeTaskCount--;
+        }
+
+        m_tasksDone.notify_all();
+    }
+}
+
+} // namespace GCL::Utilities
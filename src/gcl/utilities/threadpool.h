@@ -0,0 +1,116 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace GCL::Utilities {
+
+using namespace std;
+
+///
+/// \brief Fixed size pool of worker threads processing queued tasks.
+///
+class ThreadPool {
+public:
+    ///
+    /// \brief Constructor
+    /// \param threadCount Number of worker threads. Uses the number of hardware threads if zero.
+    /// \param name Name of the pool - worker threads log with the tag "<name>-<index>".
+    ///
+    explicit ThreadPool(unsigned threadCount = 0, string name = "worker");
+
+    ///
+    /// \brief Destructor - waits for all queued tasks.
+    ///
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ///
+    /// \brief Queues a task.
+    /// \param task Task to be executed by a worker thread.
+    /// \return Future of the task result.
+    ///
+    template <typename Task>
+    future<invoke_result_t<Task>> enqueue(Task task)
+    {
+        using Result = invoke_result_t<Task>;
+
+        auto packagedTask = make_shared<packaged_task<Result()>>(move(task));
+        auto result = packagedTask->get_future();
+
+        {
+            lock_guard<mutex> lockGuard(m_mutex);
+            m_tasks.emplace([packagedTask]() { (*packagedTask)(); });
+        }
+
+        m_taskAvailable.notify_one();
+
+        return result;
+    }
+
+    ///
+    /// \brief Waits until all queued tasks are processed.
+    ///
+    void wait();
+
+    ///
+    /// \brief Returns the number of worker threads.
+    /// \return Thread count
+    ///
+    unsigned getThreadCount() const;
+
+protected:
+    ///
+    /// \brief Processes queued tasks until the pool is stopped.
+    /// \param threadTag Log tag of the worker thread.
+    ///
+    void work(string threadTag);
+
+protected:
+    ///
+    /// \brief Worker threads.
+    ///
+    vector<thread> m_threads;
+
+    ///
+    /// \brief Queued tasks.
+    ///
+    queue<function<void()>> m_tasks;
+
+    ///
+    /// \brief Number of tasks currently processed.
+    ///
+    unsigned m_activeTaskCount = 0;
+
+    ///
+    /// \brief Flag to stop the worker threads.
+    ///
+    bool m_stop = false;
+
+    ///
+    /// \brief Guards tasks and flags.
+    ///
+    mutex m_mutex;
+
+    ///
+    /// \brief Signals queued tasks or stop.
+    ///
+    condition_variable m_taskAvailable;
+
+    ///
+    /// \brief Signals that all tasks are processed.
+    ///
+    condition_variable m_tasksDone;
+};
+
+} // namespace GCL::Utilities
@@ -0,0 +1,173 @@
+#include "gcl/utilities/tracing.h"
+
+#include "gcl/utilities/logging.h"
+#include "gcl/utilities/stringutility.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace GCL::Utilities::Tracing {
+
+using namespace std::chrono;
+
+using namespace GCL::Utilities::Logging;
+
+namespace {
+
+///
+/// \brief Completed span of a thread.
+///
+struct TraceEvent {
+    const char* name = nullptr;
+    string detail;
+    int64_t begin = 0;
+    int64_t duration = 0;
+    unsigned threadId = 0;
+};
+
+///
+/// \brief Recorded spans of the trace. Spans are coarse, so a mutex is cheap enough.
+///
+struct Trace {
+    atomic<bool> isEnabled = false;
+    steady_clock::time_point start;
+    string filePath;
+    vector<TraceEvent> events;
+    map<unsigned, string> threadNames;
+    mutex eventMutex;
+};
+
+Trace& trace()
+{
+    static Trace trace;
+    return trace;
+}
+
+int64_t now()
+{
+    return duration_cast<microseconds>(steady_clock::now() - trace().start).count();
+}
+
+unsigned getThreadId()
+{
+    static atomic<unsigned> threadCount = 0;
+    thread_local const auto threadId = ++threadCount;
+
+    return threadId;
+}
+
+} // namespace
+
+void start(const string& filePath)
+{
+    auto& currentTrace = trace();
+    lock_guard<mutex> lockGuard(currentTrace.eventMutex);
+
+    if (!currentTrace.isEnabled) {
+        currentTrace.start = steady_clock::now();
+        currentTrace.events.clear();
+        currentTrace.threadNames.clear();
+    }
+
+    currentTrace.filePath = filePath;
+    currentTrace.isEnabled = true;
+}
+
+void write()
+{
+    auto& currentTrace = trace();
+    lock_guard<mutex> lockGuard(currentTrace.eventMutex);
+
+    if (currentTrace.filePath.empty()) {
+        return;
+    }
+
+    ofstream file(filesystem::u8path(currentTrace.filePath));
+    if (!file) {
+        warning("Failed to write trace file \"%s\".", currentTrace.filePath.c_str());
+        return;
+    }
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    auto isFirst = true;
+    for (const auto& [threadId, threadName] : currentTrace.threadNames) {
+        file << (isFirst ? "" : ",")
+             << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId
+             << ",\"args\":{\"name\":\"" << escapeJson(threadName) << "\"}}";
+        isFirst = false;
+    }
+
+    for (const auto& event : currentTrace.events) {
+        file << (isFirst ? "" : ",")
+             << "\n{\"name\":\"" << escapeJson(event.name)
+             << "\",\"cat\":\"gcl\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadId
+             << ",\"ts\":" << event.begin
+             << ",\"dur\":" << event.duration;
+
+        if (!event.detail.empty()) {
+            file << ",\"args\":{\"detail\":\"" << escapeJson(event.detail) << "\"}";
+        }
+
+        file << "}";
+        isFirst = false;
+    }
+
+    file << "\n]}\n";
+}
+
+void stop()
+{
+    write();
+
+    auto& currentTrace = trace();
+    lock_guard<mutex> lockGuard(currentTrace.eventMutex);
+    currentTrace.isEnabled = false;
+}
+
+bool isEnabled()
+{
+    return trace().isEnabled.load(memory_order_relaxed);
+}
+
+ScopedSpan::ScopedSpan(const char* name, const char* detail)
+    : m_name(name)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    if (detail) {
+        m_detail = detail;
+    }
+
+    m_begin = now();
+}
+
+ScopedSpan::~ScopedSpan()
+{
+    if (m_begin < 0 || !isEnabled()) {
+        return;
+    }
+
+    TraceEvent event;
+    event.name = m_name;
+    event.detail = move(m_detail);
+    event.begin = m_begin;
+    event.duration = now() - m_begin;
+    event.threadId = getThreadId();
+
+    auto& currentTrace = trace();
+    lock_guard<mutex> lockGuard(currentTrace.eventMutex);
+
+    currentTrace.threadNames.try_emplace(event.threadId, getThreadTag());
+    currentTrace.events.push_back(move(event));
+}
+
+} // namespace GCL::Utilities::Tracing
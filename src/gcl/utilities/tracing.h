@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace GCL::Utilities::Tracing {
+
+using namespace std;
+
+///
+/// \brief Starts recording trace spans.
+///
+/// Spans are written as chrome trace json which can be opened in chrome://tracing or
+/// https://ui.perfetto.dev. Each thread shows up as its own track named by its log tag.
+/// Starting an already started trace keeps the recorded spans and only updates the file path.
+///
+/// \param filePath File path of the trace json file.
+///
+void start(const string& filePath);
+
+///
+/// \brief Writes all recorded spans to the trace file.
+///
+void write();
+
+///
+/// \brief Writes all recorded spans and stops recording.
+///
+void stop();
+
+///
+/// \brief Returns whether trace spans are recorded.
+///
+bool isEnabled();
+
+///
+/// \brief Records the time between its construction and destruction as trace span.
+///
+/// Does nothing but checking a flag if tracing is disabled.
+///
+class ScopedSpan {
+public:
+    ///
+    /// \brief Constructor - begins the span.
+    /// \param name Name of the span, must outlive the trace.
+    /// \param detail Optional detail like a file path. It is copied only if tracing is enabled.
+    ///
+    explicit ScopedSpan(const char* name, const char* detail = nullptr);
+
+    ///
+    /// \brief Destructor - ends the span.
+    ///
+    ~ScopedSpan();
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+protected:
+    ///
+    /// \brief Name of the span.
+    ///
+    const char* m_name = nullptr;
+
+    ///
+    /// \brief Detail of the span.
+    ///
+    string m_detail;
+
+    ///
+    /// \brief Begin of the span in microseconds since the start of the trace.
+    ///
+    int64_t m_begin = -1;
+};
+
+} // namespace GCL::Utilities::Tracing
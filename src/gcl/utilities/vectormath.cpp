@@ -0,0 +1,311 @@
+#include "gcl/utilities/vectormath.h"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE__)
+#define GCL_VECTOR_MATH_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace GCL::Utilities::VectorMath {
+
+namespace {
+
+#ifdef GCL_VECTOR_MATH_SSE
+///
+/// \brief Returns the sum of all four lanes in the first lane.
+///
+__m128 sumLanes(__m128 value)
+{
+    const auto pairs = _mm_add_ps(value, _mm_movehl_ps(value, value));
+    return _mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1)));
+}
+#endif
+
+///
+/// \brief Returns a * (1 - weight) + b * weight for all four components.
+///
+void blend(const float a[4], const float b[4], float weightA, float weightB, float result[4])
+{
+#ifdef GCL_VECTOR_MATH_SSE
+    _mm_store_ps(result, _mm_add_ps(_mm_mul_ps(_mm_load_ps(a), _mm_set1_ps(weightA)), _mm_mul_ps(_mm_load_ps(b), _mm_set1_ps(weightB))));
+#else
+    for (auto i = 0; i < 4; i++) {
+        result[i] = a[i] * weightA + b[i] * weightB;
+    }
+#endif
+}
+
+float dot4(const float a[4], const float b[4])
+{
+#ifdef GCL_VECTOR_MATH_SSE
+    return _mm_cvtss_f32(sumLanes(_mm_mul_ps(_mm_load_ps(a), _mm_load_ps(b))));
+#else
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+#endif
+}
+
+} // namespace
+
+Vector3 add(const Vector3& a, const Vector3& b)
+{
+    Vector3 result;
+    blend(a.values, b.values, 1.0f, 1.0f, result.values);
+    return result;
+}
+
+Vector3 subtract(const Vector3& a, const Vector3& b)
+{
+    Vector3 result;
+    blend(a.values, b.values, 1.0f, -1.0f, result.values);
+    return result;
+}
+
+Vector3 scale(const Vector3& vector, float factor)
+{
+    Vector3 result;
+#ifdef GCL_VECTOR_MATH_SSE
+    _mm_store_ps(result.values, _mm_mul_ps(_mm_load_ps(vector.values), _mm_set1_ps(factor)));
+#else
+    for (auto axis = 0; axis < 3; axis++) {
+        result[axis] = vector[axis] * factor;
+    }
+#endif
+    return result;
+}
+
+float dot(const Vector3& a, const Vector3& b)
+{
+    // The padding is zero, so it adds nothing.
+    return dot4(a.values, b.values);
+}
+
+Vector3 cross(const Vector3& a, const Vector3& b)
+{
+    Vector3 result;
+#ifdef GCL_VECTOR_MATH_SSE
+    const auto left = _mm_load_ps(a.values);
+    const auto right = _mm_load_ps(b.values);
+    const auto leftYzx = _mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 0, 2, 1));
+    const auto rightYzx = _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 0, 2, 1));
+    const auto product = _mm_sub_ps(_mm_mul_ps(left, rightYzx), _mm_mul_ps(leftYzx, right));
+    _mm_store_ps(result.values, _mm_shuffle_ps(product, product, _MM_SHUFFLE(3, 0, 2, 1)));
+#else
+    result[0] = a[1] * b[2] - a[2] * b[1];
+    result[1] = a[2] * b[0] - a[0] * b[2];
+    result[2] = a[0] * b[1] - a[1] * b[0];
+#endif
+    return result;
+}
+
+float length(const Vector3& vector)
+{
+    return sqrtf(dot(vector, vector));
+}
+
+Vector3 normalize(const Vector3& vector)
+{
+    const auto vectorLength = length(vector);
+    return vectorLength > 0.0f ? scale(vector, 1.0f / vectorLength) : vector;
+}
+
+Vector3 lerp(const Vector3& a, const Vector3& b, float weight)
+{
+    Vector3 result;
+    blend(a.values, b.values, 1.0f - weight, weight, result.values);
+    return result;
+}
+
+Quaternion multiply(const Quaternion& a, const Quaternion& b)
+{
+    return Quaternion(
+        a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1],
+        a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0],
+        a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3],
+        a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2]);
+}
+
+Quaternion conjugate(const Quaternion& quaternion)
+{
+    return Quaternion(-quaternion[0], -quaternion[1], -quaternion[2], quaternion[3]);
+}
+
+float dot(const Quaternion& a, const Quaternion& b)
+{
+    return dot4(a.values, b.values);
+}
+
+Quaternion normalize(const Quaternion& quaternion)
+{
+    const auto quaternionLength = sqrtf(dot(quaternion, quaternion));
+    if (quaternionLength <= 0.0f) {
+        return Quaternion();
+    }
+
+    Quaternion result;
+    blend(quaternion.values, quaternion.values, 1.0f / quaternionLength, 0.0f, result.values);
+    return result;
+}
+
+Quaternion slerp(const Quaternion& a, const Quaternion& b, float weight)
+{
+    // q and -q are the same rotation, take the one closer to a.
+    auto cosine = dot(a, b);
+    const auto sign = cosine < 0.0f ? -1.0f : 1.0f;
+    cosine *= sign;
+
+    auto weightA = 1.0f - weight;
+    auto weightB = weight;
+
+    if (cosine < 0.9995f) {
+        const auto angle = acosf(cosine);
+        const auto inverseSine = 1.0f / sinf(angle);
+        weightA = sinf(weightA * angle) * inverseSine;
+        weightB = sinf(weightB * angle) * inverseSine;
+    }
+
+    Quaternion result;
+    blend(a.values, b.values, weightA, weightB * sign, result.values);
+
+    return cosine < 0.9995f ? result : normalize(result);
+}
+
+Vector3 rotate(const Quaternion& quaternion, const Vector3& vector)
+{
+    // v' = v + 2w (q x v) + 2 q x (q x v)
+    const Vector3 axis(quaternion[0], quaternion[1], quaternion[2]);
+    const auto twice = scale(cross(axis, vector), 2.0f);
+
+    return add(add(vector, scale(twice, quaternion[3])), cross(axis, twice));
+}
+
+Quaternion fromEulerAngles(const Vector3& degrees)
+{
+    constexpr auto halfRadiansPerDegree = 3.14159265358979323846f / 360.0f;
+
+    const Quaternion x(sinf(degrees[0] * halfRadiansPerDegree), 0.0f, 0.0f, cosf(degrees[0] * halfRadiansPerDegree));
+    const Quaternion y(0.0f, sinf(degrees[1] * halfRadiansPerDegree), 0.0f, cosf(degrees[1] * halfRadiansPerDegree));
+    const Quaternion z(0.0f, 0.0f, sinf(degrees[2] * halfRadiansPerDegree), cosf(degrees[2] * halfRadiansPerDegree));
+
+    return multiply(z, multiply(y, x));
+}
+
+Matrix4 identity()
+{
+    Matrix4 matrix;
+    for (auto row = 0; row < 4; row++) {
+        for (auto column = 0; column < 4; column++) {
+            matrix.rows[row][column] = row == column ? 1.0f : 0.0f;
+        }
+    }
+
+    return matrix;
+}
+
+Matrix4 toMatrix(const Quaternion& quaternion)
+{
+    auto matrix = identity();
+
+    const auto unit = normalize(quaternion);
+    const auto x = unit[0];
+    const auto y = unit[1];
+    const auto z = unit[2];
+    const auto w = unit[3];
+
+    // Rows are the rotated axes, i.e. the columns of the column vector rotation.
+    matrix.rows[0][0] = 1.0f - 2.0f * (y * y + z * z);
+    matrix.rows[0][1] = 2.0f * (x * y + w * z);
+    matrix.rows[0][2] = 2.0f * (x * z - w * y);
+    matrix.rows[1][0] = 2.0f * (x * y - w * z);
+    matrix.rows[1][1] = 1.0f - 2.0f * (x * x + z * z);
+    matrix.rows[1][2] = 2.0f * (y * z + w * x);
+    matrix.rows[2][0] = 2.0f * (x * z + w * y);
+    matrix.rows[2][1] = 2.0f * (y * z - w * x);
+    matrix.rows[2][2] = 1.0f - 2.0f * (x * x + y * y);
+
+    return matrix;
+}
+
+void multiply(const Matrix4& first, const Matrix4& second, Matrix4& result)
+{
+#ifdef GCL_VECTOR_MATH_SSE
+    const auto second0 = _mm_load_ps(second.rows[0]);
+    const auto second1 = _mm_load_ps(second.rows[1]);
+    const auto second2 = _mm_load_ps(second.rows[2]);
+    const auto second3 = _mm_load_ps(second.rows[3]);
+
+    // Each result row is the first row weighting the rows of the second matrix.
+    for (auto row = 0; row < 4; row++) {
+        auto sum = _mm_mul_ps(_mm_set1_ps(first.rows[row][0]), second0);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(first.rows[row][1]), second1));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(first.rows[row][2]), second2));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(first.rows[row][3]), second3));
+        _mm_store_ps(result.rows[row], sum);
+    }
+#else
+    for (auto row = 0; row < 4; row++) {
+        for (auto column = 0; column < 4; column++) {
+            result.rows[row][column] = first.rows[row][0] * second.rows[0][column]
+                + first.rows[row][1] * second.rows[1][column]
+                + first.rows[row][2] * second.rows[2][column]
+                + first.rows[row][3] * second.rows[3][column];
+        }
+    }
+#endif
+}
+
+void scaleRows(Matrix4& matrix, const Vector3& factors)
+{
+    for (auto row = 0; row < 3; row++) {
+        blend(matrix.rows[row], matrix.rows[row], factors[row], 0.0f, matrix.rows[row]);
+    }
+}
+
+Vector3 getEulerAngles(const Matrix4& matrix)
+{
+    constexpr auto degreesPerRadian = 180.0f / 3.14159265358979323846f;
+
+    float axes[3][3];
+    for (auto row = 0; row < 3; row++) {
+        const auto axis = normalize(Vector3(matrix.rows[row][0], matrix.rows[row][1], matrix.rows[row][2]));
+        for (auto column = 0; column < 3; column++) {
+            axes[row][column] = axis[column];
+        }
+    }
+
+    // The rows hold the transposed rotation Rz * Ry * Rx, so axes[0][2] is -sin(y).
+    const auto sineY = -axes[0][2] < -1.0f ? -1.0f : (-axes[0][2] > 1.0f ? 1.0f : -axes[0][2]);
+    Vector3 degrees;
+
+    if (fabsf(sineY) < 0.99999f) {
+        degrees[0] = atan2f(axes[1][2], axes[2][2]);
+        degrees[1] = asinf(sineY);
+        degrees[2] = atan2f(axes[0][1], axes[0][0]);
+    } else {
+        // Gimbal lock, x and z rotate about the same axis, so all of it goes to x.
+        degrees[0] = atan2f(-axes[2][1], axes[1][1]);
+        degrees[1] = asinf(sineY);
+        degrees[2] = 0.0f;
+    }
+
+    return scale(degrees, degreesPerRadian);
+}
+
+Vector3 transformPoint(const Matrix4& matrix, const Vector3& point)
+{
+    Vector3 result;
+#ifdef GCL_VECTOR_MATH_SSE
+    auto sum = _mm_add_ps(_mm_load_ps(matrix.rows[3]), _mm_mul_ps(_mm_set1_ps(point[0]), _mm_load_ps(matrix.rows[0])));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(point[1]), _mm_load_ps(matrix.rows[1])));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(point[2]), _mm_load_ps(matrix.rows[2])));
+    _mm_store_ps(result.values, sum);
+    result[3] = 0.0f;
+#else
+    for (auto column = 0; column < 3; column++) {
+        result[column] = matrix.rows[3][column] + point[0] * matrix.rows[0][column] + point[1] * matrix.rows[1][column] + point[2] * matrix.rows[2][column];
+    }
+#endif
+    return result;
+}
+
+} // namespace GCL::Utilities::VectorMath
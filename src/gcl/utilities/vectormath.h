@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+
+namespace GCL::Utilities::VectorMath {
+
+///
+/// \brief Three component float vector, padded to one SSE register.
+///
+struct alignas(16) Vector3 {
+    ///
+    /// \brief Components x, y, z and the padding, which stays zero.
+    ///
+    float values[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    Vector3() = default;
+
+    Vector3(float x, float y, float z)
+        : values { x, y, z, 0.0f }
+    {
+    }
+
+    float& operator[](size_t axis)
+    {
+        return values[axis];
+    }
+
+    float operator[](size_t axis) const
+    {
+        return values[axis];
+    }
+};
+
+///
+/// \brief Rotation quaternion in granny order (x, y, z, w), the identity by default.
+///
+struct alignas(16) Quaternion {
+    float values[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    Quaternion() = default;
+
+    Quaternion(float x, float y, float z, float w)
+        : values { x, y, z, w }
+    {
+    }
+
+    float& operator[](size_t component)
+    {
+        return values[component];
+    }
+
+    float operator[](size_t component) const
+    {
+        return values[component];
+    }
+};
+
+///
+/// \brief 4x4 matrix for row vectors with the translation in the last row, the layout of FbxAMatrix.
+///
+struct alignas(16) Matrix4 {
+    float rows[4][4];
+};
+
+Vector3 add(const Vector3& a, const Vector3& b);
+Vector3 subtract(const Vector3& a, const Vector3& b);
+Vector3 scale(const Vector3& vector, float factor);
+float dot(const Vector3& a, const Vector3& b);
+Vector3 cross(const Vector3& a, const Vector3& b);
+float length(const Vector3& vector);
+
+///
+/// \brief Returns the vector scaled to unit length, or the vector itself if it has no length.
+///
+Vector3 normalize(const Vector3& vector);
+
+///
+/// \brief Interpolates linearly from a at weight 0 to b at weight 1.
+///
+Vector3 lerp(const Vector3& a, const Vector3& b, float weight);
+
+///
+/// \brief Multiplies two quaternions, b rotates first.
+///
+Quaternion multiply(const Quaternion& a, const Quaternion& b);
+
+Quaternion conjugate(const Quaternion& quaternion);
+float dot(const Quaternion& a, const Quaternion& b);
+
+///
+/// \brief Returns the quaternion scaled to unit length, or the identity if it has no length.
+///
+Quaternion normalize(const Quaternion& quaternion);
+
+///
+/// \brief Interpolates spherically along the shorter arc from a at weight 0 to b at weight 1.
+///
+/// Nearly parallel quaternions are interpolated linearly and normalized.
+///
+Quaternion slerp(const Quaternion& a, const Quaternion& b, float weight);
+
+///
+/// \brief Rotates a vector by a unit quaternion.
+///
+Vector3 rotate(const Quaternion& quaternion, const Vector3& vector);
+
+///
+/// \brief Converts euler angles in degrees to a quaternion, rotating about x first, like fbx eEulerXYZ.
+///
+Quaternion fromEulerAngles(const Vector3& degrees);
+
+///
+/// \brief Returns the identity matrix.
+///
+Matrix4 identity();
+
+///
+/// \brief Returns the rotation matrix of a quaternion, which gets normalized.
+///
+Matrix4 toMatrix(const Quaternion& quaternion);
+
+///
+/// \brief Multiplies two matrices, the result applies first first and then second.
+/// \param first Matrix which is applied first, e.g. a local transform.
+/// \param second Matrix which is applied second, e.g. the world transform of the parent.
+/// \param result Receives the product, may not alias the factors.
+///
+void multiply(const Matrix4& first, const Matrix4& second, Matrix4& result);
+
+///
+/// \brief Scales the x, y and z rows of a matrix, i.e. scales before the matrix applies.
+///
+void scaleRows(Matrix4& matrix, const Vector3& factors);
+
+///
+/// \brief Returns the euler angles in degrees of the rotation of a matrix, rotating about x first.
+///
+/// The rows are normalized first, so the matrix may be scaled. Matches the decomposition of
+/// FbxAMatrix::GetR for the eEulerXYZ order.
+///
+Vector3 getEulerAngles(const Matrix4& matrix);
+
+///
+/// \brief Transforms a point by a matrix, including its translation.
+///
+Vector3 transformPoint(const Matrix4& matrix, const Vector3& point);
+
+} // namespace GCL::Utilities::VectorMath
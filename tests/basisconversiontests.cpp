@@ -0,0 +1,99 @@
+#include "gcl/utilities/basisconversion.h"
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+using namespace GCL::Utilities;
+
+namespace {
+
+///
+/// \brief Tightly packed vertex with the layout of GrannyPN33Vertex.
+///
+struct PN33Vertex {
+    float position[3];
+    float normal[3];
+};
+
+static_assert(sizeof(PN33Vertex) == 24);
+
+int failureCount = 0;
+
+void expectNear(const char* name, size_t index, const float actual[3], const float expected[3])
+{
+    for (auto axis = 0; axis < 3; axis++) {
+        if (std::fabs(actual[axis] - expected[axis]) > 1e-5f) {
+            std::printf("FAILED %s %zu: (%g, %g, %g) expected (%g, %g, %g)\n",
+                name, index, actual[0], actual[1], actual[2], expected[0], expected[1], expected[2]);
+            failureCount++;
+            return;
+        }
+    }
+}
+
+///
+/// \brief Z up meters to Y up centimeters, as from a 3ds Max file to fbx.
+///
+BasisConversion::Conversion getZUpToYUp()
+{
+    BasisConversion::Basis source;
+    source.up[1] = 0.0f;
+    source.up[2] = 1.0f;
+    source.back[1] = -1.0f;
+    source.back[2] = 0.0f;
+
+    BasisConversion::Basis target;
+    target.unitsPerMeter = 100.0f;
+
+    return BasisConversion::compute(source, target);
+}
+
+void testPackedPN33Vertices()
+{
+    // Odd counts leave a tail for the scalar path. The buffer has exactly the size of the vertices,
+    // so an address sanitizer catches a vector load past the normal of the last vertex.
+    for (size_t vertexCount = 1; vertexCount <= 5; vertexCount++) {
+        const auto vertices = std::make_unique<PN33Vertex[]>(vertexCount);
+
+        for (size_t index = 0; index < vertexCount; index++) {
+            const auto value = static_cast<float>(index + 1);
+            vertices[index] = { { value, 2.0f * value, 3.0f * value }, { 0.0f, 0.0f, 1.0f } };
+        }
+
+        const auto conversion = getZUpToYUp();
+        BasisConversion::transformPoints(conversion, vertices[0].position, vertexCount, sizeof(PN33Vertex));
+        BasisConversion::transformDirections(conversion, vertices[0].normal, vertexCount, sizeof(PN33Vertex));
+
+        for (size_t index = 0; index < vertexCount; index++) {
+            const auto value = static_cast<float>(index + 1);
+
+            // (x, y, z) with z up becomes (x, z, -y) with y up.
+            const float position[3] = { 100.0f * value, 300.0f * value, -200.0f * value };
+            const float normal[3] = { 0.0f, 1.0f, 0.0f };
+
+            expectNear("position", index, vertices[index].position, position);
+            expectNear("normal", index, vertices[index].normal, normal);
+        }
+    }
+}
+
+void testIdentity()
+{
+    const auto conversion = BasisConversion::compute(BasisConversion::Basis(), BasisConversion::Basis());
+
+    if (!conversion.isIdentity || conversion.isMirrored) {
+        std::printf("FAILED identity\n");
+        failureCount++;
+    }
+}
+
+} // namespace
+
+int main()
+{
+    testPackedPN33Vertices();
+    testIdentity();
+
+    return failureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,363 @@
+#include "gcl/generator/grannyfilewriter.h"
+#include "gcl/generator/grannytypes.h"
+#include "gcl/generator/syntheticscene.h"
+#include "gcl/utilities/checksum.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace GCL::Generator;
+
+namespace {
+
+static_assert(sizeof(void*) == 8, "The writer encodes 64 bit granny files, which are read back in place.");
+
+///
+/// \brief Magic value of little endian 64 bit granny files of version 7.
+///
+constexpr unsigned char LittleEndian64Magic[16] = {
+    0xe5, 0x9b, 0x49, 0x5e, 0x6f, 0x63, 0x1f, 0x14, 0x1e, 0x13, 0xeb, 0xa9, 0x90, 0xbe, 0xed, 0xc4
+};
+
+///
+/// \brief Standard type tag of granny2_x64.dll, the build the converter loads.
+///
+constexpr unsigned int GrannyDllTypeTag = 0x80000037;
+
+int failureCount = 0;
+
+void expect(bool condition, const std::string& name)
+{
+    if (!condition) {
+        std::printf("FAILED %s\n", name.c_str());
+        failureCount++;
+    }
+}
+
+template <typename Type>
+Type read(const unsigned char* source)
+{
+    // Members of granny structures are packed and may be unaligned.
+    Type value;
+    std::memcpy(&value, source, sizeof(Type));
+    return value;
+}
+
+///
+/// \brief Main section of a parsed granny file with its pointer fixups applied.
+///
+struct LoadedFile {
+    GrannyFileHeader header = {};
+    std::vector<unsigned char> mainSection;
+};
+
+///
+/// \brief Parses the magic value, header and section table and applies the pointer fixups
+/// of the main section, like granny does when it loads an uncompressed file.
+///
+bool loadFile(const std::vector<unsigned char>& file, LoadedFile& loaded)
+{
+    if (file.size() < sizeof(GrannyFileMagic) + sizeof(GrannyFileHeader)) {
+        expect(false, "file holds magic value and header");
+        return false;
+    }
+
+    const auto magic = read<GrannyFileMagic>(file.data());
+    expect(std::memcmp(magic.MagicValue, LittleEndian64Magic, sizeof(LittleEndian64Magic)) == 0, "magic value");
+
+    const auto headerSize = static_cast<size_t>(magic.HeaderSize);
+    loaded.header = read<GrannyFileHeader>(file.data() + sizeof(GrannyFileMagic));
+    const auto& header = loaded.header;
+
+    expect(header.Version == 7, "version");
+    expect(header.TotalSize == file.size(), "total size");
+    expect(header.SectionArrayCount == GrannyStandardSectionCount, "section count");
+    expect(headerSize == sizeof(GrannyFileMagic) + sizeof(GrannyFileHeader) + GrannyStandardSectionCount * sizeof(GrannyGRNSection), "header size");
+    expect(headerSize <= file.size() && header.CRC == GCL::Utilities::crc32(file.data() + headerSize, file.size() - headerSize), "crc");
+
+    // Standard tags have the high bit set, so the tree is converted by its embedded types.
+    expect((header.TypeTag & 0x80000000u) == 0 && header.TypeTag != GrannyDllTypeTag, "type tag is no standard tag");
+
+    const auto sectionArrayOffset = sizeof(GrannyFileMagic) + static_cast<size_t>(header.SectionArrayOffset);
+    if (sectionArrayOffset + header.SectionArrayCount * sizeof(GrannyGRNSection) > file.size()) {
+        expect(false, "section table within file");
+        return false;
+    }
+
+    for (unsigned sectionIndex = 0; sectionIndex < header.SectionArrayCount; sectionIndex++) {
+        const auto section = read<GrannyGRNSection>(file.data() + sectionArrayOffset + sectionIndex * sizeof(GrannyGRNSection));
+        const auto name = "section " + std::to_string(sectionIndex);
+
+        expect(section.Format == 0, name + " is uncompressed");
+        expect(section.ExpandedDataSize == section.DataSize, name + " expanded size");
+        expect(static_cast<size_t>(section.DataOffset) + section.DataSize <= file.size(), name + " data within file");
+        expect(static_cast<size_t>(section.PointerFixupArrayOffset) + section.PointerFixupArrayCount * sizeof(GrannyGRNPointerFixup) <= file.size(), name + " fixups within file");
+        expect(section.MixedMarshallingFixupArrayCount == 0, name + " has no marshalling fixups");
+
+        if (sectionIndex != GrannyStandardMainSection) {
+            expect(section.DataSize == 0 && section.PointerFixupArrayCount == 0, name + " is empty");
+            continue;
+        }
+
+        if (static_cast<size_t>(section.DataOffset) + section.DataSize > file.size()) {
+            return false;
+        }
+
+        loaded.mainSection.assign(file.begin() + section.DataOffset, file.begin() + section.DataOffset + section.DataSize);
+
+        for (unsigned fixupIndex = 0; fixupIndex < section.PointerFixupArrayCount; fixupIndex++) {
+            const auto fixup = read<GrannyGRNPointerFixup>(file.data() + section.PointerFixupArrayOffset + fixupIndex * sizeof(GrannyGRNPointerFixup));
+
+            if (fixup.To.SectionIndex != GrannyStandardMainSection
+                || static_cast<size_t>(fixup.FromOffset) + sizeof(void*) > loaded.mainSection.size()
+                || fixup.To.Offset > loaded.mainSection.size()) {
+                expect(false, "fixup " + std::to_string(fixupIndex) + " within main section");
+                return false;
+            }
+
+            const auto pointer = loaded.mainSection.data() + fixup.To.Offset;
+            std::memcpy(loaded.mainSection.data() + fixup.FromOffset, &pointer, sizeof(pointer));
+        }
+    }
+
+    expect(header.RootObject.SectionIndex == GrannyStandardMainSection && header.RootObject.Offset < loaded.mainSection.size(), "root object reference");
+    expect(header.RootObjectTypeDefinition.SectionIndex == GrannyStandardMainSection && header.RootObjectTypeDefinition.Offset < loaded.mainSection.size(), "root type reference");
+
+    return !loaded.mainSection.empty();
+}
+
+///
+/// \brief Compares an embedded type definition with its source, including all referenced types.
+///
+/// Sections are only four byte aligned, so the embedded definitions are read member by member.
+///
+void compareTypes(
+    const std::string& path,
+    const GrannyDataTypeDefinition* expected,
+    const unsigned char* actual,
+    std::set<std::pair<const void*, const void*>>& compared)
+{
+    if (!compared.insert({ expected, actual }).second) {
+        return;
+    }
+
+    for (size_t member = 0;; member++) {
+        const auto& expectedMember = expected[member];
+        const auto actualMember = read<GrannyDataTypeDefinition>(actual + member * sizeof(GrannyDataTypeDefinition));
+        const auto name = path + "." + (expectedMember.Name ? expectedMember.Name : "");
+
+        expect(actualMember.Type == expectedMember.Type, name + " type");
+        expect(actualMember.ArrayWidth == expectedMember.ArrayWidth, name + " array width");
+        expect(!expectedMember.Name == !actualMember.Name
+                && (!expectedMember.Name || std::strcmp(expectedMember.Name, actualMember.Name) == 0),
+            name + " name");
+        expect(!expectedMember.ReferenceType == !actualMember.ReferenceType, name + " reference type");
+
+        if (expectedMember.ReferenceType && actualMember.ReferenceType) {
+            compareTypes(name, expectedMember.ReferenceType, reinterpret_cast<const unsigned char*>(actualMember.ReferenceType), compared);
+        }
+
+        if (expectedMember.Type == GrannyEndMember || actualMember.Type != expectedMember.Type) {
+            break;
+        }
+    }
+}
+
+void compareObjects(const std::string& path, const GrannyDataTypeDefinition* type, const unsigned char* expected, const unsigned char* actual);
+
+///
+/// \brief Compares an array of objects which both trees reference.
+///
+void compareArray(const std::string& path, const GrannyDataTypeDefinition* type, const unsigned char* expected, const unsigned char* actual, int count)
+{
+    if (count <= 0 || !expected) {
+        return;
+    }
+
+    if (!actual) {
+        expect(false, path + " is referenced");
+        return;
+    }
+
+    const auto objectSize = static_cast<size_t>(getTypeSize(type));
+    for (auto i = 0; i < count; i++) {
+        compareObjects(path + "[" + std::to_string(i) + "]", type, expected + objectSize * static_cast<size_t>(i), actual + objectSize * static_cast<size_t>(i));
+    }
+}
+
+void compareMember(const std::string& path, const GrannyDataTypeDefinition& member, const unsigned char* expected, const unsigned char* actual, int size)
+{
+    switch (member.Type) {
+    case GrannyInlineMember:
+        compareObjects(path, member.ReferenceType, expected, actual);
+        break;
+
+    case GrannyReferenceMember:
+        compareArray(path, member.ReferenceType, read<const unsigned char*>(expected), read<const unsigned char*>(actual), 1);
+        break;
+
+    case GrannyStringMember: {
+        const auto expectedText = read<const char*>(expected);
+        const auto actualText = read<const char*>(actual);
+        expect(!expectedText == !actualText && (!expectedText || std::strcmp(expectedText, actualText) == 0), path);
+        break;
+    }
+
+    case GrannyReferenceToArrayMember: {
+        const auto count = read<int>(expected);
+        expect(read<int>(actual) == count, path + " count");
+        compareArray(path, member.ReferenceType, read<const unsigned char*>(expected + sizeof(int)), read<const unsigned char*>(actual + sizeof(int)), count);
+        break;
+    }
+
+    case GrannyArrayOfReferencesMember: {
+        const auto count = read<int>(expected);
+        expect(read<int>(actual) == count, path + " count");
+
+        const auto expectedReferences = read<const unsigned char*>(expected + sizeof(int));
+        const auto actualReferences = read<const unsigned char*>(actual + sizeof(int));
+        if (count <= 0 || !expectedReferences) {
+            break;
+        }
+
+        if (!actualReferences) {
+            expect(false, path + " is referenced");
+            break;
+        }
+
+        for (auto i = 0; i < count; i++) {
+            const auto offset = static_cast<size_t>(i) * sizeof(void*);
+            compareArray(path + "[" + std::to_string(i) + "]", member.ReferenceType, read<const unsigned char*>(expectedReferences + offset), read<const unsigned char*>(actualReferences + offset), 1);
+        }
+        break;
+    }
+
+    case GrannyVariantReferenceMember:
+    case GrannyReferenceToVariantArrayMember: {
+        const auto expectedType = read<const GrannyDataTypeDefinition*>(expected);
+        const auto actualType = read<const unsigned char*>(actual);
+        expect(!expectedType == !actualType, path + " type");
+        if (!expectedType || !actualType) {
+            break;
+        }
+
+        std::set<std::pair<const void*, const void*>> compared;
+        compareTypes(path + " type", expectedType, actualType, compared);
+
+        if (member.Type == GrannyVariantReferenceMember) {
+            compareArray(path, expectedType, read<const unsigned char*>(expected + sizeof(void*)), read<const unsigned char*>(actual + sizeof(void*)), 1);
+        } else {
+            const auto count = read<int>(expected + sizeof(void*));
+            expect(read<int>(actual + sizeof(void*)) == count, path + " count");
+            compareArray(path, expectedType, read<const unsigned char*>(expected + sizeof(void*) + sizeof(int)), read<const unsigned char*>(actual + sizeof(void*) + sizeof(int)), count);
+        }
+        break;
+    }
+
+    case GrannyEmptyReferenceMember:
+        break;
+
+    default:
+        expect(std::memcmp(expected, actual, static_cast<size_t>(size)) == 0, path);
+        break;
+    }
+}
+
+///
+/// \brief Compares an object read back from a file with its source by its type definition.
+///
+void compareObjects(const std::string& path, const GrannyDataTypeDefinition* type, const unsigned char* expected, const unsigned char* actual)
+{
+    for (auto member = type; member->Type != GrannyEndMember; member++) {
+        const auto memberSize = getMemberSize(*member);
+        const auto elementCount = std::max(member->ArrayWidth, 1);
+        const auto elementSize = memberSize / elementCount;
+        const auto name = path + "." + (member->Name ? member->Name : "");
+
+        for (auto element = 0; element < elementCount; element++) {
+            compareMember(name, *member, expected + element * elementSize, actual + element * elementSize, elementSize);
+        }
+
+        expected += memberSize;
+        actual += memberSize;
+    }
+}
+
+void testRoundTrip(const char* name, const SyntheticSceneOptions& options)
+{
+    const auto failuresBefore = failureCount;
+
+    SyntheticScene scene(options);
+    const auto file = encodeGrannyFile(scene.getFileInfo(), FileInfoType);
+
+    LoadedFile loaded;
+    if (!loadFile(file, loaded)) {
+        std::printf("FAILED %s: file could not be loaded\n", name);
+        failureCount++;
+        return;
+    }
+
+    std::set<std::pair<const void*, const void*>> compared;
+    compareTypes("FileInfo", FileInfoType, loaded.mainSection.data() + loaded.header.RootObjectTypeDefinition.Offset, compared);
+
+    compareObjects("FileInfo", FileInfoType, reinterpret_cast<const unsigned char*>(scene.getFileInfo()), loaded.mainSection.data() + loaded.header.RootObject.Offset);
+
+    if (failureCount != failuresBefore) {
+        std::printf("FAILED %s\n", name);
+    }
+}
+
+void testSkinnedScene()
+{
+    SyntheticSceneOptions options;
+    options.boneCount = 8;
+    options.meshCount = 2;
+    options.vertexCount = 64;
+    options.animationDuration = 0.5f;
+    options.textureCount = 1;
+    options.textureSize = 16;
+
+    testRoundTrip("skinned scene", options);
+}
+
+void testRigidScene()
+{
+    SyntheticSceneOptions options;
+    options.boneCount = 3;
+    options.meshCount = 1;
+    options.vertexCount = 16;
+    options.vertexLayout = VertexLayout::PNT332;
+    options.curveFormat = CurveFormat::DaK16uC16u;
+    options.animationDuration = 0.25f;
+    options.textureCount = 1;
+    options.textureSize = 8;
+    options.textureFormat = TextureFormat::DXT5;
+
+    testRoundTrip("rigid scene", options);
+}
+
+void testEmptyScene()
+{
+    SyntheticSceneOptions options;
+    options.meshCount = 0;
+    options.animationCount = 0;
+    options.textureCount = 0;
+
+    testRoundTrip("empty scene", options);
+}
+
+} // namespace
+
+int main()
+{
+    testSkinnedScene();
+    testRigidScene();
+    testEmptyScene();
+
+    return failureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+#include "gcl/utilities/meshoptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <vector>
+
+using namespace GCL::Utilities;
+
+namespace {
+
+using Triangle = std::array<unsigned, 3>;
+
+int failureCount = 0;
+
+///
+/// \brief Returns the triangles rotated to start with their smallest index and sorted, so the
+/// triangle sets of two index lists with the same windings compare equal.
+///
+std::vector<Triangle> getTriangles(const std::vector<unsigned>& indices)
+{
+    std::vector<Triangle> triangles;
+
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        Triangle triangle = { indices[i], indices[i + 1], indices[i + 2] };
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.push_back(triangle);
+    }
+
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+///
+/// \brief Creates a grid of cellCount x cellCount cells with two triangles per cell.
+///
+std::vector<unsigned> createGrid(unsigned cellCount)
+{
+    const auto gridSize = cellCount + 1;
+    std::vector<unsigned> indices;
+
+    for (unsigned row = 0; row + 1 < gridSize; row++) {
+        for (unsigned column = 0; column + 1 < gridSize; column++) {
+            const auto topLeft = row * gridSize + column;
+            const auto bottomLeft = topLeft + gridSize;
+
+            indices.insert(indices.end(), { topLeft, bottomLeft, topLeft + 1 });
+            indices.insert(indices.end(), { topLeft + 1, bottomLeft, bottomLeft + 1 });
+        }
+    }
+
+    return indices;
+}
+
+void expectSameTriangles(const char* name, const std::vector<unsigned>& indices, size_t vertexCount)
+{
+    auto optimized = indices;
+    MeshOptimizer::optimizeVertexCache(optimized.data(), optimized.size(), vertexCount);
+
+    if (getTriangles(optimized) != getTriangles(indices)) {
+        std::printf("FAILED %s: the optimized triangles differ from the input triangles\n", name);
+        failureCount++;
+    }
+}
+
+void testGrid()
+{
+    expectSameTriangles("grid", createGrid(6), 49);
+}
+
+void testDegenerateTriangles()
+{
+    // Degenerate triangles are listed once per corner at their vertices.
+    auto indices = createGrid(6);
+    indices.insert(indices.end(), { 0, 0, 1 });
+    expectSameTriangles("degenerate triangle", indices, 49);
+
+    indices.insert(indices.end(), { 7, 7, 7 });
+    indices.insert(indices.end(), { 14, 20, 14 });
+    expectSameTriangles("degenerate triangles", indices, 49);
+}
+
+} // namespace
+
+int main()
+{
+    testGrid();
+    testDegenerateTriangles();
+
+    return failureCount == 0 ? 0 : 1;
+}
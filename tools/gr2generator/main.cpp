@@ -0,0 +1,188 @@
+#include "gcl/generator/syntheticscene.h"
+#include "gcl/utilities/logging.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+using namespace std;
+using namespace GCL::Generator;
+
+namespace {
+
+///
+/// \brief Returns the value of an argument of the form --<name>=<value> or nullptr.
+///
+const char* getArgumentValue(const char* argument, const char* name)
+{
+    const auto nameLength = strlen(name);
+
+    if (strncmp(argument, name, nameLength) == 0 && argument[nameLength] == '=') {
+        return argument + nameLength + 1;
+    }
+
+    return nullptr;
+}
+
+void printUsage(const char* program)
+{
+    printf("Usage: %s [options] <output.gr2>\n"
+           "  --bones=<count>              Bones of the skeleton (64)\n"
+           "  --meshes=<count>             Meshes (4)\n"
+           "  --vertices=<count>           Vertices per mesh (10000)\n"
+           "  --materials=<count>          Materials per mesh (2)\n"
+           "  --layout=<layout>            pnt332, pwnt3432 or pwnt34322 (pwnt3432)\n"
+           "  --animations=<count>         Animations (1)\n"
+           "  --duration=<seconds>         Duration of each animation (5)\n"
+           "  --fps=<rate>                 Knots per second of the curves (30)\n"
+           "  --curve=<format>             dak32fc32f, dak16uc16u or identity (dak32fc32f)\n"
+           "  --textures=<count>           Textures (2)\n"
+           "  --texture-size=<pixels>      Width and height of the textures (512)\n"
+           "  --texture-format=<format>    bgra8888, dxt1 or dxt5 (bgra8888)\n"
+           "  --scale=<factor>             Multiplies bone, vertex and animation counts (1)\n"
+           "  --seed=<value>               Seed of the random generator (1)\n",
+        program);
+}
+
+bool parseVertexLayout(const string& value, VertexLayout& layout)
+{
+    if (value == "pnt332") {
+        layout = VertexLayout::PNT332;
+    } else if (value == "pwnt3432") {
+        layout = VertexLayout::PWNT3432;
+    } else if (value == "pwnt34322") {
+        layout = VertexLayout::PWNT34322;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool parseCurveFormat(const string& value, CurveFormat& format)
+{
+    if (value == "dak32fc32f") {
+        format = CurveFormat::DaK32fC32f;
+    } else if (value == "dak16uc16u") {
+        format = CurveFormat::DaK16uC16u;
+    } else if (value == "identity") {
+        format = CurveFormat::DaIdentity;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool parseTextureFormat(const string& value, TextureFormat& format)
+{
+    if (value == "bgra8888") {
+        format = TextureFormat::BGRA8888;
+    } else if (value == "dxt1") {
+        format = TextureFormat::DXT1;
+    } else if (value == "dxt5") {
+        format = TextureFormat::DXT5;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+int run(int argc, char* argv[])
+{
+    SyntheticSceneOptions options;
+    string outputPath;
+    auto scale = 1.0;
+    auto framesPerSecond = 30.0f;
+
+    for (auto i = 1; i < argc; i++) {
+        const auto argument = argv[i];
+        auto isValid = true;
+
+        if (const auto value = getArgumentValue(argument, "--bones")) {
+            options.boneCount = atoi(value);
+        } else if (const auto value = getArgumentValue(argument, "--meshes")) {
+            options.meshCount = atoi(value);
+        } else if (const auto value = getArgumentValue(argument, "--vertices")) {
+            options.vertexCount = atoi(value);
+        } else if (const auto value = getArgumentValue(argument, "--materials")) {
+            options.materialsPerMesh = atoi(value);
+        } else if (const auto value = getArgumentValue(argument, "--layout")) {
+            isValid = parseVertexLayout(value, options.vertexLayout);
+        } else if (const auto value = getArgumentValue(argument, "--animations")) {
+            options.animationCount = atoi(value);
+        } else if (const auto value = getArgumentValue(argument, "--duration")) {
+            options.animationDuration = static_cast<float>(atof(value));
+        } else if (const auto value = getArgumentValue(argument, "--fps")) {
+            framesPerSecond = static_cast<float>(atof(value));
+        } else if (const auto value = getArgumentValue(argument, "--curve")) {
+            isValid = parseCurveFormat(value, options.curveFormat);
+        } else if (const auto value = getArgumentValue(argument, "--textures")) {
+            options.textureCount = atoi(value);
+        } else if (const auto value = getArgumentValue(argument, "--texture-size")) {
+            options.textureSize = atoi(value);
+        } else if (const auto value = getArgumentValue(argument, "--texture-format")) {
+            isValid = parseTextureFormat(value, options.textureFormat);
+        } else if (const auto value = getArgumentValue(argument, "--scale")) {
+            scale = atof(value);
+        } else if (const auto value = getArgumentValue(argument, "--seed")) {
+            options.seed = static_cast<unsigned>(strtoul(value, nullptr, 10));
+        } else if (argument[0] != '-' && outputPath.empty()) {
+            outputPath = argument;
+        } else {
+            isValid = false;
+        }
+
+        if (!isValid) {
+            printUsage(argv[0]);
+            return strcmp(argument, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    if (outputPath.empty() || framesPerSecond <= 0.0f || scale <= 0.0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Scale the workload of the importer - bones and vertices for meshes, animations for curves.
+    options.boneCount = static_cast<int>(options.boneCount * scale);
+    options.vertexCount = static_cast<int>(options.vertexCount * scale);
+    options.animationCount = static_cast<int>(options.animationCount * scale + 0.5);
+    options.animationTimeStep = 1.0f / framesPerSecond;
+
+    SyntheticScene scene(options);
+    const auto fileInfo = scene.getFileInfo();
+
+    if (!scene.writeFile(outputPath)) {
+        return 1;
+    }
+
+    error_code errorCode;
+    const auto fileSize = filesystem::file_size(filesystem::u8path(outputPath), errorCode);
+
+    printf("Wrote %s (%llu bytes): %d bones, %d meshes, %d vertices per mesh, %d materials, %d textures, %d animations\n",
+        outputPath.c_str(),
+        errorCode ? 0ull : static_cast<unsigned long long>(fileSize),
+        fileInfo->Skeletons[0]->BoneCount,
+        fileInfo->MeshCount,
+        fileInfo->MeshCount > 0 ? fileInfo->Meshes[0]->PrimaryVertexData->VertexCount : 0,
+        fileInfo->MaterialCount,
+        fileInfo->TextureCount,
+        fileInfo->AnimationCount);
+
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto exitCode = run(argc, argv);
+
+    GCL::Utilities::Logging::shutdown();
+
+    return exitCode;
+}